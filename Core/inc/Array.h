@@ -293,8 +293,9 @@ namespace APro
         ////////////////////////////////////////////////////////////
         void push_back(const T& obj)
         {
-        	if(logical_size + 1 < physical_size)
-				reserve(logical_size + 1);
+            // Grows geometrically, so appending n objects costs O(n).
+            if(logical_size + 1 > physical_size)
+                reserve(physical_size ? physical_size * 2 : 1);
 				
             __copy_object(obj, logical_size);
             logical_size++;
@@ -419,7 +420,17 @@ namespace APro
         {
             if(sz && a)
             {
-                reserve(sz);
+                if(logical_size + sz > physical_size)
+                    reserve(logical_size + sz > physical_size * 2 ? logical_size + sz : physical_size * 2);
+
+                if(Types::IsFundamental<T>())
+                {
+                    // No constructor to call : one copy for the block.
+                    Memory::Copy(ptr + logical_size, a, sz * sizeof(T));
+                    logical_size += sz;
+                    return;
+                }
+
                 for(unsigned int i = 0; i < sz; ++i)
                 {
                     push_back(a[i]);
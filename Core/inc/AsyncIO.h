@@ -0,0 +1,306 @@
+/////////////////////////////////////////////////////////////
+/** @file AsyncIO.h
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the AsyncIO service, the IORequest and IOFuture classes.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_ASYNCIO_H
+#define APRO_ASYNCIO_H
+
+#include "Platform.h"
+#include "NonCopyable.h"
+#include "Singleton.h"
+#include "Array.h"
+#include "ThreadMutexI.h"
+#include "ThreadCondition.h"
+
+#include <functional>
+
+namespace APro
+{
+    class Thread;
+
+#if APRO_PLATFORM == APRO_WINDOWS
+    typedef HANDLE IOHandle;///< @brief Handle used for positional reads and writes.
+#else
+    typedef int    IOHandle;///< @brief Handle used for positional reads and writes.
+#endif
+
+    ////////////////////////////////////////////////////////////
+    /** @brief Result of an asynchronous operation.
+    **/
+    ////////////////////////////////////////////////////////////
+    struct IOResult
+    {
+        bool   success;///< True if every requested byte was transferred.
+        size_t size;   ///< Number of bytes transferred. Smaller than requested at the end of file.
+        int    error;  ///< System error code, or 0.
+    };
+
+    ////////////////////////////////////////////////////////////
+    /** @brief Function called when an asynchronous operation is
+     *  done. It is called by an I/O thread.
+    **/
+    ////////////////////////////////////////////////////////////
+    typedef std::function<void (const IOResult&)> IOCallback;
+
+    ////////////////////////////////////////////////////////////
+    /** @class IORequest
+     *  @ingroup Utils
+     *  @brief An operation queued in the AsyncIO service.
+     *
+     *  Requests are shared by the service and the IOFuture objects,
+     *  and destroyed when the last one releases it.
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL IORequest : public NonCopyable
+    {
+    public:
+
+        enum Operation
+        {
+            Read  = 0,///< Reads into buffer.
+            Write = 1 ///< Writes from buffer.
+        };
+
+        Operation       operation;///< Kind of operation.
+        IOHandle        handle;   ///< Handle of the file.
+        Offset          offset;   ///< Position of the first byte in the file.
+        Byte*           buffer;   ///< Bytes to read or write.
+        size_t          size;     ///< Number of bytes to read or write.
+        IOCallback      callback; ///< Called when done, may be empty.
+        IORequest*      next;     ///< Next request in the queue.
+
+        IOResult        result;   ///< Result, valid once done.
+        bool            done;     ///< True once the operation is done.
+        int             refs;     ///< Number of owners.
+        ThreadMutexI    mutex;    ///< Protects done and refs.
+        ThreadCondition condition;///< Signaled once done.
+
+    public:
+
+        IORequest();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Adds an owner to the request.
+        **/
+        ////////////////////////////////////////////////////////////
+        void retain();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Removes an owner, and destroys the request if it
+         *  was the last one.
+        **/
+        ////////////////////////////////////////////////////////////
+        void release();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Stores the result, calls the callback, then wakes
+         *  up the threads waiting for the request.
+        **/
+        ////////////////////////////////////////////////////////////
+        void complete(size_t transferred, int err);
+    };
+
+    ////////////////////////////////////////////////////////////
+    /** @class IOFuture
+     *  @ingroup Utils
+     *  @brief Gives the result of an asynchronous operation once
+     *  it is done.
+     *
+     *  The future becomes ready after the callback of the request
+     *  has returned.
+     *  @code
+     *  IOFuture future = file.readAsync(0, buffer, 4096);
+     *  // ... Do something else ...
+     *  if(future.wait().success)
+     *      use(buffer);
+     *  @endcode
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL IOFuture
+    {
+    private:
+
+        IORequest* m_request;///< Shared request, or null.
+
+    public:
+
+        IOFuture();
+        IOFuture(IORequest* request);
+        IOFuture(const IOFuture& rhs);
+        IOFuture& operator = (const IOFuture& rhs);
+        ~IOFuture();
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns true if the future refers to a request.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool isValid() const { return m_request != nullptr; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns true if the operation is done, without
+         *  blocking.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool isReady() const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Blocks the calling thread until the operation is
+         *  done, and returns its result.
+         *
+         *  @note An invalid future returns a failed result.
+        **/
+        ////////////////////////////////////////////////////////////
+        const IOResult& wait() const;
+    };
+
+    ////////////////////////////////////////////////////////////
+    /** @class AsyncIO
+     *  @ingroup Utils
+     *  @brief Serves asynchronous reads and writes with dedicated
+     *  I/O threads.
+     *
+     *  Requests are queued in a bounded queue : when it holds
+     *  getQueueDepth() requests, submitting blocks until a request
+     *  is taken by an I/O thread. Queued requests on the same file,
+     *  of the same kind and on contiguous bytes are coalesced into
+     *  one vectored system call.
+     *
+     *  When the Engine is built with the '--with-io-uring' option
+     *  and the kernel supports it, one thread submits the requests
+     *  to an io_uring and harvests their completions. Else, a pool
+     *  of threads uses positional system calls.
+     *
+     *  The service is started on the first request, with default
+     *  settings, unless start() was called before.
+     *
+     *  @note Callbacks are called by I/O threads : they must not
+     *  block, nor submit requests while the queue is full.
+     *  @note Without threads support, requests are served
+     *  synchronously when submitted.
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL AsyncIO : public NonCopyable
+    {
+        APRO_DECLARE_SINGLETON(AsyncIO)
+
+    public:
+
+        static const size_t DefaultThreads    = 2; ///< @brief Default number of threads in the pool.
+        static const size_t DefaultQueueDepth = 64;///< @brief Default maximum number of queued requests.
+        static const size_t MaxCoalesced      = 16;///< @brief Maximum number of requests in one system call.
+
+    private:
+
+        IORequest*      m_first;     ///< First queued request.
+        IORequest*      m_last;      ///< Last queued request.
+        size_t          m_depth;     ///< Number of queued requests.
+        size_t          m_max_depth; ///< Maximum number of queued requests.
+        bool            m_running;   ///< True if threads are started.
+        bool            m_stopping;  ///< True while stop() waits for threads.
+        bool            m_uring;     ///< True if the io_uring backend is used.
+        Array<Thread*>  m_threads;   ///< I/O threads.
+        ThreadMutexI    m_mutex;     ///< Protects the queue.
+        ThreadCondition m_not_empty; ///< Signaled when a request is queued.
+        ThreadCondition m_not_full;  ///< Signaled when a request is taken.
+
+    public:
+
+        AsyncIO();
+        ~AsyncIO();
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Starts the I/O threads.
+         *
+         *  @param threads : Number of threads of the pool. Ignored
+         *  by the io_uring backend, which uses only one thread.
+         *  @param queueDepth : Maximum number of queued requests.
+         *  @return False if already started.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool start(size_t threads = DefaultThreads, size_t queueDepth = DefaultQueueDepth);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Serves every queued request, then stops the I/O
+         *  threads.
+        **/
+        ////////////////////////////////////////////////////////////
+        void stop();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Queues an operation.
+         *
+         *  The buffer must stay valid, and the file opened, until
+         *  the operation is done.
+         *  @return A future to wait for the operation.
+        **/
+        ////////////////////////////////////////////////////////////
+        IOFuture submit(IORequest::Operation operation, IOHandle handle, Offset offset,
+                        Byte* buffer, size_t size, const IOCallback& callback = IOCallback());
+
+    public:
+
+        bool isRunning() const { return m_running; }
+        bool isUsingIOUring() const { return m_uring; }
+        size_t getQueueDepth() const { return m_max_depth; }
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Takes the first queued request, and every queued
+         *  request which can be coalesced with it.
+         *
+         *  Blocks while the queue is empty. Used by I/O threads.
+         *  @param batch : Array of at least MaxCoalesced requests.
+         *  @param wait : False to return 0 instead of blocking.
+         *  @return Number of requests taken, 0 if stopped.
+        **/
+        ////////////////////////////////////////////////////////////
+        size_t take(IORequest** batch, bool wait = true);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Serves given requests with positional system
+         *  calls, then completes them.
+        **/
+        ////////////////////////////////////////////////////////////
+        static void Execute(IORequest** batch, size_t count);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Transfers every byte of a request from given
+         *  position, until the end of file or an error.
+         *  @param error : Set to the system error code, or 0.
+         *  @return Number of bytes transferred from position.
+        **/
+        ////////////////////////////////////////////////////////////
+        static size_t Transfer(IORequest* request, size_t from, int& error);
+    };
+}
+
+#endif // APRO_ASYNCIO_H
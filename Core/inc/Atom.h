@@ -0,0 +1,265 @@
+/////////////////////////////////////////////////////////////
+/** @file Atom.h
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the Atom class and the AtomTable.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_ATOM_H
+#define APRO_ATOM_H
+
+#include "Platform.h"
+#include "SString.h"
+#include "GenericHash.h"
+#include "ThreadSafe.h"
+#include "NonCopyable.h"
+#include "Singleton.h"
+
+namespace APro
+{
+    ////////////////////////////////////////////////////////////
+    /** @class AtomTable
+     *  @ingroup Utils
+     *  @brief The global table holding every interned String.
+     *
+     *  Each String given to the table is stored only once, in
+     *  an Entry that is never destroyed before the end of the
+     *  program. The Entry pointer is so stable and can be used
+     *  as an identity : two Atoms are equals if they point to the
+     *  same Entry.
+     *
+     *  The Entry hash is the same as String::Hash(), so an Atom
+     *  made from TOTEXT(MyEvent) has the same hash as MyEvent::Hash.
+     *
+     *  @note This table is thread-safe. Interning locks the table,
+     *  but reading an Entry never does as Entries are immutable.
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL AtomTable : public NonCopyable,
+                               public ThreadSafe
+    {
+        APRO_DECLARE_SINGLETON(AtomTable)
+
+    public:
+
+        /** @brief An interned String. Never destroyed before the table. */
+        struct Entry
+        {
+            String   str; ///< @brief The interned String.
+            HashType hash;///< @brief Precomputed String::Hash() of the String.
+            Entry*   link;///< @brief Next Entry in the bucket chain.
+        };
+
+    private:
+
+        Entry**  mBuckets;   ///< @brief Buckets array.
+        uint32_t mNumBuckets;///< @brief Allocated size of the Buckets array.
+        uint32_t mNumEntries;///< @brief Number of interned Strings.
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Constructs the table with a default number of
+         *  buckets.
+        **/
+        ////////////////////////////////////////////////////////////
+        AtomTable();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Destroys every Entries.
+        **/
+        ////////////////////////////////////////////////////////////
+        ~AtomTable();
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the Entry for given String, creating it
+         *  if it does not exist yet.
+        **/
+        ////////////////////////////////////////////////////////////
+        const Entry* intern(const char* str, size_t sz);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the Entry for given String, or null if it
+         *  has never been interned.
+        **/
+        ////////////////////////////////////////////////////////////
+        const Entry* lookup(const char* str, size_t sz) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the number of interned Strings.
+        **/
+        ////////////////////////////////////////////////////////////
+        uint32_t size() const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the Entry of the empty String.
+        **/
+        ////////////////////////////////////////////////////////////
+        static const Entry* EmptyEntry();
+
+    private:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Finds an Entry in the correct bucket.
+        **/
+        ////////////////////////////////////////////////////////////
+        Entry* findEntry(HashType hash, const char* str, size_t sz) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Doubles the buckets array and redistributes every
+         *  Entries.
+        **/
+        ////////////////////////////////////////////////////////////
+        void rehash();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Hashes a non null-terminated String the same way
+         *  String::Hash() does.
+        **/
+        ////////////////////////////////////////////////////////////
+        static HashType HashData(const char* str, size_t sz);
+    };
+
+    ////////////////////////////////////////////////////////////
+    /** @class Atom
+     *  @ingroup Utils
+     *  @brief An interned, immutable String.
+     *
+     *  An Atom is a single pointer to an AtomTable Entry. Copying,
+     *  comparing and hashing an Atom is O(1), whatever the size of
+     *  the String is. Converting it back to a String returns a
+     *  reference to the interned String, so no copy is done.
+     *
+     *  Use it for names that are compared often : resources, loaders,
+     *  listeners, threads, parameters or events types.
+     *  @code
+     *  Atom name("MyTexture");
+     *  ResourcePtr res = ResourceManager::Get().getResource(name);
+     *  @endcode
+     *
+     *  @note The order given by operator < is the interning order,
+     *  not the alphabetical order. It is only here to let you use
+     *  Atoms as Map keys.
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL Atom
+    {
+    private:
+
+        const AtomTable::Entry* mEntry;///< @brief Interned Entry.
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Constructs the empty Atom.
+        **/
+        ////////////////////////////////////////////////////////////
+        Atom();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Constructs an Atom by interning given String.
+         *  @note Those constructors are explicit so overloads taking
+         *  a String or an Atom are never ambiguous.
+        **/
+        ////////////////////////////////////////////////////////////
+        explicit Atom(const char* str);
+        Atom(const char* str, size_t sz);
+        explicit Atom(const String& str);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Copy constructor.
+        **/
+        ////////////////////////////////////////////////////////////
+        Atom(const Atom& rhs) : mEntry(rhs.mEntry) {}
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the interned String.
+        **/
+        ////////////////////////////////////////////////////////////
+        const String& toString() const { return mEntry->str; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the interned String as a C-String.
+        **/
+        ////////////////////////////////////////////////////////////
+        const char* toCstChar() const { return mEntry->str.toCstChar(); }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the size of the interned String.
+        **/
+        ////////////////////////////////////////////////////////////
+        size_t size() const { return mEntry->str.size(); }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns true if this Atom is the empty String.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool isEmpty() const { return mEntry->str.isEmpty(); }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the hash of the interned String.
+         *  @note This is equal to String::Hash() of the same String.
+        **/
+        ////////////////////////////////////////////////////////////
+        HashType hash() const { return mEntry->hash; }
+
+        operator const String& () const { return mEntry->str; }
+
+    public:
+
+        Atom& operator = (const Atom& rhs) { mEntry = rhs.mEntry; return *this; }
+
+        bool operator == (const Atom& rhs) const { return mEntry == rhs.mEntry; }
+        bool operator != (const Atom& rhs) const { return mEntry != rhs.mEntry; }
+        bool operator <  (const Atom& rhs) const { return mEntry <  rhs.mEntry; }
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the Atom for given String only if it has
+         *  already been interned.
+         *
+         *  @return true if the Atom was found. Use this to look up
+         *  a name without growing the table.
+        **/
+        ////////////////////////////////////////////////////////////
+        static bool Find(const String& str, Atom& result);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Hash function used by GenericHash.
+        **/
+        ////////////////////////////////////////////////////////////
+        static int Hash(const Atom& atom) { return (int) (atom.hash() & 0x7FFFFFFF); }
+
+        static Atom Empty;///< @brief The empty Atom.
+    };
+
+    APRO_DECLARE_GENERICHASH(Atom, Atom::Hash);
+}
+
+#endif // APRO_ATOM_H
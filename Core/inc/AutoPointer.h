@@ -596,6 +596,9 @@ namespace APro
         }
     };
 
+    template<typename T>
+    AutoPointer<T> AutoPointer<T>::Null;
+
 #define APRO_COPY_AUTOPOINTER_CONSTRUCT(type, object) \
     type() : AutoPointer<object>() { } \
     type(object* __o) : AutoPointer<object>(__o) { } \
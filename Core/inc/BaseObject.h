@@ -242,7 +242,7 @@ namespace APro
         **/
         ////////////////////////////////////////////////////////////
         static T* New() {
-            return Allocator<PoolNum>::Get().New<T>(1);
+            return Allocator<PoolNum>::Get().template New<T>(1);
         }
         
         ////////////////////////////////////////////////////////////
@@ -251,7 +251,7 @@ namespace APro
         ////////////////////////////////////////////////////////////
         template <typename ...Args>
         static T* New(Args&&... args) {
-            return Allocator<PoolNum>::Get().New<T>(1, std::forward<Args>(args)...);
+            return Allocator<PoolNum>::Get().template New<T>(1, std::forward<Args>(args)...);
         }
         
         ////////////////////////////////////////////////////////////
@@ -259,7 +259,7 @@ namespace APro
          **/
         ////////////////////////////////////////////////////////////
         static T* NewA(size_t num) {
-            return Allocator<PoolNum>::Get().New<T>(num);
+            return Allocator<PoolNum>::Get().template New<T>(num);
         }
         
         ////////////////////////////////////////////////////////////
@@ -268,7 +268,7 @@ namespace APro
         ////////////////////////////////////////////////////////////
         template <typename ...Args>
         static T* New(size_t num, Args&&... args) {
-            return Allocator<PoolNum>::Get().New<T>(num, std::forward<Args>(args)...);
+            return Allocator<PoolNum>::Get().template New<T>(num, std::forward<Args>(args)...);
         }
         
         ////////////////////////////////////////////////////////////
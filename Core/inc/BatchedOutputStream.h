@@ -0,0 +1,186 @@
+/////////////////////////////////////////////////////////////
+/** @file BatchedOutputStream.h
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the BatchedOutputStream class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_BATCHEDOUTPUTSTREAM_H
+#define APRO_BATCHEDOUTPUTSTREAM_H
+
+#include "StreamInterface.h"
+#include "NonCopyable.h"
+#include "File.h"
+
+#include <chrono>
+
+namespace APro
+{
+    /////////////////////////////////////////////////////////////
+    /** @class BatchedOutputStream
+     *  @ingroup Utils
+     *  @brief An OutputStream gathering many small writes to a File
+     *  in one system call.
+     *
+     *  Written fragments are kept in a list of slices, and the
+     *  whole list is written with one vectored write (writev) when :
+     *  - getThreshold() bytes are pending,
+     *  - the oldest pending fragment is older than getMaxDelay(),
+     *    checked at each write,
+     *  - a fragment of at least LargeFragment bytes is written,
+     *  - flush() or seek() is called, or the stream is destroyed.
+     *
+     *  Small fragments are copied next to each other in a block of
+     *  getThreshold() bytes. Large fragments are not copied : they
+     *  are written at once with the pending ones, in the same call.
+     *
+     *  When flush() returns true, every written byte was given to
+     *  the system, in order. With setSync(true), it is also on the
+     *  disk, so it survives a crash of the system. If a write fails,
+     *  pending bytes are dropped and flush() returns false.
+     *  @code
+     *  File file("export.txt", "wb");
+     *  BatchedOutputStream out(file);
+     *  for(...) out << name << " " << value << "\n";
+     *  out.flush();
+     *  @endcode
+     *
+     *  @note Flush the stream before using its File directly.
+     *  @sa FileStream
+    **/
+    /////////////////////////////////////////////////////////////
+    class APRO_DLL BatchedOutputStream : public OutputStream,
+                                         public NonCopyable
+    {
+    public:
+
+        static const size_t DefaultThreshold = 64 * 1024;///< Default number of pending bytes written at once.
+        static const size_t LargeFragment    = 4 * 1024; ///< Fragments of this size are not copied.
+        static const size_t MaxSlices        = 64;       ///< Maximum number of slices in one call.
+
+    private:
+
+        typedef std::chrono::steady_clock Clock;
+
+        struct Slice
+        {
+            const Byte* data;///< First byte.
+            size_t      size;///< Number of bytes.
+        };
+
+        FilePtr           m_file;         ///< Written File.
+        Byte*             m_arena;        ///< Copies of the small fragments.
+        size_t            m_arena_size;   ///< Number of bytes used in m_arena.
+        Slice             m_slices[MaxSlices];///< Pending slices, in order.
+        size_t            m_slice_count;  ///< Number of pending slices.
+        size_t            m_pending;      ///< Number of pending bytes.
+        size_t            m_threshold;    ///< Size of m_arena, and flush threshold.
+        unsigned          m_max_delay;    ///< Maximum age of pending bytes, in milliseconds. 0 to disable.
+        Clock::time_point m_oldest;       ///< When the oldest pending fragment was written.
+        bool              m_sync;         ///< True to sync the File to the disk when flushed.
+
+    public:
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Constructs a stream writing to given opened File.
+         *  The File must live longer than the stream.
+         *  @param threshold : Number of pending bytes written at once.
+         *  @param maxDelay : Maximum age of pending bytes, in
+         *  milliseconds. 0 disables the delay.
+        **/
+        /////////////////////////////////////////////////////////////
+        explicit BatchedOutputStream(File& f, size_t threshold = DefaultThreshold, unsigned maxDelay = 0);
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Flushes the stream. The File is not closed.
+        **/
+        /////////////////////////////////////////////////////////////
+        ~BatchedOutputStream();
+
+    public:
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Writes every pending byte to the File.
+         *  @return False if writing failed.
+        **/
+        /////////////////////////////////////////////////////////////
+        bool flush();
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Changes the flush threshold. The stream is flushed
+         *  first.
+        **/
+        /////////////////////////////////////////////////////////////
+        void setThreshold(size_t threshold);
+
+        size_t getThreshold() const { return m_threshold; }
+
+        void setMaxDelay(unsigned maxDelay) { m_max_delay = maxDelay; }
+        unsigned getMaxDelay() const { return m_max_delay; }
+
+        /////////////////////////////////////////////////////////////
+        /** @brief If true, each flush also waits for the bytes to be
+         *  on the disk.
+        **/
+        /////////////////////////////////////////////////////////////
+        void setSync(bool sync) { m_sync = sync; }
+
+        bool isSync() const { return m_sync; }
+
+        size_t getPendingSize() const { return m_pending; }
+
+    public:
+
+        // Copied from OutputStream
+
+        bool write(const String& str);
+        bool write(const Real& str);
+        bool write(const int& str);
+        bool writeBytes(const Byte* bytes, size_t sz);
+
+    public:
+
+        // Copied from CursorStream
+
+        bool isEOS() const;
+        size_t tell() const;
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Flushes the stream, then moves the File cursor.
+        **/
+        /////////////////////////////////////////////////////////////
+        void seek(size_t pos, CursorPosition cp = CP_BEGIN);
+
+    private:
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Writes the slices, and syncs if asked.
+         *  @return False if writing failed.
+        **/
+        /////////////////////////////////////////////////////////////
+        bool writeSlices();
+    };
+}
+
+#endif // APRO_BATCHEDOUTPUTSTREAM_H
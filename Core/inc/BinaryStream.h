@@ -0,0 +1,407 @@
+/////////////////////////////////////////////////////////////
+/** @file BinaryStream.h
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the BinaryOutputStream and BinaryInputStream classes.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_BINARYSTREAM_H
+#define APRO_BINARYSTREAM_H
+
+#include "Platform.h"
+#include "NonCopyable.h"
+#include "SString.h"
+#include "Array.h"
+#include "StreamInterface.h"
+
+#include <type_traits>
+
+namespace APro
+{
+    ////////////////////////////////////////////////////////////
+    /** @brief Swaps the bytes of given number, to change its
+     *  endianness.
+    **/
+    ////////////////////////////////////////////////////////////
+    template <typename T> T SwapBytes(T value)
+    {
+        Byte* bytes = reinterpret_cast<Byte*>(&value);
+        for(size_t i = 0; i < sizeof(T) / 2; ++i)
+        {
+            Byte tmp = bytes[i];
+            bytes[i] = bytes[sizeof(T) - i - 1];
+            bytes[sizeof(T) - i - 1] = tmp;
+        }
+
+        return value;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /** @brief Returns true if numbers must be swapped to be
+     *  stored in little endian.
+    **/
+    ////////////////////////////////////////////////////////////
+    inline bool BinaryStreamSwaps()
+    {
+        return Endianness::endianness() == Endianness::Big;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /** @class BinaryOutputStream
+     *  @ingroup Utils
+     *  @brief Writes numbers, strings and arrays as bytes to an
+     *  OutputStream.
+     *
+     *  Numbers are stored in little endian, whatever the
+     *  endianness of the processor, with their fixed size or as
+     *  variable-length integers (varints, 1 byte for each 7 bits).
+     *  Strings and arrays are stored as a varint size followed by
+     *  their elements. Arrays of numbers are written in one call
+     *  on little endian processors.
+     *
+     *  An archive should begin with a header, which gives its kind
+     *  and the version of its format :
+     *  @code
+     *  FileStream file(myFile);
+     *  BinaryOutputStream out(file);
+     *  out.writeHeader(SaveTag, 2);
+     *  out << playerName << (uint32_t) level << positions;
+     *  @endcode
+     *
+     *  Other types are serialized by overloading operator <<.
+     *  Errors are sticky : once a write fails, isGood() returns
+     *  false and every other write is ignored.
+     *
+     *  @sa BinaryInputStream
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL BinaryOutputStream : public NonCopyable
+    {
+    private:
+
+        OutputStream* m_stream;///< Borrowed stream.
+        bool          m_good;  ///< False once a write failed.
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Constructs a binary stream writing to given one.
+         *  The stream must live longer than this object.
+        **/
+        ////////////////////////////////////////////////////////////
+        explicit BinaryOutputStream(OutputStream& stream);
+
+    public:
+
+        bool isGood() const { return m_good; }
+        operator bool () const { return m_good; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Writes the archive header.
+         *  @param tag : Kind of archive, checked when reading.
+         *  @param version : Version of the archive format.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool writeHeader(uint32_t tag, uint32_t version);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Writes sz raw bytes.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool writeBytes(const void* bytes, size_t sz);
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Writes a number with its fixed size.
+        **/
+        ////////////////////////////////////////////////////////////
+        template <typename T>
+        typename std::enable_if<std::is_arithmetic<T>::value, bool>::type write(T value)
+        {
+            if(sizeof(T) > 1 && BinaryStreamSwaps())
+                value = SwapBytes(value);
+            return writeBytes(&value, sizeof(T));
+        }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Writes an unsigned integer as a varint : small
+         *  values use less bytes.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool writeVarUInt(uint64_t value);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Writes a signed integer as a zigzag varint : small
+         *  absolute values use less bytes.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool writeVarInt(int64_t value);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Writes a String : its size, then its characters.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool write(const String& str);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Writes count numbers, without their count.
+        **/
+        ////////////////////////////////////////////////////////////
+        template <typename T>
+        bool writeArray(const T* values, size_t count)
+        {
+            static_assert(std::is_arithmetic<T>::value, "writeArray() needs an array of numbers.");
+
+            if(sizeof(T) == 1 || !BinaryStreamSwaps())
+                return writeBytes(values, count * sizeof(T));
+
+            for(size_t i = 0; i < count && m_good; ++i)
+                write(values[i]);
+            return m_good;
+        }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Writes an Array : its size, then its elements.
+         *
+         *  Arrays of numbers are written with writeArray(), other
+         *  elements with operator <<.
+        **/
+        ////////////////////////////////////////////////////////////
+        template <typename T>
+        bool write(const Array<T>& array)
+        {
+            writeVarUInt(array.size());
+            return writeElements(array, std::is_arithmetic<T>());
+        }
+
+        template <typename T>
+        BinaryOutputStream& operator << (const T& value) { write(value); return *this; }
+
+    private:
+
+        template <typename T>
+        bool writeElements(const Array<T>& array, std::true_type)
+        {
+            return writeArray(array.pointer(), array.size());
+        }
+
+        template <typename T>
+        bool writeElements(const Array<T>& array, std::false_type)
+        {
+            for(size_t i = 0; i < array.size() && m_good; ++i)
+                *this << array[i];
+            return m_good;
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    /** @class BinaryInputStream
+     *  @ingroup Utils
+     *  @brief Reads numbers, strings and arrays written by a
+     *  BinaryOutputStream from an InputStream.
+     *
+     *  @code
+     *  BinaryInputStream in(file);
+     *  uint32_t version;
+     *  if(in.readHeader(SaveTag, version))
+     *      in >> playerName >> level >> positions;
+     *  @endcode
+     *
+     *  Errors are sticky : once a read fails (end of stream, bad
+     *  header or too big size), isGood() returns false and every
+     *  other read fails.
+     *
+     *  @note Sizes read from the stream are limited by
+     *  getMaxSize(), so a corrupted archive can't allocate huge
+     *  blocks.
+     *  @sa BinaryOutputStream
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL BinaryInputStream : public NonCopyable
+    {
+    public:
+
+        static const size_t DefaultMaxSize = 256 * 1024 * 1024;///< @brief Default maximum size of a String or Array.
+
+    private:
+
+        InputStream* m_stream;  ///< Borrowed stream.
+        bool         m_good;    ///< False once a read failed.
+        size_t       m_max_size;///< Maximum size of a String or Array.
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Constructs a binary stream reading from given one.
+         *  The stream must live longer than this object.
+        **/
+        ////////////////////////////////////////////////////////////
+        explicit BinaryInputStream(InputStream& stream);
+
+    public:
+
+        bool isGood() const { return m_good; }
+        operator bool () const { return m_good; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Marks the stream as failed : isGood() returns false
+         *  and every other read fails.
+         *
+         *  Used by operator >> overloads which read invalid data from
+         *  a readable stream.
+        **/
+        ////////////////////////////////////////////////////////////
+        void setFailed() { m_good = false; }
+
+        void setMaxSize(size_t sz) { m_max_size = sz; }
+        size_t getMaxSize() const { return m_max_size; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Reads and checks the archive header.
+         *  @param tag : Expected kind of archive.
+         *  @param version : [out] Version of the archive format.
+         *  @return False if this is not an archive of given kind.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool readHeader(uint32_t tag, uint32_t& version);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Reads exactly sz raw bytes.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool readBytes(void* bytes, size_t sz);
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Reads a number with its fixed size.
+        **/
+        ////////////////////////////////////////////////////////////
+        template <typename T>
+        typename std::enable_if<std::is_arithmetic<T>::value, bool>::type read(T& value)
+        {
+            if(!readBytes(&value, sizeof(T)))
+                return false;
+            if(sizeof(T) > 1 && BinaryStreamSwaps())
+                value = SwapBytes(value);
+            return true;
+        }
+
+        bool readVarUInt(uint64_t& value);
+        bool readVarInt(int64_t& value);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Reads a String.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool read(String& str);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Reads count numbers.
+        **/
+        ////////////////////////////////////////////////////////////
+        template <typename T>
+        bool readArray(T* values, size_t count)
+        {
+            static_assert(std::is_arithmetic<T>::value, "readArray() needs an array of numbers.");
+
+            if(!readBytes(values, count * sizeof(T)))
+                return false;
+
+            if(sizeof(T) > 1 && BinaryStreamSwaps())
+            {
+                for(size_t i = 0; i < count; ++i)
+                    values[i] = SwapBytes(values[i]);
+            }
+
+            return true;
+        }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Reads an Array, replacing its elements.
+         *
+         *  Elements which are not numbers are read with operator >>,
+         *  and must be default-constructible.
+        **/
+        ////////////////////////////////////////////////////////////
+        template <typename T>
+        bool read(Array<T>& array)
+        {
+            Array<T>().swap(array);
+
+            size_t count;
+            if(!readSize(count))
+                return false;
+
+            // A corrupted size must not allocate a huge block at once.
+            array.reserve(count < 4096 ? count : 4096);
+            return readElements(array, count, std::is_arithmetic<T>());
+        }
+
+        template <typename T>
+        BinaryInputStream& operator >> (T& value) { read(value); return *this; }
+
+    private:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Reads a varint size, and checks it against the
+         *  maximum size.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool readSize(size_t& sz);
+
+        template <typename T>
+        bool readElements(Array<T>& array, size_t count, std::true_type)
+        {
+            // Read by blocks, so a truncated archive stops early.
+            T block[4096 / sizeof(T)];
+            while(count && m_good)
+            {
+                size_t part = count < sizeof(block) / sizeof(T) ? count : sizeof(block) / sizeof(T);
+                if(readArray(block, part))
+                    array.append(block, part);
+                count -= part;
+            }
+
+            return m_good;
+        }
+
+        template <typename T>
+        bool readElements(Array<T>& array, size_t count, std::false_type)
+        {
+            for(size_t i = 0; i < count && m_good; ++i)
+            {
+                T value;
+                *this >> value;
+                if(m_good)
+                    array.append(value);
+            }
+
+            return m_good;
+        }
+    };
+}
+
+#endif // APRO_BINARYSTREAM_H
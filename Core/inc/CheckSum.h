@@ -35,6 +35,9 @@
 
 namespace APro
 {
+    class File;
+    class InputStream;
+    
     typedef void* CheckSumType;///< @brief A General CheckSum type to return value. It should be interpreted by 
 							   ///         the CheckSum class depending on the implementation.
     
@@ -43,11 +46,26 @@ namespace APro
      *  @ingroup Utils
      *  @brief Describes a Generic CheckSum interface to generate
      *  checksums from data.
+     *
+     *  Data can be given at once with generate(), or in pieces with
+     *  begin(), update() and finalize() :
+     *  @code
+     *  crc->begin();
+     *  while(next(piece, size))
+     *      crc->update(piece, size);
+     *  CheckSumType result = crc->finalize();
+     *  @endcode
+     *  generateFile() and generateStream() use them to checksum
+     *  data larger than memory.
     **/
     /////////////////////////////////////////////////////////////
-    class CheckSum
+    class APRO_DLL CheckSum
         : public Prototype
     {
+    public:
+        
+        static const size_t DefaultChunkSize = 1024 * 1024;///< @brief Size of the pieces read by generateFile() and generateStream().
+        
     public:
         
         CheckSum() {}
@@ -77,10 +95,60 @@ namespace APro
         /** @brief Generate a checksum for the given gbyte array.
          *
          *  The return of this function depends on the implementation
-         *  used to generate the CheckSum.
+         *  used to generate the CheckSum. The default implementation
+         *  calls begin(), update() and finalize() : a checksum in
+         *  progress is lost.
+         **/
+        /////////////////////////////////////////////////////////////
+        virtual CheckSumType generate(const void* data, uint32_t lenght) { begin(); update(data, lenght); return finalize(); }
+        
+        /////////////////////////////////////////////////////////////
+        /** @brief Begins a checksum given in pieces, losing the one
+         *  in progress.
+         **/
+        /////////////////////////////////////////////////////////////
+        virtual void begin() = 0;
+        
+        /////////////////////////////////////////////////////////////
+        /** @brief Adds the next piece of the checksum in progress.
+         *
+         *  Pieces can have any size : the result is the one of
+         *  generate() with every piece put end to end.
+         **/
+        /////////////////////////////////////////////////////////////
+        virtual void update(const void* data, size_t lenght) = 0;
+        
+        /////////////////////////////////////////////////////////////
+        /** @brief Returns the checksum of every piece given since
+         *  begin().
+         **/
+        /////////////////////////////////////////////////////////////
+        virtual CheckSumType finalize() = 0;
+        
+        /////////////////////////////////////////////////////////////
+        /** @brief Generate a checksum for every byte of the given
+         *  file, from its beginning.
+         *
+         *  The file is read in pieces of chunkSize bytes with
+         *  File::readAsync() : the next piece is read while the
+         *  current one is checksummed. The cursor of the file is not
+         *  moved.
+         *
+         *  @return False if the file can't be read. result is not
+         *  set then.
          **/
         /////////////////////////////////////////////////////////////
-        virtual CheckSumType generate(const void* data, uint32_t lenght) = 0;
+        bool generateFile(File& file, CheckSumType& result, size_t chunkSize = DefaultChunkSize);
+        
+        /////////////////////////////////////////////////////////////
+        /** @brief Generate a checksum for the bytes of the given
+         *  stream, from its cursor to its end.
+         *
+         *  The stream is read in pieces of chunkSize bytes, so only
+         *  one piece is in memory.
+         **/
+        /////////////////////////////////////////////////////////////
+        CheckSumType generateStream(InputStream& stream, size_t chunkSize = DefaultChunkSize);
         
         /////////////////////////////////////////////////////////////
         /** @brief Compares two CheckSum results.
@@ -94,31 +162,21 @@ namespace APro
         /** @brief Set if a property should be enabled or no.
         **/
         /////////////////////////////////////////////////////////////
-        void setCustomProperty(const String& name, bool value) { mCustomProperties[name] = value; }
+        void setCustomProperty(const String& name, bool value) { mCustomProperties[name] = value; _onCustomPropertyChanged(name, value); }
         
     protected:
         
-        QuickMap<String, bool> mCustomProperties;///< @brief Properties holded by the CheckSum.
-    };
-    
-    
-/*
-    class CheckSumFactory
-    : public Factory<CheckSum>
-    {
-    public:
-        
-        CheckSumFactory() : Factory<CheckSum>()
-        {
-            register_prototype(String("CRC16"), AProNew(CheckSumCRC16));
-            register_prototype(String("CRC32"), AProNew(CheckSumCRC32));
-        }
-        
-    private:
+        /////////////////////////////////////////////////////////////
+        /** @brief Called when a property is set, so implementations
+         *  can keep its value instead of looking it up in generate().
+        **/
+        /////////////////////////////////////////////////////////////
+        virtual void _onCustomPropertyChanged(const String& /* name */, bool /* value */) {}
         
+    protected:
         
+        QuickMap<String, bool> mCustomProperties;///< @brief Properties holded by the CheckSum.
     };
-    */
 }
 
 #endif
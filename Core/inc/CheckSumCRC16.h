@@ -39,7 +39,9 @@ namespace APro
      *
      *  @note
      *  You can set the "Fast" property to true if you want the 
-     *  fast software algorithm. 
+     *  fast software algorithm. It uses the slicing-by-8 algorithm :
+     *  8 tables are looked up for 8 bytes, instead of one table for
+     *  each byte.
      *
      *  @see
      *  http://c.snippets.org/snip_lister.php?fname=crc_16f.c
@@ -69,8 +71,18 @@ namespace APro
         
         CheckSumType generate(const void* data, uint32_t lenght);
         
+        void begin();
+        
+        void update(const void* data, size_t lenght);
+        
+        CheckSumType finalize();
+        
         CompareResult compare(const CheckSumType first, const CheckSumType second) const;
         
+    protected:
+        
+        void _onCustomPropertyChanged(const String& name, bool value);
+        
     private:
         
         /** @brief Initialize the CRC16 data. **/
@@ -79,8 +91,15 @@ namespace APro
         /** @brief Compute the slow CRC16 algorithm for one byte. **/
         void _processCRC16Data(CRC16Data& crcdata, uint8_t value);
         
-        /** @brief Compute the fast software algorithm for a byte array. **/
-        CheckSumType _computeFast(const void* data, uint32_t lenght);
+        /** @brief Compute the fast software algorithm for a byte array, 
+         *  continuing given CRC. **/
+        uint16_t _computeFast(uint16_t crc, const void* data, size_t lenght);
+        
+    private:
+        
+        bool      mFast;   ///< @brief Value of the "Fast" property.
+        uint16_t  mCrc;    ///< @brief CRC in progress, with the fast algorithm.
+        CRC16Data mCrcData;///< @brief CRC in progress, with the slow algorithm.
         
     private:
         
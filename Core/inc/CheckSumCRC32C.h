@@ -0,0 +1,93 @@
+/////////////////////////////////////////////////////////////
+/** @file CheckSumCRC32C.h
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the CheckSumCRC32C class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_CHECKSUMCRC32C_H
+#define APRO_CHECKSUMCRC32C_H
+
+#include "Platform.h"
+#include "CheckSum.h"
+
+namespace APro
+{
+    ////////////////////////////////////////////////////////////
+    /** @class CheckSumCRC32C
+     *  @ingroup Utils
+     *  @brief CRC-32C (Castagnoli) checksum, as used by iSCSI,
+     *  ext4 or SSE4.2.
+     *
+     *  When APRO_SIMD_SSE42 is defined, the crc32 instruction
+     *  processes 8 bytes at once. Otherwise, the slicing-by-8
+     *  algorithm looks 8 tables up for 8 bytes, which removes most
+     *  of the dependencies of the byte by byte algorithm.
+     *
+     *  generate() returns the CRC in the low 32 bits of the
+     *  CheckSumType.
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL CheckSumCRC32C
+    : public CheckSum
+    {
+    private:
+
+        uint32_t mCrc;///< @brief CRC in progress.
+
+    public:
+
+        CheckSumCRC32C();
+
+        Prototype* clone() const;
+
+        CheckSumType generate(const void* data, uint32_t lenght);
+
+        void begin();
+
+        void update(const void* data, size_t lenght);
+
+        CheckSumType finalize();
+
+        CompareResult compare(const CheckSumType first, const CheckSumType second) const;
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the CRC-32C of given bytes.
+         *  @param crc : CRC of the previous bytes, to continue it.
+        **/
+        ////////////////////////////////////////////////////////////
+        static uint32_t Compute(const void* data, size_t sz, uint32_t crc = 0);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the CRC-32C of given bytes, with the
+         *  slicing-by-8 algorithm even if SSE4.2 is available.
+        **/
+        ////////////////////////////////////////////////////////////
+        static uint32_t ComputeSoftware(const void* data, size_t sz, uint32_t crc = 0);
+    };
+}
+
+#endif // APRO_CHECKSUMCRC32C_H
@@ -0,0 +1,65 @@
+/////////////////////////////////////////////////////////////
+/** @file CheckSumFactory.h
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the CheckSumFactory class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_CHECKSUMFACTORY_H
+#define APRO_CHECKSUMFACTORY_H
+
+#include "Platform.h"
+#include "Singleton.h"
+#include "CheckSum.h"
+
+namespace APro
+{
+    ////////////////////////////////////////////////////////////
+    /** @class CheckSumFactory
+     *  @ingroup Utils
+     *  @brief A Factory instanciated by the Main object, creating
+     *  CheckSum objects.
+     *
+     *  Registered prototypes are "CRC16", "CRC32C" and "XXH64".
+     *  @code
+     *  CheckSum* crc = CheckSumFactory::Get().create(String("CRC32C"));
+     *  @endcode
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL CheckSumFactory : public Factory<CheckSum>
+    {
+        APRO_DECLARE_MANUALSINGLETON(CheckSumFactory)
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Constructs the factory, and registers the
+         *  CheckSum implementations of the Engine.
+        **/
+        ////////////////////////////////////////////////////////////
+        CheckSumFactory();
+    };
+}
+
+#endif // APRO_CHECKSUMFACTORY_H
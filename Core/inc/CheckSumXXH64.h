@@ -0,0 +1,93 @@
+/////////////////////////////////////////////////////////////
+/** @file CheckSumXXH64.h
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the CheckSumXXH64 class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_CHECKSUMXXH64_H
+#define APRO_CHECKSUMXXH64_H
+
+#include "Platform.h"
+#include "CheckSum.h"
+
+namespace APro
+{
+    ////////////////////////////////////////////////////////////
+    /** @class CheckSumXXH64
+     *  @ingroup Utils
+     *  @brief 64 bits non-cryptographic checksum, compatible with
+     *  XXH64.
+     *
+     *  Four independent 64 bits lanes eat 32 bytes per round with
+     *  multiplications and rotations only, so it runs near memory
+     *  speed without any special instruction. It detects accidental
+     *  corruption, but must not be used against tampering.
+     *
+     *  @note CheckSumType holds a pointer : on 32 bits platforms,
+     *  generate() only returns the low 32 bits. Use Compute() to get
+     *  the whole value.
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL CheckSumXXH64
+    : public CheckSum
+    {
+    public:
+
+        static const size_t StripeSize = 32;///< @brief Number of bytes eaten by one round of the four lanes.
+
+    private:
+
+        uint64_t mLanes[4];           ///< @brief Lanes of the checksum in progress.
+        uint64_t mTotal;              ///< @brief Number of bytes given since begin().
+        Byte     mStripe[StripeSize]; ///< @brief Bytes waiting for a whole stripe.
+        size_t   mBuffered;           ///< @brief Number of bytes in mStripe.
+
+    public:
+
+        CheckSumXXH64();
+
+        Prototype* clone() const;
+
+        CheckSumType generate(const void* data, uint32_t lenght);
+
+        void begin();
+
+        void update(const void* data, size_t lenght);
+
+        CheckSumType finalize();
+
+        CompareResult compare(const CheckSumType first, const CheckSumType second) const;
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the checksum of given bytes.
+        **/
+        ////////////////////////////////////////////////////////////
+        static uint64_t Compute(const void* data, size_t sz, uint64_t seed = 0);
+    };
+}
+
+#endif // APRO_CHECKSUMXXH64_H
@@ -0,0 +1,261 @@
+/////////////////////////////////////////////////////////////
+/** @file CompressedStream.h
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the CompressedOutputStream and DecompressingInputStream
+ *  classes.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_COMPRESSEDSTREAM_H
+#define APRO_COMPRESSEDSTREAM_H
+
+#include "Platform.h"
+#include "NonCopyable.h"
+#include "SString.h"
+#include "StreamInterface.h"
+
+namespace APro
+{
+    ////////////////////////////////////////////////////////////
+    /** @brief Frames written by CompressedOutputStream.
+     *
+     *  A frame begins with FrameMagic and the size of its blocks,
+     *  as little endian 32 bits integers. Each block follows as its
+     *  size then its bytes, compressed with LZCodec, or stored as is
+     *  if FrameStoredBlock is set in its size. A 0 size ends the
+     *  frame.
+    **/
+    ////////////////////////////////////////////////////////////
+    const uint32_t FrameMagic       = 0x5A4C5041;///< "APLZ", read as a little-endian integer.
+    const uint32_t FrameStoredBlock = 0x80000000;///< Set in the size of a block stored as is.
+    const size_t   FrameMaxBlock    = 1 << 26;   ///< Largest block size accepted.
+
+    ////////////////////////////////////////////////////////////
+    /** @class CompressedOutputStream
+     *  @ingroup Utils
+     *  @brief Compresses what is written to it, and writes it to
+     *  another OutputStream.
+     *
+     *  Bytes are gathered in blocks, each compressed on its own with
+     *  LZCodec. A block which does not shrink is stored as is.
+     *  @code
+     *  FileStream file(myFile);
+     *  CompressedOutputStream out(file);
+     *  out.writeBytes(data, sz);
+     *  out.finish();
+     *  @endcode
+     *
+     *  @note finish() must be called, or the stream destroyed,
+     *  before the other stream is read : it writes the last block
+     *  and the end of the frame.
+     *  @note The stream can't seek.
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL CompressedOutputStream : public OutputStream, public NonCopyable
+    {
+    public:
+
+        static const size_t DefaultBlockSize = 256 * 1024;///< Default size of the blocks.
+
+    private:
+
+        OutputStream& m_out;       ///< Stream receiving the frame.
+        Byte*         m_block;     ///< Bytes waiting to be compressed.
+        Byte*         m_compressed;///< Compressed block.
+        size_t        m_block_size;///< Size of the blocks.
+        size_t        m_pending;   ///< Number of bytes in m_block.
+        size_t        m_written;   ///< Number of bytes written to this stream.
+        bool          m_finished;  ///< True once the frame is ended.
+        bool          m_good;      ///< False once a write failed.
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Constructs the stream, and writes the beginning of
+         *  the frame to given stream.
+         *  @param blockSize : Size of the blocks. Larger blocks
+         *  compress a bit better, but use more memory.
+        **/
+        ////////////////////////////////////////////////////////////
+        CompressedOutputStream(OutputStream& out, size_t blockSize = DefaultBlockSize);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Ends the frame, and destructs the stream.
+        **/
+        ////////////////////////////////////////////////////////////
+        ~CompressedOutputStream();
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Writes the last block and ends the frame. Nothing
+         *  can be written after.
+         *  @return False if a write failed.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool finish();
+
+        bool isGood() const { return m_good; }
+
+    public:
+
+        // Copied from OutputStream
+        bool write(const String& str);
+        bool write(const Real& str);
+        bool write(const int& str);
+        bool writeBytes(const Byte* bytes, size_t sz);
+
+    public:
+
+        // Copied from CursorStream
+        bool isEOS() const { return m_finished || !m_good; }
+        size_t tell() const { return m_written; }
+        size_t size() { return m_written; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Does nothing : a compressed stream can't seek.
+        **/
+        ////////////////////////////////////////////////////////////
+        void seek(size_t, CursorPosition = CP_BEGIN);
+
+    private:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Compresses and writes the pending bytes.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool writeBlock();
+    };
+
+    ////////////////////////////////////////////////////////////
+    /** @class DecompressingInputStream
+     *  @ingroup Utils
+     *  @brief Reads a frame written by a CompressedOutputStream from
+     *  another InputStream, and decompresses it.
+     *
+     *  Blocks are decompressed one by one, when read. The text
+     *  readers behave as the MemoryStream ones.
+     *  @code
+     *  FileStream file(myFile);
+     *  DecompressingInputStream in(file);
+     *  size_t sz = in.readBytes(buffer, bufferSize);
+     *  @endcode
+     *
+     *  @note Seeking backward reads the frame again from its
+     *  beginning, so the other stream must be able to seek.
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL DecompressingInputStream : public InputStream, public NonCopyable
+    {
+    private:
+
+        InputStream& m_in;        ///< Stream giving the frame.
+        size_t       m_start;     ///< Position of the frame in m_in.
+        Byte*        m_block;     ///< Decompressed block.
+        Byte*        m_compressed;///< Compressed block.
+        size_t       m_block_size;///< Size of the blocks.
+        size_t       m_size;      ///< Number of bytes in m_block.
+        size_t       m_pos;       ///< Position of the cursor in m_block.
+        size_t       m_offset;    ///< Position of m_block in the decompressed bytes.
+        bool         m_ended;     ///< True once the end of the frame is read.
+        bool         m_good;      ///< False if the frame is corrupted.
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Constructs the stream, and reads the beginning of
+         *  the frame from given stream.
+        **/
+        ////////////////////////////////////////////////////////////
+        DecompressingInputStream(InputStream& in);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Destructs the stream. The other stream is not
+         *  closed.
+        **/
+        ////////////////////////////////////////////////////////////
+        ~DecompressingInputStream();
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns false if the frame is not valid, or is
+         *  corrupted.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool isGood() const { return m_good; }
+
+    public:
+
+        // Copied from InputStream
+        bool readChar(char& to);
+        bool readWord(String& str);
+        bool readLine(String& str);
+        bool readUntill(String& str, ByteArray clist);
+        bool readReal(Real& r);
+        bool readInt(int& i);
+        size_t readBytes(Byte* bytes, size_t sz);
+
+    public:
+
+        // Copied from CursorStream
+        bool isEOS() const;
+        size_t tell() const { return m_offset + m_pos; }
+        size_t size();
+        void seek(size_t pos, CursorPosition cp = CP_BEGIN);
+
+    private:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Reads the beginning of the frame.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool readFrameHeader();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Decompresses the next block if the current one is
+         *  read.
+         *  @return False at the end of the frame.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool fill();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Reads blanck characters to the next non-blanck
+         *  one, or to the end.
+         *  @return False if the stream is at its end.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool skipBlanck(char& c);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Appends to str the characters accepted by given
+         *  table, and skips the first refused one.
+        **/
+        ////////////////////////////////////////////////////////////
+        void readSpan(String& str, const bool* accepted);
+    };
+}
+
+#endif // APRO_COMPRESSEDSTREAM_H
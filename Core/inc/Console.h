@@ -35,6 +35,7 @@
 #include "Platform.h"
 #include "Singleton.h"
 #include "SString.h"
+#include "StringBuilder.h"
 #include "ThreadSafe.h"
 
 namespace APro
@@ -304,7 +305,7 @@ namespace APro
     protected:
 
         ConsoleOptions currentState;///< Current console state.
-        String dumpedLog;///< Black box of the console. Record everything written.
+        StringBuilder dumpedLog;///< Black box of the console. Record everything written.
     };
 
     ////////////////////////////////////////////////////////////
@@ -35,6 +35,25 @@ namespace APro
         virtual ~Dictionnary() {}
         virtual void print(Console& console) const;
     };
+
+    class BinaryOutputStream;
+    class BinaryInputStream;
+
+    /////////////////////////////////////////////////////////////
+    /** @brief Writes a Dictionnary to a binary stream.
+     *
+     *  Only values holding a bool, an integer, a float, a double
+     *  or a String are written. Other values are written empty.
+    **/
+    /////////////////////////////////////////////////////////////
+    APRO_DLL BinaryOutputStream& operator << (BinaryOutputStream& stream, const Dictionnary& dict);
+
+    /////////////////////////////////////////////////////////////
+    /** @brief Reads a Dictionnary from a binary stream, adding its
+     *  entries to given one.
+    **/
+    /////////////////////////////////////////////////////////////
+    APRO_DLL BinaryInputStream& operator >> (BinaryInputStream& stream, Dictionnary& dict);
 }
 
 #endif
@@ -0,0 +1,216 @@
+/////////////////////////////////////////////////////////////
+/** @file DirectoryScanner.h
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the DirectoryScanner class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_DIRECTORYSCANNER_H
+#define APRO_DIRECTORYSCANNER_H
+
+#include "Platform.h"
+#include "NonCopyable.h"
+#include "SString.h"
+#include "StringView.h"
+#include "Array.h"
+#include "Path.h"
+
+namespace APro
+{
+    /////////////////////////////////////////////////////////////
+    /** @class DirectoryScanner
+     *  @ingroup Utils
+     *  @brief Lists the entries of a directory, and of its
+     *  subdirectories, in one flat Array.
+     *
+     *  The type of each entry is given by the directory listing
+     *  itself (d_type, read with getdents64 on Linux), so entries
+     *  are not stat'ed one by one. Subdirectories are scanned in
+     *  parallel by getThreads() threads.
+     *  @code
+     *  DirectoryScanner scanner;
+     *  scanner.setRecursive(true);
+     *  scanner.addExtension("png");
+     *  scanner.addExtension("jpg");
+     *  Array<DirectoryScanner::Entry> images = scanner.scan(Path("assets"));
+     *  @endcode
+     *
+     *  The pattern and the extensions only filter files :
+     *  directories are always traversed. Symbolic links are listed
+     *  as ET_Other and never followed. '.' and '..' are never
+     *  listed.
+     *
+     *  @note When scanning in parallel, entries are not sorted.
+    **/
+    /////////////////////////////////////////////////////////////
+    class APRO_DLL DirectoryScanner : public NonCopyable
+    {
+    public:
+
+        static const size_t DefaultThreads = 4;///< Default number of threads scanning.
+
+        /////////////////////////////////////////////////////////////
+        /** @enum EntryType
+         *  @brief Type of an entry.
+        **/
+        /////////////////////////////////////////////////////////////
+        enum EntryType
+        {
+            ET_File      = 0,///< Regular file.
+            ET_Directory = 1,///< Directory.
+            ET_Other     = 2 ///< Symbolic link, device, socket...
+        };
+
+        /////////////////////////////////////////////////////////////
+        /** @struct Entry
+         *  @brief An entry found by the scanner.
+        **/
+        /////////////////////////////////////////////////////////////
+        struct Entry
+        {
+            Path      path; ///< Scanned directory, followed by the entry path in it.
+            EntryType type; ///< Type of the entry.
+            Id        d_ino;///< Identifier of the entry.
+        };
+
+    private:
+
+        bool          m_recursive;  ///< True to scan subdirectories.
+        bool          m_skip_files; ///< True to not list files.
+        bool          m_skip_dirs;  ///< True to not list directories.
+        bool          m_skip_hidden;///< True to ignore entries beginning with '.'.
+        String        m_pattern;    ///< Glob pattern files must match, or empty.
+        Array<String> m_extensions; ///< Extensions files must have, or empty.
+        size_t        m_threads;    ///< Number of threads scanning.
+
+    public:
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Constructs a scanner listing every entry of a
+         *  directory, without its subdirectories.
+        **/
+        /////////////////////////////////////////////////////////////
+        DirectoryScanner();
+
+    public:
+
+        void setRecursive(bool recursive) { m_recursive = recursive; }
+        bool isRecursive() const { return m_recursive; }
+
+        void skipFiles(bool skip) { m_skip_files = skip; }
+        void skipDirectories(bool skip) { m_skip_dirs = skip; }
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Should entries beginning with '.' be ignored. Hidden
+         *  directories are not traversed.
+        **/
+        /////////////////////////////////////////////////////////////
+        void skipHidden(bool skip) { m_skip_hidden = skip; }
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Sets the glob pattern files names must match.
+         *  '*' matches any characters, '?' one character. An empty
+         *  pattern matches every file.
+        **/
+        /////////////////////////////////////////////////////////////
+        void setPattern(const String& pattern) { m_pattern = pattern; }
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Adds an extension, without '.', files may have.
+         *  Extensions are compared without case. If none is added,
+         *  every extension is accepted.
+        **/
+        /////////////////////////////////////////////////////////////
+        void addExtension(const String& extension);
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Removes every extension added.
+        **/
+        /////////////////////////////////////////////////////////////
+        void clearExtensions() { Array<String>().swap(m_extensions); }
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Sets the number of threads scanning. 1 scans in
+         *  the calling thread only.
+        **/
+        /////////////////////////////////////////////////////////////
+        void setThreads(size_t threads) { m_threads = threads ? threads : 1; }
+        size_t getThreads() const { return m_threads; }
+
+    public:
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Lists the entries of given directory.
+         *  @return Entries found, empty if the directory can't be
+         *  opened.
+        **/
+        /////////////////////////////////////////////////////////////
+        Array<Entry> scan(const Path& directory) const;
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Appends the entries of given directory to given
+         *  Array.
+         *  @return Number of entries appended.
+        **/
+        /////////////////////////////////////////////////////////////
+        size_t scan(const Path& directory, Array<Entry>& entries) const;
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Returns true if given name matches given glob
+         *  pattern.
+        **/
+        /////////////////////////////////////////////////////////////
+        static bool Match(const StringView& pattern, const StringView& name);
+
+    public:
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Lists one directory : accepted entries are appended
+         *  to entries, and subdirectories to traverse to
+         *  directories.
+         *  @note Used by the scanning threads.
+        **/
+        /////////////////////////////////////////////////////////////
+        void scanOne(const Path& directory, Array<Entry>& entries, Array<Path>& directories) const;
+
+    private:
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Appends given entry if it is accepted, and queues
+         *  it if it must be traversed.
+        **/
+        /////////////////////////////////////////////////////////////
+        void addEntry(const Path& directory, const char* name, EntryType type, Id ino,
+                      Array<Entry>& entries, Array<Path>& directories) const;
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Returns true if given file name passes the pattern
+         *  and extension filters.
+        **/
+        /////////////////////////////////////////////////////////////
+        bool acceptsFile(const StringView& name) const;
+    };
+}
+
+#endif // APRO_DIRECTORYSCANNER_H
@@ -36,6 +36,7 @@
 #include "Event.h"
 #include "EventListener.h"
 #include "ThreadSafe.h"
+#include "Atom.h"
 
 namespace APro
 {
@@ -291,6 +292,15 @@ namespace APro
         /////////////////////////////////////////////////////////////
         bool isEventHandled(const HashType& event) const;
 
+        /////////////////////////////////////////////////////////////
+        /** @brief Tell if event is handled.
+         *
+         *  The Atom hash is the same as the event type Hash, so
+         *  Atom(TOTEXT(MyEvent)) can be given here.
+        **/
+        /////////////////////////////////////////////////////////////
+        bool isEventHandled(const Atom& event) const;
+
     public:
     	
     	/////////////////////////////////////////////////////////////
@@ -365,6 +375,13 @@ namespace APro
         /////////////////////////////////////////////////////////////
         int unregisterListener(const Id& id);
 
+        /////////////////////////////////////////////////////////////
+        /** @brief Unregister listener.
+         *  @see unregisterListener(const String&)
+        **/
+        /////////////////////////////////////////////////////////////
+        int unregisterListener(const Atom& name);
+
         /////////////////////////////////////////////////////////////
         /** @brief Return listener from his name, registered in this
          *  emitter.
@@ -400,6 +417,23 @@ namespace APro
         /////////////////////////////////////////////////////////////
         EventListenerPtr& getListener(const Id& identifier);
 
+        /////////////////////////////////////////////////////////////
+        /** @brief Return listener from his interned name, registered
+         *  in this emitter.
+         *
+         *  @note Listeners are compared using their own Atom, so
+         *  no String comparison is done.
+        **/
+        /////////////////////////////////////////////////////////////
+        const EventListenerPtr& getListener(const Atom& name) const;
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Return listener from his interned name, registered
+         *  in this emitter.
+        **/
+        /////////////////////////////////////////////////////////////
+        EventListenerPtr& getListener(const Atom& name);
+
     protected:
 
         /////////////////////////////////////////////////////////////
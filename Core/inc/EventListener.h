@@ -36,6 +36,7 @@
 #include "AutoPointer.h"
 #include "Event.h"
 #include "Array.h"
+#include "Atom.h"
 
 namespace APro
 {
@@ -78,6 +79,7 @@ namespace APro
     protected:
 
         String          m_name;         ///< @brief Name of the listener.
+        Atom            m_atom;         ///< @brief Interned name of the listener, used for quick lookups.
         Id              id;             ///< @brief Id of this listener.
         EventCopy*      last_event;     ///< @brief Last event received by this listener.
         HashArray       eventprocessed; ///< @brief List of event normally processed by this listener.
@@ -149,6 +151,12 @@ namespace APro
         /////////////////////////////////////////////////////////////
         const String& getName() const;
 
+        /////////////////////////////////////////////////////////////
+        /** @brief Return the interned name of this listener.
+        **/
+        /////////////////////////////////////////////////////////////
+        const Atom& getAtom() const;
+
         /////////////////////////////////////////////////////////////
         /** @brief Return the last event received by this listener.
         **/
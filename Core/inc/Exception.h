@@ -128,9 +128,9 @@ namespace APro
 
 #else
 
-#define aprothrow
-#define aprothrow_ce
-#define APRO_MAKE_EXCEPTION
+#define aprothrow(Except) ((void) 0)
+#define aprothrow_ce(msg) ((void) 0)
+#define APRO_MAKE_EXCEPTION(class)
 
 namespace APro
 {
@@ -17,6 +17,8 @@
 #include "Platform.h"
 #include "SString.h"
 #include "AutoPointer.h"
+#include "FileMapping.h"
+#include "AsyncIO.h"
 
 #include "Path.h"
 #include "Directory.h"
@@ -110,6 +112,53 @@ namespace APro
             return read(reinterpret_cast<Byte*>(&buffer), sizeof(buffer));
         }
 
+        ////////////////////////////////////////////////////////////
+        /** @brief Read at most sz Bytes from opened file.
+         *  @return The number of Bytes read, which is less than sz
+         *  only at the end of the file.
+        **/
+        ////////////////////////////////////////////////////////////
+        size_t readSome(Byte* buffer, size_t sz);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Maps the whole content of the opened file in
+         *  memory, read-only.
+         *
+         *  Pending writes are flushed first. The mapping does not use
+         *  nor move the cursor, and stays valid after the file is
+         *  closed.
+         *  @return An invalid FileMapping if the file is not opened
+         *  or can't be mapped.
+        **/
+        ////////////////////////////////////////////////////////////
+        FileMapping map(FileMapping::Advice advice = FileMapping::Sequential);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Reads sz Bytes at given position, without blocking
+         *  the calling thread.
+         *
+         *  The read is served by the AsyncIO service. It does not use
+         *  nor move the cursor. The buffer must stay valid, and the
+         *  file opened, until the read is done.
+         *  @param callback : Called by an I/O thread when done.
+         *  @return A future to wait for the read.
+        **/
+        ////////////////////////////////////////////////////////////
+        IOFuture readAsync(Offset offset, Byte* buffer, size_t sz, const IOCallback& callback = IOCallback());
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Writes sz Bytes at given position, without blocking
+         *  the calling thread.
+         *
+         *  Pending writes are flushed first. The write does not use
+         *  nor move the cursor. The bytes must stay valid, and the
+         *  file opened, until the write is done.
+         *  @param callback : Called by an I/O thread when done.
+         *  @return A future to wait for the write.
+        **/
+        ////////////////////////////////////////////////////////////
+        IOFuture writeAsync(Offset offset, const Byte* bytes, size_t sz, const IOCallback& callback = IOCallback());
+
     public:
 
         ////////////////////////////////////////////////////////////
@@ -244,6 +293,15 @@ namespace APro
         
         void readbom ();
         void writebom ();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the system handle used by positional
+         *  reads and writes, or an invalid one if not opened.
+        **/
+        ////////////////////////////////////////////////////////////
+        IOHandle getIOHandle() const;
+
+        friend class BatchedOutputStream;
         
     public:
 
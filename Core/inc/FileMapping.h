@@ -0,0 +1,148 @@
+/////////////////////////////////////////////////////////////
+/** @file FileMapping.h
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the FileMapping class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_FILEMAPPING_H
+#define APRO_FILEMAPPING_H
+
+#include "Platform.h"
+#include "NonCopyable.h"
+#include "StringView.h"
+
+namespace APro
+{
+    ////////////////////////////////////////////////////////////
+    /** @class FileMapping
+     *  @ingroup Utils
+     *  @brief A read-only view on the content of a File, mapped in
+     *  memory by the system.
+     *
+     *  Bytes are loaded by the system only when they are read, and
+     *  the pages are shared with every process mapping the same
+     *  file. Reading from a FileMapping never copies the content.
+     *  @code
+     *  File file("data/big.txt", "rb");
+     *  FileMapping mapping = file.map(FileMapping::Sequential);
+     *  StringView text = mapping.view();
+     *  @endcode
+     *
+     *  A FileMapping stays valid after its File is closed. It is
+     *  released when destroyed.
+     *
+     *  @note An empty file gives a valid FileMapping of size 0.
+     *  @warning The mapped file must not be truncated while mapped.
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL FileMapping : public NonCopyable
+    {
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Tells the system how the mapping will be read, so
+         *  it can read ahead or not.
+        **/
+        ////////////////////////////////////////////////////////////
+        enum Advice
+        {
+            Normal     = 0,///< No particular access pattern.
+            Sequential = 1,///< Read from the beginning to the end : pages are read ahead.
+            Random     = 2,///< Read in random order : pages are not read ahead.
+            WillNeed   = 3 ///< The whole mapping will be read soon : it is loaded now.
+        };
+
+    private:
+
+        const Byte* m_data;   ///< Mapped bytes, or null.
+        size_t      m_size;   ///< Number of mapped bytes.
+        bool        m_valid;  ///< True if mapping succeeded.
+#if APRO_PLATFORM == APRO_WINDOWS
+        HANDLE      m_handle; ///< File mapping object.
+#endif
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Constructs an invalid mapping.
+        **/
+        ////////////////////////////////////////////////////////////
+        FileMapping();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Takes the mapping of another object, which becomes
+         *  invalid.
+        **/
+        ////////////////////////////////////////////////////////////
+        FileMapping(FileMapping&& rhs);
+        FileMapping& operator = (FileMapping&& rhs);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Unmaps the file.
+        **/
+        ////////////////////////////////////////////////////////////
+        ~FileMapping();
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Maps the whole file opened with given stdio handle.
+         *  @return False if the system could not map the file.
+         *  @see File::map()
+        **/
+        ////////////////////////////////////////////////////////////
+        bool map(FILE* file, Advice advice = Normal);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Unmaps the file, if mapped.
+        **/
+        ////////////////////////////////////////////////////////////
+        void unmap();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Changes the access advice of the whole mapping.
+        **/
+        ////////////////////////////////////////////////////////////
+        void advise(Advice advice);
+
+    public:
+
+        bool isValid() const { return m_valid; }
+
+        const Byte* data() const { return m_data; }
+        size_t size() const { return m_size; }
+
+        const Byte* begin() const { return m_data; }
+        const Byte* end() const { return m_data + m_size; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the mapped bytes as characters.
+        **/
+        ////////////////////////////////////////////////////////////
+        StringView view() const { return m_size ? StringView((const char*) m_data, m_size) : StringView(); }
+    };
+}
+
+#endif // APRO_FILEMAPPING_H
@@ -0,0 +1,246 @@
+/////////////////////////////////////////////////////////////
+/** @file FileStatCache.h
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the FileStatCache class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_FILESTATCACHE_H
+#define APRO_FILESTATCACHE_H
+
+#include "Platform.h"
+#include "NonCopyable.h"
+#include "Singleton.h"
+#include "SString.h"
+#include "Array.h"
+#include "QuickMap.h"
+#include "ThreadMutexI.h"
+
+#include <chrono>
+
+namespace APro
+{
+    ////////////////////////////////////////////////////////////
+    /** @struct FileStat
+     *  @ingroup Utils
+     *  @brief What the FileStatCache knows about a path.
+    **/
+    ////////////////////////////////////////////////////////////
+    struct FileStat
+    {
+        bool exists;   ///< True if the path exists.
+        bool directory;///< True if the path is a directory.
+    };
+
+    ////////////////////////////////////////////////////////////
+    /** @class FileStatCache
+     *  @ingroup Utils
+     *  @brief Remembers which paths exist, and which are
+     *  directories, so FileSystem::Exists(), IsFile(),
+     *  IsDirectory() and GetAbsolutePath() don't call the system
+     *  each time.
+     *
+     *  The cache is disabled by default. Once enabled, FileSystem
+     *  uses it. Paths are normalized ('//' and '/./' removed, no
+     *  trailing separator) before being looked up.
+     *
+     *  An entry stays valid for getTTL() milliseconds. On Linux,
+     *  the directory holding a cached path is also watched with
+     *  inotify : a change in it invalidates the changed entry at
+     *  once, and entries of watched directories stay valid for the
+     *  longer getWatchedTTL().
+     *
+     *  @note Only the directory holding a path is watched. Renaming
+     *  or replacing one of its ancestors is not seen : its entries
+     *  stay until getWatchedTTL() expires, or until invalidate() or
+     *  invalidateAll() is called.
+     *  @code
+     *  FileStatCache::Get().setEnabled(true);
+     *  FileStatCache::Get().prefetch("media/textures");
+     *  if(FileSystem::IsFile("media/textures/wood.png")) ...
+     *  @endcode
+     *
+     *  @note prefetch() caches a whole directory with one listing,
+     *  without stat'ing each entry.
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL FileStatCache : public NonCopyable
+    {
+        APRO_DECLARE_SINGLETON(FileStatCache)
+
+    public:
+
+        static const unsigned DefaultTTL        = 2000; ///< @brief Default lifetime of an entry, in milliseconds.
+        static const unsigned DefaultWatchedTTL = 30000;///< @brief Default lifetime of an entry of a watched directory, in milliseconds.
+
+    private:
+
+        typedef std::chrono::steady_clock Clock;
+
+        struct CachedStat
+        {
+            FileStat          stat;   ///< Cached result.
+            bool              watched;///< True if its directory is watched.
+            Clock::time_point time;   ///< When it was cached.
+        };
+
+        struct CachedPath
+        {
+            String            path;///< Cached absolute path.
+            Clock::time_point time;///< When it was cached.
+        };
+
+        QuickMap<String, CachedStat>  m_stats;    ///< Cached stats, by normalized path.
+        QuickMap<String, CachedPath>  m_absolutes;///< Cached absolute paths, by path.
+        QuickMap<String, int>         m_watched;  ///< Watch descriptor of watched directories.
+        QuickMap<int, Array<String> > m_watches;  ///< Watched directories of watch descriptors.
+        ThreadMutexI                  m_mutex;    ///< Protects the cache.
+        bool                          m_enabled;  ///< True if FileSystem uses the cache.
+        unsigned                      m_ttl;      ///< Lifetime of an entry, in milliseconds.
+        unsigned                      m_watched_ttl;///< Lifetime of an entry of a watched directory, in milliseconds.
+        int                           m_inotify;  ///< inotify descriptor, or -1.
+
+    public:
+
+        FileStatCache();
+        ~FileStatCache();
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Enables or disables the cache. Disabling it
+         *  empties it.
+        **/
+        ////////////////////////////////////////////////////////////
+        void setEnabled(bool enabled);
+
+        bool isEnabled() const { return m_enabled; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Sets the lifetime of entries not watched, in
+         *  milliseconds. 0 keeps them until invalidated.
+        **/
+        ////////////////////////////////////////////////////////////
+        void setTTL(unsigned ttl) { m_ttl = ttl; }
+
+        unsigned getTTL() const { return m_ttl; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Sets the lifetime of entries of watched
+         *  directories, in milliseconds. 0 keeps them until a change
+         *  is seen.
+        **/
+        ////////////////////////////////////////////////////////////
+        void setWatchedTTL(unsigned ttl) { m_watched_ttl = ttl; }
+
+        unsigned getWatchedTTL() const { return m_watched_ttl; }
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns what is known about given path, asking
+         *  the system if it is not cached.
+        **/
+        ////////////////////////////////////////////////////////////
+        FileStat stat(const String& path);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the absolute path of given path, resolved
+         *  by the system if it is not cached.
+         *  @return An empty string if the path does not exist.
+        **/
+        ////////////////////////////////////////////////////////////
+        String getAbsolutePath(const String& path);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Caches the directory and every entry in it, with
+         *  one listing.
+         *  @param recursive : True to cache subdirectories too.
+         *  @return Number of entries cached.
+        **/
+        ////////////////////////////////////////////////////////////
+        size_t prefetch(const String& directory, bool recursive = false);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Forgets given path.
+         *  @note The absolute paths are all forgotten.
+        **/
+        ////////////////////////////////////////////////////////////
+        void invalidate(const String& path);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Forgets every path, and stops watching every
+         *  directory. Called when the working directory changes.
+        **/
+        ////////////////////////////////////////////////////////////
+        void invalidateAll();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns given path without '//', '/./' and
+         *  trailing separator.
+        **/
+        ////////////////////////////////////////////////////////////
+        static String Normalize(const String& path);
+
+    private:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns true if given entry can be used.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool isFresh(bool watched, const Clock::time_point& time) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Stores given stat.
+         *  @note Lock must be held.
+        **/
+        ////////////////////////////////////////////////////////////
+        void store(const String& normalized, const FileStat& st);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Watches given directory, if not already watched.
+         *  @return True if the directory is watched.
+         *  @note Lock must be held.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool watch(const String& directory);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Reads pending inotify events, and forgets the
+         *  changed entries.
+         *  @note Lock must be held.
+        **/
+        ////////////////////////////////////////////////////////////
+        void readEvents();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Forgets every entry, and every watch.
+         *  @note Lock must be held.
+        **/
+        ////////////////////////////////////////////////////////////
+        void clear();
+    };
+}
+
+#endif // APRO_FILESTATCACHE_H
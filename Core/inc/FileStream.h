@@ -16,6 +16,7 @@
 
 #include "StreamInterface.h"
 #include "File.h"
+#include "FileMapping.h"
 
 #include "UTF8String.h"
 
@@ -29,16 +30,45 @@ namespace APro
      *  Use this stream to interact easily with already opened
      *  File. No-opened files will always be wrong.
      *
+     *  Reading and writing are buffered : the File is read by
+     *  blocks of getBufferSize() bytes, and words, lines or numbers
+     *  are scanned directly in the read buffer. Written data is
+     *  kept until the write buffer is full, flush() is called,
+     *  the cursor is moved or the stream is destroyed. tell() and
+     *  seek() take both buffers into account.
+     *
+     *  With map(), the File is read from a FileMapping instead,
+     *  without any copy : this is the best way to parse big files.
+     *  Writing to a mapped stream goes back to the buffered mode.
+     *
+     *  @note Flush the stream before using its File directly, or
+     *  from another FileStream.
+     *
      *  @sa InputStream, OutputStream, File
     **/
     /////////////////////////////////////////////////////////////
     class FileStream : public InputStream,
                        public OutputStream
     {
+    public:
+
+        static const size_t DefaultBufferSize = 64 * 1024;///< Default size of the read and write buffers.
+
     protected:
 
         FilePtr m_file;
 
+        ByteArray   m_read_buffer; ///< Bytes read from the File and not yet used.
+        const Byte* m_read_data;   ///< Bytes being read : m_read_buffer, or the mapping.
+        size_t      m_read_pos;    ///< Next byte to use in m_read_data.
+        size_t      m_read_end;    ///< Number of valid bytes in m_read_data.
+        FileMapping m_mapping;     ///< Mapping of the File, if map() was called.
+
+        ByteArray m_write_buffer;///< Bytes not yet written to the File.
+        size_t    m_write_size;  ///< Number of bytes in m_write_buffer.
+
+        size_t    m_buffer_size; ///< Size of each buffer.
+
     public:
 
         /////////////////////////////////////////////////////////////
@@ -66,7 +96,8 @@ namespace APro
 
         /////////////////////////////////////////////////////////////
         /** @brief Destructs the Stream.
-         *  @note It doesn't close the file object.
+         *  @note It doesn't close the file object, but flushes the
+         *  write buffer.
         **/
         /////////////////////////////////////////////////////////////
         ~FileStream();
@@ -99,6 +130,38 @@ namespace APro
         /////////////////////////////////////////////////////////////
         FilePtr& toFilePtr();
 
+        /////////////////////////////////////////////////////////////
+        /** @brief Writes the write buffer to the File, and moves the
+         *  File cursor back to the stream position if some bytes were
+         *  read in advance.
+         *  @return False if writing failed.
+        **/
+        /////////////////////////////////////////////////////////////
+        bool flush();
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Changes the size of the read and write buffers.
+         *
+         *  The stream is flushed first. A size of 1 disables
+         *  buffering.
+        **/
+        /////////////////////////////////////////////////////////////
+        void setBufferSize(size_t sz);
+
+        size_t getBufferSize() const { return m_buffer_size; }
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Reads the File from a read-only mapping, from the
+         *  current position.
+         *  @return False if the File can't be mapped : the stream is
+         *  still usable with its buffers.
+         *  @see File::map()
+        **/
+        /////////////////////////////////////////////////////////////
+        bool map(FileMapping::Advice advice = FileMapping::Sequential);
+
+        bool isMapped() const { return m_mapping.isValid(); }
+
     public:
 
         // Copied from InputStream
@@ -129,12 +192,16 @@ namespace APro
 
         /////////////////////////////////////////////////////////////
         /** @brief Reads a Real number.
+         *  @return False if the stream does not continue with a
+         *  number.
         **/
         /////////////////////////////////////////////////////////////
         bool readReal(Real& r);
 
         /////////////////////////////////////////////////////////////
         /** @brief Reads an Integer.
+         *  @return False if the stream does not continue with an
+         *  integer.
         **/
         /////////////////////////////////////////////////////////////
         bool readInt(int& i);
@@ -184,6 +251,15 @@ namespace APro
         /////////////////////////////////////////////////////////////
         int skipBlanck(char& c);
 
+        /////////////////////////////////////////////////////////////
+        /** @brief Reads at most sz raw bytes.
+         *
+         *  Blocks bigger than the read buffer are read directly from
+         *  the File.
+        **/
+        /////////////////////////////////////////////////////////////
+        size_t readBytes(Byte* bytes, size_t sz);
+
     public:
 
         // Copied from OutputStream
@@ -218,6 +294,12 @@ namespace APro
         /////////////////////////////////////////////////////////////
         bool write(const UTF8String& str);
 
+        /////////////////////////////////////////////////////////////
+        /** @brief Writes raw bytes through the write buffer.
+        **/
+        /////////////////////////////////////////////////////////////
+        bool writeBytes(const Byte* bytes, size_t sz);
+
     public:
 
         // Copied from CursorStream
@@ -240,6 +322,30 @@ namespace APro
         **/
         /////////////////////////////////////////////////////////////
         void seek(size_t pos, CursorPosition cp = CP_BEGIN);
+
+    private:
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Refills the read buffer from the File.
+         *  @return False if no more bytes can be read.
+        **/
+        /////////////////////////////////////////////////////////////
+        bool fillReadBuffer();
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Appends to str the bytes accepted by given table,
+         *  and skips the first refused byte.
+         *  @return False if the end of the File was reached first.
+        **/
+        /////////////////////////////////////////////////////////////
+        bool readSpan(String& str, const bool* accepted);
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Drops the read buffer, moving the File cursor back
+         *  to the stream position.
+        **/
+        /////////////////////////////////////////////////////////////
+        void dropReadBuffer();
     };
 }
 
@@ -34,6 +34,7 @@
 
 #include "SString.h"
 #include "File.h"
+#include "Array.h"
 
 namespace APro
 {
@@ -79,7 +80,7 @@ namespace APro
         /** @brief Returns true if path has extension.
         **/
         /////////////////////////////////////////////////////////////
-        static bool HasExtension(const String& path);
+        static bool HasExtension(const StringView& path);
 
     public:
 
@@ -93,13 +94,29 @@ namespace APro
         /** @brief Extract Filename from path.
         **/
         /////////////////////////////////////////////////////////////
-        static String ExtractFilename(const String& path);
+        static String ExtractFilename(const StringView& path);
 
         /////////////////////////////////////////////////////////////
         /** @brief Extract Extension from path.
         **/
         /////////////////////////////////////////////////////////////
-        static String ExtractExtension(const String& path);
+        static String ExtractExtension(const StringView& path);
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Returns a view on the Filename of path, without
+         *  copying it.
+         *  @warning The view is only valid as long as path is.
+        **/
+        /////////////////////////////////////////////////////////////
+        static StringView ExtractFilenameView(const StringView& path);
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Returns a view on the Extension of path (with its
+         *  '.'), without copying it.
+         *  @warning The view is only valid as long as path is.
+        **/
+        /////////////////////////////////////////////////////////////
+        static StringView ExtractExtensionView(const StringView& path);
 
     public:
 
@@ -145,12 +162,28 @@ namespace APro
 
         /////////////////////////////////////////////////////////////
         /** @brief Copy file given from to file to.
+         *
+         *  On Linux, the copy is done by the kernel : the file is
+         *  cloned if the file system supports it (FICLONE), else
+         *  copied with copy_file_range() or sendfile(). Contents
+         *  never go through user space unless those are not
+         *  supported.
+         *
          *  @param failIfExists : If file already exists, does the
          *  function fail (true) or overwrite it (false).
         **/
         /////////////////////////////////////////////////////////////
         static bool CopyFile(const String& from, const String& to, bool failIfExists = true);
 
+        /////////////////////////////////////////////////////////////
+        /** @brief Copy each file of from to the file of same index in
+         *  to, using several threads.
+         *  @param threads : Number of files copied at the same time.
+         *  @return Number of files copied.
+        **/
+        /////////////////////////////////////////////////////////////
+        static size_t CopyFiles(const Array<String>& from, const Array<String>& to, bool failIfExists = true, size_t threads = 4);
+
     public:
 
         /////////////////////////////////////////////////////////////
@@ -0,0 +1,91 @@
+/////////////////////////////////////////////////////////////
+/** @file LZCodec.h
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the LZCodec functions.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_LZCODEC_H
+#define APRO_LZCODEC_H
+
+#include "Platform.h"
+
+namespace APro
+{
+    ////////////////////////////////////////////////////////////
+    /** @namespace LZCodec
+     *  @ingroup Utils
+     *  @brief Fast LZ77 compression of memory blocks.
+     *
+     *  Blocks use the LZ4 block format : a sequence of literals
+     *  followed by a copy of at least 4 bytes, found up to 64 KB
+     *  before. The compressor finds copies with a hash table of
+     *  4 bytes sequences, and the decompressor copies 8 or 16 bytes
+     *  at once, so it runs at memory speed.
+     *  @code
+     *  Byte* packed = (Byte*) AProAllocate(LZCodec::CompressBound(sz));
+     *  size_t psz = LZCodec::Compress(data, sz, packed, LZCodec::CompressBound(sz));
+     *  @endcode
+     *
+     *  The size of the decompressed data is not stored in a block :
+     *  it must be stored beside. CompressedOutputStream and
+     *  DecompressingInputStream split a stream in blocks.
+     *
+     *  @note Decompression checks every offset and length, so a
+     *  corrupted block is refused, never read or written out of
+     *  its buffers.
+    **/
+    ////////////////////////////////////////////////////////////
+    namespace LZCodec
+    {
+        const size_t MaxOffset = 65535;///< @brief Maximum distance of a copy.
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the maximum size of a compressed block
+         *  of sz bytes.
+        **/
+        ////////////////////////////////////////////////////////////
+        inline size_t CompressBound(size_t sz) { return sz + sz / 255 + 16; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Compresses sz bytes of src to dst.
+         *  @return The size of the compressed block, or 0 if it does
+         *  not fit in capacity bytes. Compression can't fail with
+         *  CompressBound(sz) bytes.
+        **/
+        ////////////////////////////////////////////////////////////
+        APRO_DLL size_t Compress(const Byte* src, size_t sz, Byte* dst, size_t capacity);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Decompresses the block of sz bytes src to dst.
+         *  @param written : Set to the number of bytes decompressed.
+         *  @return False if the block is corrupted, or does not fit
+         *  in capacity bytes.
+        **/
+        ////////////////////////////////////////////////////////////
+        APRO_DLL bool Decompress(const Byte* src, size_t sz, Byte* dst, size_t capacity, size_t& written);
+    }
+}
+
+#endif // APRO_LZCODEC_H
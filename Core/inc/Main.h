@@ -36,6 +36,7 @@
 #include "Singleton.h"
 #include "Console.h"
 #include "RenderingAPI.h"
+#include "CheckSumFactory.h"
 #include "IdGenerator.h"
 #include "PointerCollector.h"
 #include "Console.h"
@@ -238,6 +239,16 @@ namespace APro
             return *abstract_object_factory;
         }
 
+        const CheckSumFactory& getCheckSumFactory() const
+        {
+            return *checksumfactory;
+        }
+
+        CheckSumFactory& getCheckSumFactory()
+        {
+            return *checksumfactory;
+        }
+
     private:
         // In activation order ! Don't change
 
@@ -259,6 +270,9 @@ namespace APro
         /* RenderingAPI Factory. Needs only the Manager, wich needs
         ThreadSafe and AutoPointer. */
         RenderingAPIFactory* rendererfactory;
+        /* CheckSum Factory. Needs only the Manager, wich needs
+        ThreadSafe and AutoPointer. */
+        CheckSumFactory* checksumfactory;
 
         // EventUniter
         /* 5. The EventUniter. Needs Thread implementation but no ThreadManager.
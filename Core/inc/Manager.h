@@ -50,7 +50,7 @@ namespace APro
     **/
     ////////////////////////////////////////////////////////////
     template<typename T, typename Container = List<AutoPointer<T> > >
-    class Manager : public ThreadSafe
+    class Manager : virtual public ThreadSafe
     {
     public:
 
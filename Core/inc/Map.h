@@ -518,14 +518,17 @@ namespace APro
             if(newn)
             {
                 if(m_root == nullptr)
-                    m_root == newn;
+                {
+                    m_root = newn;
+                    m_sz++;
+                }
 
                 else
                 {
                     Node* n = m_root;
                     while(1)
                     {
-                        if(cmp(k, *(m_root->m_key)))
+                        if(cmp(k, *(n->m_key)))
                         {
                             if(n->m_left == nullptr)
                             {
@@ -537,7 +540,7 @@ namespace APro
                                 n = n->m_left;
                             }
                         }
-                        else if(cmp(*(m_root->m_key), k))
+                        else if(cmp(*(n->m_key), k))
                         {
                             if(n->m_right == nullptr)
                             {
@@ -0,0 +1,209 @@
+/////////////////////////////////////////////////////////////
+/** @file MemoryStream.h
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the MemoryStream class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_MEMORYSTREAM_H
+#define APRO_MEMORYSTREAM_H
+
+#include "StreamInterface.h"
+#include "NonCopyable.h"
+#include "StringView.h"
+
+namespace APro
+{
+    /////////////////////////////////////////////////////////////
+    /** @class MemoryStream
+     *  @ingroup Utils
+     *  @brief A stream reading and writing bytes in memory.
+     *
+     *  The bytes are either owned by the stream, in a buffer which
+     *  grows when writing past its end, or borrowed from the caller
+     *  : a read-only span, or a writable block of fixed capacity.
+     *  Borrowed bytes are never copied, so data already in memory
+     *  (a FileMapping, a decompressed block) can be parsed in
+     *  place.
+     *  @code
+     *  MemoryStream stream(mapping.view());
+     *  String word;
+     *  while(stream.readWord(word)) { ... }
+     *  @endcode
+     *
+     *  The text readers behave as the FileStream ones, so loaders
+     *  can use both. seek() and tell() are O(1).
+     *
+     *  @sa InputStream, OutputStream, FileStream
+    **/
+    /////////////////////////////////////////////////////////////
+    class APRO_DLL MemoryStream : public InputStream,
+                                  public OutputStream,
+                                  public NonCopyable
+    {
+    private:
+
+        Byte*  m_data;    ///< Bytes of the stream.
+        size_t m_size;    ///< Number of valid bytes.
+        size_t m_capacity;///< Number of bytes available in m_data.
+        size_t m_pos;     ///< Position of the cursor.
+        bool   m_owned;   ///< True if m_data is allocated by the stream.
+        bool   m_readonly;///< True if borrowed bytes can't be written.
+
+    public:
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Constructs an empty stream, owning its bytes.
+         *  @param capacity : Number of bytes to allocate now.
+        **/
+        /////////////////////////////////////////////////////////////
+        explicit MemoryStream(size_t capacity = 0);
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Constructs a read-only stream on given bytes.
+         *  The bytes must live longer than the stream.
+        **/
+        /////////////////////////////////////////////////////////////
+        MemoryStream(const Byte* data, size_t sz);
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Constructs a read-only stream on given characters.
+         *  The characters must live longer than the stream.
+        **/
+        /////////////////////////////////////////////////////////////
+        explicit MemoryStream(const StringView& text);
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Constructs a stream writing in given block.
+         *
+         *  The block does not grow : writing past capacity fails.
+         *  @param sz : Number of valid bytes already in the block.
+        **/
+        /////////////////////////////////////////////////////////////
+        MemoryStream(Byte* data, size_t capacity, size_t sz);
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Destructs the stream, releasing owned bytes.
+        **/
+        /////////////////////////////////////////////////////////////
+        ~MemoryStream();
+
+    public:
+
+        const Byte* data() const { return m_data; }
+        size_t getCapacity() const { return m_capacity; }
+        bool isOwning() const { return m_owned; }
+        bool isReadOnly() const { return m_readonly; }
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Returns every byte of the stream, as characters.
+        **/
+        /////////////////////////////////////////////////////////////
+        StringView view() const { return m_size ? StringView((const char*) m_data, m_size) : StringView(); }
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Returns the bytes following the cursor, as
+         *  characters.
+        **/
+        /////////////////////////////////////////////////////////////
+        StringView remaining() const { return m_pos < m_size ? StringView((const char*) m_data + m_pos, m_size - m_pos) : StringView(); }
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Makes room for sz bytes, if the stream owns its
+         *  bytes.
+         *  @return False if the stream can't hold sz bytes.
+        **/
+        /////////////////////////////////////////////////////////////
+        bool reserve(size_t sz);
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Empties the stream, keeping its capacity.
+        **/
+        /////////////////////////////////////////////////////////////
+        void clear();
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Writes sz bytes at the cursor, left for the caller
+         *  to fill, so a decoder can write directly in the stream.
+         *  @return The bytes to fill, or null if the stream can't
+         *  hold them.
+        **/
+        /////////////////////////////////////////////////////////////
+        Byte* writeInPlace(size_t sz);
+
+    public:
+
+        // Copied from InputStream
+
+        bool readChar(char& to);
+        bool readWord(String& str);
+        bool readLine(String& str);
+        bool readUntill(String& str, ByteArray clist);
+        bool readReal(Real& r);
+        bool readInt(int& i);
+        size_t readBytes(Byte* bytes, size_t sz);
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Reads blanck characters to the next non-blanck
+         *  one.
+         *  @see FileStream::skipBlanck()
+        **/
+        /////////////////////////////////////////////////////////////
+        int skipBlanck(char& c);
+
+    public:
+
+        // Copied from OutputStream
+
+        bool write(const String& str);
+        bool write(const Real& str);
+        bool write(const int& str);
+        bool writeBytes(const Byte* bytes, size_t sz);
+
+    public:
+
+        // Copied from CursorStream
+
+        bool isEOS() const { return m_pos >= m_size; }
+        size_t tell() const { return m_pos; }
+        size_t size() { return m_size; }
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Moves the cursor. It stays between 0 and size().
+        **/
+        /////////////////////////////////////////////////////////////
+        void seek(size_t pos, CursorPosition cp = CP_BEGIN);
+
+    private:
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Appends to str the bytes accepted by given table,
+         *  and skips the first refused byte.
+        **/
+        /////////////////////////////////////////////////////////////
+        void readSpan(String& str, const bool* accepted);
+    };
+}
+
+#endif // APRO_MEMORYSTREAM_H
@@ -27,6 +27,10 @@ namespace APro
      *
      *  Subclass this class and overwrite the function isNameUsed()
      *  as you want to create names that are not used.
+     *
+     *  Copies are numbered from getFirstCopy(). A subclass which
+     *  remembers the last number given by onCopyGenerated() finds a
+     *  free name at once, instead of trying every used number.
     **/
     ////////////////////////////////////////////////////////////
     class NameCopyGenerator
@@ -51,6 +55,20 @@ namespace APro
         **/
         /////////////////////////////////////////////////////////////
         virtual bool isNameUsed(const String& name) const { return false; };
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Returns the first copy number to try for given
+         *  name.
+        **/
+        /////////////////////////////////////////////////////////////
+        virtual int getFirstCopy(const String& /* name */) { return 1; }
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Called when a copy name is generated, with its
+         *  number.
+        **/
+        /////////////////////////////////////////////////////////////
+        virtual void onCopyGenerated(const String& /* name */, int /* copy */) { }
     };
 }
 
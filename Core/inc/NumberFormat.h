@@ -0,0 +1,122 @@
+/////////////////////////////////////////////////////////////
+/** @file NumberFormat.h
+ *  @ingroup Global
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the numbers formatting and parsing functions.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_NUMBERFORMAT_H
+#define APRO_NUMBERFORMAT_H
+
+#include "Platform.h"
+
+namespace APro
+{
+    ////////////////////////////////////////////////////////////
+    /** @namespace NumberFormat
+     *  @ingroup Global
+     *  @brief Converts numbers to and from text without any
+     *  allocation.
+     *
+     *  Format functions write into a buffer given by the caller,
+     *  which must be at least MaxIntegerSize or MaxRealSize long.
+     *  No null character is written, the number of characters
+     *  written is returned.
+     *  @code
+     *  char buffer[NumberFormat::MaxRealSize];
+     *  size_t sz = NumberFormat::Format(buffer, 3.5);
+     *  String str(buffer, sz);
+     *  @endcode
+     *
+     *  Real numbers are written with the shortest representation
+     *  that reads back to the same value : 0.1 is written "0.1",
+     *  not "0.100000". The Grisu2 algorithm finds it with integers
+     *  only ; for a few values, one more digit than needed is
+     *  written.
+     *
+     *  Parse functions read a number at the beginning of a non
+     *  null-terminated block, after any white space, and return the
+     *  number of characters used, or 0 if no number could be read
+     *  (in which case result is not modified). Only the decimal
+     *  notation is accepted, with an optional sign.
+    **/
+    ////////////////////////////////////////////////////////////
+    namespace NumberFormat
+    {
+        const size_t MaxIntegerSize = 24;///< @brief Maximum characters written for an integer.
+        const size_t MaxRealSize    = 32;///< @brief Maximum characters written for a real.
+
+        ////////////////////////////////////////////////////////////
+        /** @{
+         *  @brief Writes given integer in buffer and returns the
+         *  number of characters written.
+        **/
+        ////////////////////////////////////////////////////////////
+        APRO_DLL size_t Format(char* buffer, int32_t value);
+        APRO_DLL size_t Format(char* buffer, uint32_t value);
+        APRO_DLL size_t Format(char* buffer, int64_t value);
+        APRO_DLL size_t Format(char* buffer, uint64_t value);
+        /** @} */
+
+        ////////////////////////////////////////////////////////////
+        /** @{
+         *  @brief Writes the shortest representation of given real
+         *  in buffer and returns the number of characters written.
+         *
+         *  Integral values are written without decimals nor
+         *  exponent, "nan" and "inf" are written for special values.
+        **/
+        ////////////////////////////////////////////////////////////
+        APRO_DLL size_t Format(char* buffer, double value);
+        APRO_DLL size_t Format(char* buffer, float value);
+        /** @} */
+
+        ////////////////////////////////////////////////////////////
+        /** @{
+         *  @brief Reads an integer at the beginning of data.
+         *  @return The number of characters read, or 0 if data does
+         *  not begin with an integer or if it overflows.
+        **/
+        ////////////////////////////////////////////////////////////
+        APRO_DLL size_t Parse(const char* data, size_t sz, int32_t& result);
+        APRO_DLL size_t Parse(const char* data, size_t sz, uint32_t& result);
+        APRO_DLL size_t Parse(const char* data, size_t sz, int64_t& result);
+        APRO_DLL size_t Parse(const char* data, size_t sz, uint64_t& result);
+        /** @} */
+
+        ////////////////////////////////////////////////////////////
+        /** @{
+         *  @brief Reads a real at the beginning of data, as in
+         *  "-12.5e-3".
+         *  @return The number of characters read, or 0 if data does
+         *  not begin with a real.
+        **/
+        ////////////////////////////////////////////////////////////
+        APRO_DLL size_t Parse(const char* data, size_t sz, double& result);
+        APRO_DLL size_t Parse(const char* data, size_t sz, float& result);
+        /** @} */
+    }
+}
+
+#endif // APRO_NUMBERFORMAT_H
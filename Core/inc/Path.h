@@ -30,6 +30,7 @@ namespace APro
 
         bool exists() const;
         String getLastElement() const;
+        StringView getLastElementView() const;
     };
 }
 
@@ -219,6 +219,18 @@ namespace APro
         /////////////////////////////////////////////////////////////
         bool contains(const KeyType& key) const;
         
+        /////////////////////////////////////////////////////////////
+        /** @brief Returns a pointer to the value for given key, or
+         *  null if the Map does not contain the key.
+         *
+         *  @note
+         *  Unlike contains() followed by get(), the key is hashed
+         *  only once.
+        **/
+        /////////////////////////////////////////////////////////////
+        ValueType* find(const KeyType& key);
+        const ValueType* find(const KeyType& key) const;
+        
     private:
         
         /////////////////////////////////////////////////////////////
@@ -233,6 +245,13 @@ namespace APro
         **/
         /////////////////////////////////////////////////////////////
         int hash(const KeyType& key);
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Returns the index of the bucket holding given key.
+         *  Negative hashes are used as unsigned.
+        **/
+        /////////////////////////////////////////////////////////////
+        int bucketIndex(const KeyType& key) const { return (int) ((uint32_t) mHashFunc(key) % (uint32_t) mNumBuckets); }
         
         /////////////////////////////////////////////////////////////
         /** @brief Finds a cell in the chain that matches key.
@@ -546,6 +565,7 @@ namespace APro
         for(uint32_t i = 0; i < mNumBuckets; ++i)
         {
             deleteChain(mBuckets[i]);
+            mBuckets[i] = nullptr;
         }
         
         mNumEntries = 0;
@@ -554,9 +574,7 @@ namespace APro
     template <typename KeyType, typename ValueType>
     void QuickMap<KeyType, ValueType>::remove(const KeyType& key)
     {
-        int index = mHashFunc(key);
-        aproassert1(index > -1);
-        index = index % mNumBuckets;
+        int index = bucketIndex(key);
         
         CellT* prev = nullptr;
         CellT* cp   = mBuckets[index];
@@ -585,10 +603,9 @@ namespace APro
         aproassert1(mMaxLoadFactor > 0);
         aproassert1(mHashFunc != nullptr);
         
-        int hash = mHashFunc(key);
-        aproassert1(hash > -1);
+        uint32_t hash = (uint32_t) mHashFunc(key);
         
-        int index = hash % mNumBuckets;
+        int index = (int) (hash % (uint32_t) mNumBuckets);
         CellT* cell = findCell(mBuckets[index], key);
         
         if(cell == nullptr)
@@ -601,7 +618,7 @@ namespace APro
             }
             
             // Creating a new cell.
-            index = hash % mNumBuckets;
+            index = (int) (hash % (uint32_t) mNumBuckets);
             cell = AProNew(CellT);
             cell->key = key;
             cell->link = mBuckets[index];
@@ -617,10 +634,9 @@ namespace APro
         aproassert1(mMaxLoadFactor > 0);
         aproassert1(mHashFunc != nullptr);
         
-        int hash = mHashFunc(key);
-        aproassert1(hash > -1);
+        uint32_t hash = (uint32_t) mHashFunc(key);
         
-        int index = hash % mNumBuckets;
+        int index = (int) (hash % (uint32_t) mNumBuckets);
         CellT* cell = findCell(mBuckets[index], key);
         
         if(cell == nullptr)
@@ -633,7 +649,7 @@ namespace APro
             }
             
             // Creating a new cell.
-            index = hash % mNumBuckets;
+            index = (int) (hash % (uint32_t) mNumBuckets);
             cell = AProNew(CellT);
             cell->key = key;
             cell->link = mBuckets[index];
@@ -649,10 +665,9 @@ namespace APro
         aproassert1(mMaxLoadFactor > 0);
         aproassert1(mHashFunc != nullptr);
         
-        int hash = mHashFunc(key);
-        aproassert1(hash > -1);
+        uint32_t hash = (uint32_t) mHashFunc(key);
         
-        int index = hash % mNumBuckets;
+        int index = (int) (hash % (uint32_t) mNumBuckets);
         CellT* cell = findCell(mBuckets[index], key);
         aproassert1(cell != nullptr);
         return cell->value;
@@ -661,7 +676,7 @@ namespace APro
     template <typename KeyType, typename ValueType>
     ValueType& QuickMap<KeyType, ValueType>::get(const KeyType& key)
     {
-        CellT* cell = findCell(mBuckets[mHashFunc(key) % mNumBuckets], key);
+        CellT* cell = findCell(mBuckets[bucketIndex(key)], key);
         aproassert1(cell != nullptr);
         return cell->value;
     }
@@ -675,7 +690,20 @@ namespace APro
     template <typename KeyType, typename ValueType>
     bool QuickMap<KeyType, ValueType>::contains(const KeyType& key) const
     {
-        return (const_cast<QuickMap<KeyType, ValueType>*>(this))->findCell(mBuckets[mHashFunc(key) % mNumBuckets], key) != nullptr;
+        return (const_cast<QuickMap<KeyType, ValueType>*>(this))->findCell(mBuckets[bucketIndex(key)], key) != nullptr;
+    }
+    
+    template <typename KeyType, typename ValueType>
+    ValueType* QuickMap<KeyType, ValueType>::find(const KeyType& key)
+    {
+        CellT* cell = findCell(mBuckets[bucketIndex(key)], key);
+        return cell ? &(cell->value) : nullptr;
+    }
+    
+    template <typename KeyType, typename ValueType>
+    const ValueType* QuickMap<KeyType, ValueType>::find(const KeyType& key) const
+    {
+        return (const_cast<QuickMap<KeyType, ValueType>*>(this))->find(key);
     }
     
     template <typename KeyType, typename ValueType>
@@ -738,15 +766,17 @@ namespace APro
         // We add each cell by using the recursive method addCell().
         CellT* cur = chain;
         while(cur != nullptr) {
+            // addCell() changes the link of the cell.
+            CellT* next = cur->link;
             addCell(cur);
-            cur = cur->link;
+            cur = next;
         }
     }
     
     template <typename KeyType, typename ValueType>
     void QuickMap<KeyType, ValueType>::addCell(CellT* cell)
     {
-        int index = mHashFunc(cell->key) % mNumBuckets;
+        int index = bucketIndex(cell->key);
         cell->link = mBuckets[index];
         mBuckets[index] = cell;
     }
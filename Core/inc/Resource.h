@@ -108,6 +108,16 @@ namespace APro
         **/
         ////////////////////////////////////////////////////////////
         const String& getFilename() const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the number of bytes used by this Resource.
+         *
+         *  The ResourceManager uses it to respect its memory budget.
+         *  The default implementation only counts the object : a
+         *  Resource holding big data should return its whole size.
+        **/
+        ////////////////////////////////////////////////////////////
+        virtual size_t getMemorySize() const;
     };
 
     typedef AutoPointer<Resource> ResourcePtr;
@@ -0,0 +1,184 @@
+/////////////////////////////////////////////////////////////
+/** @file ResourceFuture.h
+ *  @ingroup Core
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the ResourceRequest and ResourceFuture classes.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_RESOURCEFUTURE_H
+#define APRO_RESOURCEFUTURE_H
+
+#include "Platform.h"
+#include "NonCopyable.h"
+#include "SString.h"
+#include "Array.h"
+#include "Resource.h"
+#include "ResourceLoader.h"
+#include "ThreadMutexI.h"
+#include "ThreadCondition.h"
+
+#include <functional>
+
+namespace APro
+{
+    class ResourceRequest;
+    class ResourceManager;
+
+    /// Called once a ResourceRequest is done.
+    typedef std::function<void (const ResourceRequest&)> ResourceCallback;
+
+    ////////////////////////////////////////////////////////////
+    /** @class ResourceRequest
+     *  @ingroup Core
+     *  @brief A resource loading queued in the ResourceManager.
+     *
+     *  Requests are shared by the manager and the ResourceFuture
+     *  objects, and destroyed when the last one releases it.
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL ResourceRequest : public NonCopyable
+    {
+    public:
+
+        String                  name;     ///< Name of the entry receiving the resource.
+        String                  filename; ///< File to load.
+        ResourceLoaderPtr       loader;   ///< Loader to use, or null for the default one.
+        ResourcePtr             resource; ///< Loaded resource, valid once done. Null on failure.
+        int                     priority; ///< Requests with a higher priority are loaded first.
+        ResourceRequest*        next;     ///< Next request in the queue.
+        bool                    done;     ///< True once the resource is published.
+        bool                    calling;  ///< True once the callbacks are being called.
+        int                     refs;     ///< Number of owners.
+        Array<ResourceCallback> callbacks;///< Called once the resource is published.
+        ThreadMutexI            mutex;    ///< Protects done, calling, callbacks and refs.
+        ThreadCondition         condition;///< Signaled once done.
+
+    public:
+
+        ResourceRequest();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Adds an owner to the request.
+        **/
+        ////////////////////////////////////////////////////////////
+        void retain();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Removes an owner, and destroys the request if it
+         *  was the last one.
+        **/
+        ////////////////////////////////////////////////////////////
+        void release();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Adds a function called once the request is done,
+         *  or calls it now if it is already.
+        **/
+        ////////////////////////////////////////////////////////////
+        void addCallback(const ResourceCallback& callback);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Stores the resource, calls the callbacks, then
+         *  wakes up the threads waiting for the request.
+        **/
+        ////////////////////////////////////////////////////////////
+        void complete(const ResourcePtr& result);
+    };
+
+    ////////////////////////////////////////////////////////////
+    /** @class ResourceFuture
+     *  @ingroup Core
+     *  @brief Gives the resource loaded by
+     *  ResourceManager::loadResourceAsync() once it is ready.
+     *
+     *  Every future of the same entry shares the same request.
+     *  The future becomes ready once the resource is in its entry.
+     *  @code
+     *  ResourceFuture future = ResourceManager::Get().loadResourceAsync(String("Level"), String("level.map"));
+     *  // ... Do something else ...
+     *  ResourcePtr level = future.wait();
+     *  @endcode
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL ResourceFuture
+    {
+        friend class ResourceManager;
+
+    private:
+
+        ResourceRequest* m_request;///< Shared request, or null.
+
+    public:
+
+        ResourceFuture();
+        ResourceFuture(ResourceRequest* request);
+        ResourceFuture(const ResourceFuture& rhs);
+        ResourceFuture& operator = (const ResourceFuture& rhs);
+        ~ResourceFuture();
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns true if the future refers to a request.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool isValid() const { return m_request != nullptr; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the name of the entry receiving the
+         *  resource.
+        **/
+        ////////////////////////////////////////////////////////////
+        const String& getName() const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns true if the resource is loaded, or failed
+         *  to, without blocking.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool isReady() const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Blocks the calling thread until the resource is
+         *  loaded, and returns it.
+         *
+         *  @return The loaded resource, or a null pointer if it
+         *  can't be loaded or the future is invalid.
+        **/
+        ////////////////////////////////////////////////////////////
+        const ResourcePtr& wait() const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Calls given function once the resource is loaded.
+         *
+         *  The function is called by the loading thread, or at once
+         *  by the calling thread if the resource is already loaded.
+         *  It is called before wait() returns.
+        **/
+        ////////////////////////////////////////////////////////////
+        void onReady(const ResourceCallback& callback) const;
+    };
+}
+
+#endif // APRO_RESOURCEFUTURE_H
@@ -18,7 +18,11 @@
 #include "SString.h"
 #include "Resource.h"
 #include "List.h"
+#include "Array.h"
 #include "ParametedObject.h"
+#include "FileMapping.h"
+#include "MemoryStream.h"
+#include "ThreadMutexI.h"
 
 namespace APro
 {
@@ -36,6 +40,8 @@ namespace APro
      *
      *  @note Default loaders for given extensions are managed by
      *  the ResourceManager.
+     *  @note Unless isThreadSafe() returns true, the ResourceManager
+     *  never calls a loader from two threads at once.
     **/
     ////////////////////////////////////////////////////////////
     class APRO_DLL ResourceLoader : public ParametedObject
@@ -45,6 +51,8 @@ namespace APro
 
         String name;
         String description;
+
+        mutable ThreadMutexI loading_mutex;///< Locked by the ResourceManager while a not thread-safe loader loads.
 
     public:
 
@@ -82,6 +90,30 @@ namespace APro
         ////////////////////////////////////////////////////////////
         virtual ResourcePtr loadResource(const String& filename) = 0;
 
+        ////////////////////////////////////////////////////////////
+        /** @brief Load a resource from bytes already in memory.
+         *
+         *  Called by the ResourceManager for files found in a mounted
+         *  ResourcePack. The stream is destroyed once this function
+         *  returns, but the bytes it reads stay valid while the pack
+         *  is mounted.
+         *  @note Only called when canLoadFromStream() returns true.
+         *  The default implementation can't load anything and
+         *  returns nullptr.
+        **/
+        ////////////////////////////////////////////////////////////
+        virtual ResourcePtr loadResourceFromStream(const String& filename, MemoryStream& stream);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns true if this loader implements
+         *  loadResourceFromStream().
+         *  @note The default implementation returns false : the
+         *  ResourceManager then always calls loadResource(), even for
+         *  files of a mounted ResourcePack.
+        **/
+        ////////////////////////////////////////////////////////////
+        virtual bool canLoadFromStream() const;
+
         ////////////////////////////////////////////////////////////
         /** @brief Returns the name of this Loader.
         **/
@@ -93,6 +125,51 @@ namespace APro
         **/
         ////////////////////////////////////////////////////////////
         const String& getDescription() const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns true if loadResource(),
+         *  loadResourceFromStream() and getDependencies() can run in
+         *  several threads at once.
+         *  @note The default implementation returns false : the
+         *  ResourceManager then loads one resource at a time with
+         *  this loader.
+        **/
+        ////////////////////////////////////////////////////////////
+        virtual bool isThreadSafe() const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Adds to given array the files the resource in
+         *  given file depends on.
+         *
+         *  ResourceManager::loadResourceTree() loads them first, in
+         *  entries named as their file, so loadResource() finds them
+         *  with ResourceManager::getResource() instead of loading
+         *  them itself. The default implementation has none.
+        **/
+        ////////////////////////////////////////////////////////////
+        virtual void getDependencies(const String& filename, Array<String>& dependencies) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the mutex locked by the ResourceManager
+         *  around the loading functions of a not thread-safe loader.
+        **/
+        ////////////////////////////////////////////////////////////
+        ThreadMutexI& getLoadingMutex() const { return loading_mutex; }
+
+    protected:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Maps the given file in memory, read-only.
+         *
+         *  Loaders should use it to read their files : the content is
+         *  not copied, and is shared with other processes through the
+         *  system cache. The mapping must be kept while the content
+         *  is used.
+         *  @return An invalid FileMapping if the file can't be opened
+         *  or mapped.
+        **/
+        ////////////////////////////////////////////////////////////
+        FileMapping mapFile(const String& filename, FileMapping::Advice advice = FileMapping::Sequential) const;
     };
 
     typedef AutoPointer<ResourceLoader> ResourceLoaderPtr;
@@ -36,13 +36,26 @@
 #include "AutoPointer.h"
 #include "Manager.h"
 #include "NameCopyGenerator.h"
+#include "Atom.h"
+#include "Array.h"
+#include "QuickMap.h"
+#include "ThreadMutexI.h"
+#include "ThreadCondition.h"
+#include "Atomic.h"
 
 #include "Resource.h"
 #include "ResourceLoader.h"
 #include "ResourceWriter.h"
+#include "ResourcePack.h"
+#include "ResourceFuture.h"
+#include "ResourceManifest.h"
+#include "ResourcePreloader.h"
 
 namespace APro
 {
+    class Thread;
+    class ResourceGraphLoad;
+
     ////////////////////////////////////////////////////////////
     /** @class ResourceManager
      *  @ingroup Core
@@ -77,6 +90,68 @@ namespace APro
      *  will be loaded in a BinaryArray Resource or a null Resource is
      *  returned depending on the option "NoDefaultLoader" value.
      *
+     *  ### Resource packs
+     *
+     *  Files can be loaded from ResourcePack mounted with mountPack().
+     *  If a mounted pack has an entry named as the file path given to
+     *  loadResource, it is given to the loader as a MemoryStream, and
+     *  the file system is not used. The last pack mounted is looked
+     *  up first.
+     *
+     *  ### Lookups
+     *
+     *  Entries, loaders and writers are indexed by name in hash maps,
+     *  so finding one does not depend on how many are loaded. Entries
+     *  are allocated once and never move : a ResourceEntryPtr stays
+     *  valid until unloadAllResource(). Loaders and writers must be
+     *  added with addLoader() and addWriter() to be indexed.
+     *
+     *  ### Memory budget
+     *
+     *  With setMemoryBudget(), the manager counts the memory used by
+     *  loaded resources (see Resource::getMemorySize()). When it goes
+     *  over the budget, resources used only by their entry are
+     *  evicted, the least recently used first (CLOCK algorithm : an
+     *  entry used since the last pass gets a second chance). An
+     *  evicted resource is loaded again, from the same file and with
+     *  the same loader, the next time its entry is asked for it.
+     *  @note Hold a ResourcePtr copy, not a reference, to keep a
+     *  resource from being evicted.
+     *
+     *  ### Lazy resources
+     *
+     *  registerResource() creates an entry holding only a file and a
+     *  loader (a stub). The resource is loaded on the first call to
+     *  ResourceEntry::getResource(), or before in the loading threads
+     *  if prefetch() is called. ResourceEntry::getState() tells
+     *  without blocking if the resource is there, not loaded yet, or
+     *  failed to load. An evicted resource goes back to a stub.
+     *
+     *  ### Dependencies
+     *
+     *  Loaders may declare the files a resource depends on (see
+     *  ResourceLoader::getDependencies()). loadResourceTree() builds
+     *  the dependency graph of a resource, then loads it from the
+     *  leaves : independent branches load in parallel, a dependency
+     *  shared by several resources is loaded once, and a cycle is
+     *  reported and broken. reloadResource() and reloadFile() load a
+     *  resource again with every resource depending on it, and
+     *  nothing else.
+     *
+     *  ### Asynchronous loading
+     *
+     *  loadResourceAsync() queues the loading and returns a
+     *  ResourceFuture at once. Loading threads are started on the
+     *  first loading, or by startLoadingThreads(). Requests for a name
+     *  already being loaded share the same loading, and the entry
+     *  receives the resource only once it is fully loaded. Loaders
+     *  which are not thread-safe (see ResourceLoader::isThreadSafe())
+     *  load one resource at a time.
+     *
+     *  preload() returns a ResourcePreloader which, once started,
+     *  loads every item of a ResourceManifest this way, the highest
+     *  priorities first, and follows the progress.
+     *
     **/
     ////////////////////////////////////////////////////////////
     class APRO_DLL ResourceManager : 
@@ -86,6 +161,8 @@ namespace APro
     {
         APRO_DECLARE_MANUALSINGLETON(ResourceManager)
 
+        friend class ResourceGraphLoad;
+
     public:
 
         ////////////////////////////////////////////////////////////
@@ -102,8 +179,34 @@ namespace APro
 
         protected:
 
-            String      m_name;         ///< Name of the Entry.
-            ResourcePtr m_resource_data;///< Data Resource pointer.
+            String            m_name;         ///< Name of the Entry.
+            Atom              m_atom;         ///< Interned name of the Entry.
+            ResourcePtr       m_resource_data;///< Data Resource pointer.
+            ResourceManager*  m_manager;      ///< Manager owning the Entry, or null.
+            String            m_filename;     ///< File the resource was loaded from.
+            ResourceLoaderPtr m_loader;       ///< Loader of the resource, used to load it again once evicted.
+            size_t            m_memory_size;  ///< Memory size of the resource, as counted by the manager.
+            bool              m_referenced;   ///< Set when the resource is used, cleared by the eviction clock.
+            bool              m_evicted;      ///< True if the resource was evicted, and must be loaded again.
+
+        public:
+
+            /////////////////////////////////////////////////////////////
+            /** @enum State
+             *  @brief State of the resource of an Entry.
+            **/
+            /////////////////////////////////////////////////////////////
+            enum State
+            {
+                S_Empty  = 0,///< No resource, and no file to load it from.
+                S_Stub   = 1,///< Not loaded yet, or evicted : loaded on first use.
+                S_Ready  = 2,///< The resource is loaded.
+                S_Failed = 3 ///< The last loading of the file failed.
+            };
+
+        protected:
+
+            Atomic<State>     m_state;        ///< State of the resource. Read without the manager lock.
 
         public:
 
@@ -111,8 +214,9 @@ namespace APro
             /** @brief Constructs the ResourceEntry.
             **/
             ////////////////////////////////////////////////////////////
-            ResourceEntry(const String& name)
-                : m_name(name), m_resource_data(nullptr) {}
+            ResourceEntry(const String& name, ResourceManager* manager = nullptr)
+                : m_name(name), m_atom(name), m_resource_data(nullptr), m_manager(manager),
+                  m_loader(nullptr), m_memory_size(0), m_referenced(false), m_evicted(false), m_state(S_Empty) {}
 
             ////////////////////////////////////////////////////////////
             /** @brief Destructs the ResourceEntry.
@@ -128,14 +232,49 @@ namespace APro
             ////////////////////////////////////////////////////////////
             const String& getName() const { return m_name; }
 
+            ////////////////////////////////////////////////////////////
+            /** @brief Returns the interned name of this Entry.
+            **/
+            ////////////////////////////////////////////////////////////
+            const Atom& getAtom() const { return m_atom; }
+
+            ////////////////////////////////////////////////////////////
+            /** @brief Returns true if the resource of this Entry was
+             *  evicted by the manager.
+            **/
+            ////////////////////////////////////////////////////////////
+            bool isEvicted() const { return m_evicted; }
+
+            ////////////////////////////////////////////////////////////
+            /** @brief Returns true if this Entry holds a resource, even
+             *  evicted.
+            **/
+            ////////////////////////////////////////////////////////////
+            bool isLoaded() const { return !m_resource_data.isNull() || m_evicted; }
+
+            ////////////////////////////////////////////////////////////
+            /** @brief Returns the state of the resource, without
+             *  loading it.
+            **/
+            ////////////////////////////////////////////////////////////
+            State getState() const { return m_state.get(); }
+
+            ////////////////////////////////////////////////////////////
+            /** @brief Returns the file the resource is loaded from.
+            **/
+            ////////////////////////////////////////////////////////////
+            const String& getFilename() const { return m_filename; }
+
             ////////////////////////////////////////////////////////////
             /** @brief Returns the resource in this Entry.
+             *  @note If the Entry is a stub, the resource is loaded
+             *  first : this call may block.
             **/
             ////////////////////////////////////////////////////////////
-            ResourcePtr& getResource() { return m_resource_data; }
+            ResourcePtr getResource();
             template<typename ResourceType> AutoPointer<ResourceType> getResource()
             {
-                ResourcePtr& tmp = getResource();
+                ResourcePtr tmp = getResource();
                 if(!tmp.isNull())
                     return AutoPointer<ResourceType>(tmp.reinterpret<ResourceType>());
                 else
@@ -144,12 +283,13 @@ namespace APro
 
             ////////////////////////////////////////////////////////////
             /** @brief Returns the resource in this Entry.
+             *  @note A stub is not loaded : a null pointer is returned.
             **/
             ////////////////////////////////////////////////////////////
-            const ResourcePtr& getResource() const { return m_resource_data; }
+            ResourcePtr getResource() const;
             template<typename ResourceType> const AutoPointer<ResourceType> getResource() const
             {
-                const ResourcePtr& tmp = getResource();
+                ResourcePtr tmp = getResource();
                 if(!tmp.isNull())
                     return AutoPointer<ResourceType>(const_cast<ResourceType*>(tmp.reinterpret<const ResourceType>()));
                 else
@@ -171,22 +311,64 @@ namespace APro
         public:
             ResourceNCG(ResourceManager* _rm) { rm = _rm; }
             bool isNameUsed(const String& name) const;
+            int  getFirstCopy(const String& name);
+            void onCopyGenerated(const String& name, int copy);
         private:
             ResourceManager* rm;
         };
 
     private:
 
-        List<ResourceEntry>                 m_resource_entries;///< ResourceEntry list.
+        ////////////////////////////////////////////////////////////
+        /** @brief A loader or writer indexed by name, with its
+         *  position in m_loaders or m_writers.
+        **/
+        ////////////////////////////////////////////////////////////
+        template <typename T>
+        struct IndexedObject
+        {
+            AutoPointer<T> object;  ///< The loader or writer.
+            size_t         position;///< Its position in the list.
+        };
+
+        typedef IndexedObject<ResourceLoader> IndexedLoader;
+        typedef IndexedObject<ResourceWriter> IndexedWriter;
+
+        Array<ResourceEntry*>               m_resource_entries;///< ResourceEntry list, in creation order. Entries are owned by the Manager.
+        QuickMap<String, ResourceEntry*>    m_resource_index;  ///< ResourceEntry by name.
+        QuickMap<String, int>               m_copy_counters;   ///< Last copy number generated by ResourceNCG, by name.
         List<AutoPointer<ResourceLoader> >& m_loaders;         ///< Loader in this Manager.
         List<AutoPointer<ResourceWriter> >& m_writers;         ///< Writer in this Manager.
+        QuickMap<String, IndexedLoader>     m_loader_index;    ///< Loaders by name.
+        QuickMap<String, IndexedWriter>     m_writer_index;    ///< Writers by name.
 
         Map<String, String>                 m_default_loaders; ///< Default Loader for extension.
         Map<String, String>                 m_default_writers; ///< Default Writer for extension.
+        Array<ResourcePack*>                m_packs;           ///< Mounted packs.
 
         bool                                m_overwrite_loading; ///< Overwrite resource when loading with same name. If set to true, loading resource with same name
                                                                  ///  will overwrite and erase old resource. False is default value. If false, copy name will be generated.
 
+        ThreadMutexI                        m_async_mutex;     ///< Protects the loading queue and the pending requests.
+        ThreadCondition                     m_async_not_empty; ///< Signaled when a request is queued.
+        ResourceRequest*                    m_async_first;     ///< First queued request.
+        ResourceRequest*                    m_async_last;      ///< Last queued request.
+        QuickMap<String, ResourceRequest*>  m_async_pending;   ///< Requests queued or loading, by entry name.
+        Array<Thread*>                      m_async_threads;   ///< Loading threads.
+        bool                                m_async_running;   ///< True while loading threads run.
+        bool                                m_async_stopping;  ///< True while loading threads are stopped.
+
+        size_t                              m_memory_budget;   ///< Maximum memory used by resources, or 0 for no limit.
+        size_t                              m_memory_usage;    ///< Memory used by loaded resources.
+        size_t                              m_clock_hand;      ///< Index of the next entry looked at by the eviction clock.
+
+        QuickMap<String, Array<String> >    m_dependencies;    ///< Entries each entry depends on.
+        QuickMap<String, Array<String> >    m_dependents;      ///< Entries depending on each entry.
+
+    public:
+
+        static const size_t DefaultLoadingThreads = 2;///< Number of loading threads started by loadResourceAsync().
+
     public:
 
         ////////////////////////////////////////////////////////////
@@ -218,10 +400,10 @@ namespace APro
          *  if found, else returns a null pointer.
         **/
         ////////////////////////////////////////////////////////////
-        ResourcePtr& getResource(const String& name);
+        ResourcePtr getResource(const String& name);
         template<typename ResourceType> AutoPointer<ResourceType> getResource(const String& name)
         {
-            ResourcePtr& tmp = getResource(name);
+            ResourcePtr tmp = getResource(name);
             if(!tmp.isNull())
                 return AutoPointer<ResourceType>(tmp.reinterpret<ResourceType>());
             else
@@ -233,10 +415,10 @@ namespace APro
          *  if found, else returns a null pointer.
         **/
         ////////////////////////////////////////////////////////////
-        const ResourcePtr& getResource(const String& name) const;
+        ResourcePtr getResource(const String& name) const;
         template<typename ResourceType> const AutoPointer<ResourceType> getResource(const String& name) const
         {
-            const ResourcePtr& tmp = getResource(name);
+            ResourcePtr tmp = getResource(name);
             if(!tmp.isNull())
                 return AutoPointer<ResourceType>(tmp.reinterpret<const ResourceType>());
             else
@@ -274,6 +456,36 @@ namespace APro
         ////////////////////////////////////////////////////////////
         ResourceEntryPtr createResourceEntry(const String& name);
 
+        ////////////////////////////////////////////////////////////
+        /** @brief Retrieve a Resource with given interned name.
+         *  @note Entries are compared by their Atom, so no String
+         *  comparison is done.
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourcePtr getResource(const Atom& name);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the resourceEntry that have the given
+         *  interned name, or a null pointer.
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourceEntryPtr getResourceEntry(const Atom& name);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the resourceEntry that have the given
+         *  interned name, or a null pointer.
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourceEntryPtr getResourceEntry(const Atom& name) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Loads a resource object in the Entry with given
+         *  interned name.
+         *  @see loadResource(const String&, const String&)
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourceEntryPtr loadResource(const Atom& name, const String& filename);
+
         ////////////////////////////////////////////////////////////
         /** @brief Loads a resource object.
          *
@@ -302,6 +514,8 @@ namespace APro
          *
          *  @return <strong>True</strong> if success, <strong>False</strong>
          *  otherweise.
+         *  @note If the entry is already being loaded asynchronously,
+         *  that loading is waited for instead of being done twice.
         **/
         ////////////////////////////////////////////////////////////
         bool loadResource(ResourceEntryPtr& entry, const String& filename);
@@ -376,6 +590,36 @@ namespace APro
         ////////////////////////////////////////////////////////////
         void overwriteOnLoading(bool _overwrite);
 
+        ////////////////////////////////////////////////////////////
+        /** @brief Sets the maximum number of bytes used by loaded
+         *  resources, and evicts resources if it is already over.
+         *  @param budget : 0 for no limit, the default.
+        **/
+        ////////////////////////////////////////////////////////////
+        void setMemoryBudget(size_t budget);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the memory budget, or 0 if there is no
+         *  limit.
+        **/
+        ////////////////////////////////////////////////////////////
+        size_t getMemoryBudget() const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the number of bytes used by loaded
+         *  resources.
+        **/
+        ////////////////////////////////////////////////////////////
+        size_t getMemoryUsage() const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Evicts unused resources until the memory used is
+         *  under given number of bytes, or no resource can be evicted.
+         *  @return Number of bytes freed.
+        **/
+        ////////////////////////////////////////////////////////////
+        size_t evictResources(size_t target);
+
         ////////////////////////////////////////////////////////////
         /** @brief Returns true if given resource entry name already
          *  exists.
@@ -383,8 +627,200 @@ namespace APro
         ////////////////////////////////////////////////////////////
         bool resourceEntryExists(const String& name) const;
 
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns true if given interned resource entry name
+         *  already exists.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool resourceEntryExists(const Atom& name) const;
+
         /// @}
 
+    public:
+
+        /*
+           ======================
+           = Asynchronous Loads =
+           ======================
+        */
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Loads a resource object in a loading thread.
+         *
+         *  @param name : Name of the Entry where the resource should
+         *  be loaded. If invalid, a new entry is created.
+         *  @param filename : File path where the resource is.
+         *
+         *  If the entry is already being loaded, the future shares
+         *  this loading and filename is ignored. If the entry already
+         *  holds a resource and overwriting is off, the future is
+         *  ready with this resource.
+         *
+         *  @return A future giving the resource once it is in the
+         *  entry. It is invalid if name or filename is empty.
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourceFuture loadResourceAsync(const String& name, const String& filename);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Loads a resource object in a loading thread, with
+         *  given loader and priority.
+         *
+         *  @param loader : Loader to use. If null, the default loader
+         *  for the extension is used.
+         *  @param priority : Queued requests with a higher priority
+         *  are loaded first. Requests of the same priority are loaded
+         *  in order.
+         *
+         *  @see loadResourceAsync(const String&, const String&)
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourceFuture loadResourceAsync(const String& name, const String& filename, const ResourceLoaderPtr& loader, int priority);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Creates the preloader of given manifest.
+         *
+         *  Nothing is loaded until ResourcePreloader::start() is
+         *  called, so listeners can be added to the preloader first.
+         *
+         *  @return An object to start and follow the loading, or wait
+         *  for some items. Destroying it waits for every item.
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourcePreloaderPtr preload(const ResourceManifest& manifest);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Registers a resource without loading it.
+         *
+         *  The entry holds only the file and the loader, and loads the
+         *  resource the first time it is asked for it.
+         *
+         *  @param loaderName : Name of the loader to use. If empty,
+         *  the default loader for the extension is used.
+         *  @return The entry, or null if no loader can load the file.
+         *  An entry already holding a resource is returned unchanged,
+         *  unless overwriting is on.
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourceEntryPtr registerResource(const String& name, const String& filename, const String& loaderName = String());
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Registers every item of given manifest without
+         *  loading it.
+         *  @return Number of items registered.
+        **/
+        ////////////////////////////////////////////////////////////
+        size_t registerResources(const ResourceManifest& manifest);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Hints that a registered resource will be used soon :
+         *  it is loaded in the loading threads.
+         *
+         *  @return A future giving the resource. It is invalid if the
+         *  entry does not exist or is empty. For a loaded entry, it is
+         *  ready at once.
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourceFuture prefetch(const String& name, int priority = 0);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the state of given entry, without loading
+         *  it. S_Empty is returned if the entry does not exist.
+         *  @note Does not wait for a loading : resources are loaded
+         *  without the manager lock.
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourceEntry::State getResourceState(const String& name) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Loads a resource object and its dependencies in
+         *  the loading threads.
+         *
+         *  Dependencies are loaded before the resources depending on
+         *  them, in entries named as their file. Already loaded
+         *  dependencies are not loaded again.
+         *
+         *  @return A future giving the resource once it and its
+         *  dependencies are loaded.
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourceFuture loadResourceTree(const String& name, const String& filename, int priority = 0);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Loads again the resource of given entry, from the
+         *  same file, then every resource depending on it.
+         *  @return A future giving the new resource once every
+         *  resource depending on it is loaded again too, or an invalid
+         *  future if the entry was not loaded from a file.
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourceFuture reloadResource(const String& name);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Loads again every resource loaded from given file,
+         *  with the resources depending on them.
+         *  @note Call it when a file changes on disk.
+         *  @return Number of entries loaded from the file.
+        **/
+        ////////////////////////////////////////////////////////////
+        size_t reloadFile(const String& filename);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the entries given entry depends on, as
+         *  declared by its loader.
+        **/
+        ////////////////////////////////////////////////////////////
+        Array<String> getDependencies(const String& name) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the entries depending directly on given
+         *  entry.
+        **/
+        ////////////////////////////////////////////////////////////
+        Array<String> getDependents(const String& name) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Starts the loading threads.
+         *  @return False if they are already running, or if the
+         *  Engine is compiled without threads : requests are then
+         *  loaded by the calling thread.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool startLoadingThreads(size_t threads = DefaultLoadingThreads);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Loads every queued request, then stops the loading
+         *  threads.
+        **/
+        ////////////////////////////////////////////////////////////
+        void stopLoadingThreads();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Removes the first queued request, waiting for one.
+         *  @return Null once the loading threads are stopped and the
+         *  queue is empty.
+         *  @note Called by the loading threads.
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourceRequest* _takeRequest();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Removes given request from the queue, if no loading
+         *  thread took it yet.
+         *  @return True if the request was removed.
+         *  @note m_async_mutex must be locked.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool _unqueueRequest(ResourceRequest* request);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Loads the resource of given request, publishes it
+         *  in its entry, then completes the request.
+         *  @note Called by the loading threads.
+        **/
+        ////////////////////////////////////////////////////////////
+        void _executeRequest(ResourceRequest* request);
+
     public:
 
         /*
@@ -493,7 +929,7 @@ namespace APro
         /** @brief Removes a writer from this ResourceManager.
         **/
         ////////////////////////////////////////////////////////////
-        bool removeWriter(const ResourceLoaderPtr& writer);
+        bool removeWriter(const ResourceWriterPtr& writer);
 
         ////////////////////////////////////////////////////////////
         /** @brief Removes a writer from this ResourceManager.
@@ -547,6 +983,45 @@ namespace APro
         ////////////////////////////////////////////////////////////
         ResourceWriterPtr getDefaultWriter(const String& ext) const;
 
+    public:
+
+        /*
+           ============================
+           = Resource Pack Management =
+           ============================
+        */
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Opens given ResourcePack, and looks up files in it
+         *  when loading resources.
+         *  @return False if the pack can't be opened, or is already
+         *  mounted.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool mountPack(const String& filename);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Closes given ResourcePack.
+         *  @note Resources loaded from the pack may read its bytes :
+         *  they should be unloaded first.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool unmountPack(const String& filename);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns true if given ResourcePack is mounted.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool isPackMounted(const String& filename) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Opens a stream on given file in the mounted packs.
+         *  @return A stream to destroy with AProDelete(), or null if
+         *  no pack has the file.
+        **/
+        ////////////////////////////////////////////////////////////
+        MemoryStream* openPackedFile(const String& filename) const;
+
     protected:
 
         ////////////////////////////////////////////////////////////
@@ -574,6 +1049,102 @@ namespace APro
         **/
         ////////////////////////////////////////////////////////////
         int _getWriterIndex(const String& name) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Removes the Loader at given position, and moves
+         *  the positions of the following ones.
+         *  @note The manager must be locked.
+        **/
+        ////////////////////////////////////////////////////////////
+        void _eraseLoader(size_t position);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Removes the Writer at given position, and moves
+         *  the positions of the following ones.
+         *  @note The manager must be locked.
+        **/
+        ////////////////////////////////////////////////////////////
+        void _eraseWriter(size_t position);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the entry with given name, or null.
+         *  @note Unlike getResourceEntry(), a missing entry is not
+         *  reported.
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourceEntryPtr _findEntry(const String& name) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Queues the loading of given entry.
+         *  @param force : If false and the entry is loaded, the future
+         *  is ready at once with the loaded resource.
+         *  @see loadResourceAsync()
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourceFuture _queueRequest(const String& name, const String& filename, const ResourceLoaderPtr& loader, int priority, bool force);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Waits for the request of given future, and returns
+         *  its resource.
+         *
+         *  A request no loading thread took yet is loaded at once, in
+         *  the calling thread.
+         *  @note The manager must not be locked.
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourcePtr _waitRequest(const ResourceFuture& future);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Adds given entry to the graph, then its dependencies
+         *  which are not loaded, or are in forced.
+         *  @return Index of the entry in the graph.
+        **/
+        ////////////////////////////////////////////////////////////
+        size_t _addGraphNode(ResourceGraphLoad& graph, const String& name, const String& filename, const ResourceLoaderPtr& loader,
+                             const QuickMap<String, bool>& forced);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Records the dependencies of given entry, replacing
+         *  the old ones.
+        **/
+        ////////////////////////////////////////////////////////////
+        void _setDependencies(const String& name, const Array<String>& dependencies);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Puts given resource in given entry, counts its
+         *  memory, and evicts other resources if over the budget.
+        **/
+        ////////////////////////////////////////////////////////////
+        void _setEntryResource(ResourceEntryPtr entry, const ResourcePtr& resource, const String& filename, const ResourceLoaderPtr& loader);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Marks given entry as used, loads its resource if
+         *  it is a stub, and returns it.
+         *
+         *  A stub is loaded as a request, without the manager lock : a
+         *  stub being prefetched is waited for, or loaded at once if
+         *  no loading thread took it yet.
+         *  @note Must not be called with the manager locked if the
+         *  entry may be a stub.
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourcePtr _useEntry(ResourceEntryPtr entry);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns a copy of the resource of given entry,
+         *  taken under the lock, without loading it.
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourcePtr _getEntryResource(const ResourceEntry* entry) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Runs the eviction clock until the memory used is
+         *  under target.
+         *  @param keep : Entry never evicted, or null.
+         *  @return Number of bytes freed.
+        **/
+        ////////////////////////////////////////////////////////////
+        size_t _evict(size_t target, const ResourceEntry* keep);
     };
 
     typedef ResourceManager::ResourceEntryPtr ResourceEntryPtr;
@@ -0,0 +1,124 @@
+/////////////////////////////////////////////////////////////
+/** @file ResourceManifest.h
+ *  @ingroup Core
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the ResourceManifest class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_RESOURCEMANIFEST_H
+#define APRO_RESOURCEMANIFEST_H
+
+#include "Platform.h"
+#include "SString.h"
+#include "Array.h"
+#include "Dictionnary.h"
+
+namespace APro
+{
+    ////////////////////////////////////////////////////////////
+    /** @class ResourceManifest
+     *  @ingroup Core
+     *  @brief A list of resources to load together, given to
+     *  ResourceManager::preload().
+     *
+     *  Each item names the entry to load, the file, optionally the
+     *  loader (else the default one for the extension is used) and
+     *  a priority : items with a higher priority are loaded first.
+     *
+     *  An item can be described by a Dictionnary with the keys
+     *  "name", "file", "loader" and "priority". A manifest file holds
+     *  an archive header with Tag and Version, the number of items,
+     *  then each item Dictionnary, written with BinaryOutputStream.
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL ResourceManifest
+    {
+    public:
+
+        static const uint32_t Tag     = 0x464E4D41;///< "AMNF", archive tag of manifest files.
+        static const uint32_t Version = 1;         ///< Version of the manifest file format.
+
+        struct Item
+        {
+            String name;    ///< Name of the entry.
+            String filename;///< File to load.
+            String loader;  ///< Name of the loader, or empty for the default one.
+            int    priority;///< Items with a higher priority are loaded first.
+        };
+
+    private:
+
+        Array<Item> m_items;///< Items, in the order they were added.
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Adds an item.
+        **/
+        ////////////////////////////////////////////////////////////
+        void add(const String& name, const String& filename, const String& loader = String(), int priority = 0);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Adds the item described by given Dictionnary.
+         *  @return False if it has no "name" or "file" String.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool add(const Dictionnary& item);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the number of items.
+        **/
+        ////////////////////////////////////////////////////////////
+        size_t size() const { return m_items.size(); }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the item at given index.
+        **/
+        ////////////////////////////////////////////////////////////
+        const Item& at(size_t index) const { return m_items[index]; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Removes every item.
+        **/
+        ////////////////////////////////////////////////////////////
+        void clear();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Adds the items of given manifest file.
+         *  @return False if the file can't be read, is not a manifest
+         *  or has a newer version. Items read before the error are
+         *  kept.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool loadFile(const String& filename);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Writes the items to given manifest file.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool saveFile(const String& filename) const;
+    };
+}
+
+#endif // APRO_RESOURCEMANIFEST_H
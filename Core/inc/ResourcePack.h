@@ -0,0 +1,342 @@
+/////////////////////////////////////////////////////////////
+/** @file ResourcePack.h
+ *  @ingroup Core
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the ResourcePack and ResourcePackWriter classes.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_RESOURCEPACK_H
+#define APRO_RESOURCEPACK_H
+
+#include "Platform.h"
+#include "NonCopyable.h"
+#include "SString.h"
+#include "StringView.h"
+#include "Array.h"
+#include "QuickMap.h"
+#include "FileMapping.h"
+#include "MemoryStream.h"
+
+namespace APro
+{
+    ////////////////////////////////////////////////////////////
+    /** @class ResourcePack
+     *  @ingroup Core
+     *  @brief Many resources files stored in one archive, mapped in
+     *  memory once.
+     *
+     *  A pack is made of a header, the entries data, a table of
+     *  the entries names and the table of contents. The table of
+     *  contents is sorted by hash of the names, so an entry is
+     *  found by a binary search without reading any name but the
+     *  one looked for.
+     *
+     *  Each entry starts at a multiple of its alignment, and may be
+     *  compressed. Its CRC-32C is checked when it is opened, if
+     *  setVerify() is true.
+     *  @code
+     *  ResourcePack pack("data/textures.pak");
+     *  MemoryStream* stream = pack.openStream("wood/oak.png");
+     *  if(stream) { ...; AProDelete(stream); }
+     *  @endcode
+     *
+     *  Names are relative to the packed directory, with '/' as
+     *  separator.
+     *
+     *  @note Once mounted in the ResourceManager, a pack is used by
+     *  ResourceManager::loadResource() before the file system.
+     *  @warning The bytes of a stored entry are the bytes of the
+     *  mapping : they are valid until the pack is closed.
+     *  @see ResourcePackWriter
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL ResourcePack : public NonCopyable
+    {
+    public:
+
+        static const uint32_t Magic   = 0x4B415041;///< "APAK", read as a little-endian integer.
+        static const uint16_t Version = 1;         ///< Version of the format.
+
+        ////////////////////////////////////////////////////////////
+        /** @enum Method
+         *  @brief How the bytes of an entry are stored.
+        **/
+        ////////////////////////////////////////////////////////////
+        enum Method
+        {
+            M_Stored = 0,///< Bytes are stored as is.
+            M_LZ     = 1 ///< Bytes are one LZCodec block.
+        };
+
+        ////////////////////////////////////////////////////////////
+        /** @struct Header
+         *  @brief First bytes of a pack.
+        **/
+        ////////////////////////////////////////////////////////////
+        struct Header
+        {
+            uint32_t magic;       ///< Magic.
+            uint16_t version;     ///< Version.
+            uint16_t flags;       ///< Reserved, 0.
+            uint32_t count;       ///< Number of entries.
+            uint32_t toc_crc;     ///< CRC-32C of the table of contents and of the names.
+            uint64_t toc_offset;  ///< Offset of the table of contents.
+            uint64_t names_offset;///< Offset of the names table.
+            uint64_t names_size;  ///< Size of the names table.
+        };
+
+        ////////////////////////////////////////////////////////////
+        /** @struct Entry
+         *  @brief An entry of the table of contents.
+        **/
+        ////////////////////////////////////////////////////////////
+        struct Entry
+        {
+            uint64_t hash;         ///< Hash() of the name.
+            uint64_t offset;       ///< Offset of the bytes in the pack.
+            uint64_t size;         ///< Number of bytes in the pack.
+            uint64_t original_size;///< Number of bytes once decompressed.
+            uint32_t name_offset;  ///< Offset of the name in the names table.
+            uint32_t name_size;    ///< Size of the name.
+            uint32_t crc;          ///< CRC-32C of the decompressed bytes.
+            uint8_t  method;       ///< Method used to store the bytes.
+            uint8_t  alignment;    ///< Alignment of the bytes, as a power of 2.
+            uint16_t reserved;     ///< Reserved, 0.
+        };
+
+    private:
+
+        FileMapping  m_mapping; ///< Mapped pack.
+        String       m_filename;///< Path of the pack.
+        const Entry* m_entries; ///< Table of contents, in the mapping.
+        size_t       m_count;   ///< Number of entries.
+        const char*  m_names;   ///< Names table, in the mapping.
+        bool         m_verify;  ///< True to check the CRC of opened entries.
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Constructs a closed pack.
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourcePack();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Constructs the pack and opens given file.
+        **/
+        ////////////////////////////////////////////////////////////
+        explicit ResourcePack(const String& filename);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Closes the pack.
+        **/
+        ////////////////////////////////////////////////////////////
+        ~ResourcePack();
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Maps given pack and checks its table of contents.
+         *  @return False if the file can't be mapped, or is not a
+         *  valid pack.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool open(const String& filename);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Unmaps the pack. Streams opened on stored entries
+         *  must not be used anymore.
+        **/
+        ////////////////////////////////////////////////////////////
+        void close();
+
+        bool isOpened() const { return m_mapping.isValid(); }
+        const String& getFilename() const { return m_filename; }
+
+        void setVerify(bool verify) { m_verify = verify; }
+        bool isVerifying() const { return m_verify; }
+
+    public:
+
+        size_t getEntryCount() const { return m_count; }
+        const Entry& getEntry(size_t index) const { return m_entries[index]; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the name of given entry.
+        **/
+        ////////////////////////////////////////////////////////////
+        StringView getName(const Entry& entry) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the entry with given name, or null.
+        **/
+        ////////////////////////////////////////////////////////////
+        const Entry* find(const StringView& name) const;
+
+        bool contains(const StringView& name) const { return find(name) != nullptr; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the bytes of given entry, as stored in the
+         *  pack.
+        **/
+        ////////////////////////////////////////////////////////////
+        StringView getStoredBytes(const Entry& entry) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Opens a read-only stream on the entry with given
+         *  name.
+         *
+         *  A stored entry is read in place, in the mapping. A
+         *  compressed one is decompressed in a buffer owned by the
+         *  stream.
+         *  @return A stream to destroy with AProDelete(), or null if
+         *  the entry does not exist or is corrupted.
+        **/
+        ////////////////////////////////////////////////////////////
+        MemoryStream* openStream(const StringView& name) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Checks the CRC of given entry.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool verify(const Entry& entry) const;
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the hash used in the table of contents
+         *  (64 bits FNV-1a).
+        **/
+        ////////////////////////////////////////////////////////////
+        static uint64_t Hash(const StringView& name);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the CRC-32C of given bytes.
+         *  @param crc : CRC of the previous bytes, to continue it.
+         *  @see CheckSumCRC32C::Compute()
+        **/
+        ////////////////////////////////////////////////////////////
+        static uint32_t Crc32C(const Byte* data, size_t sz, uint32_t crc = 0);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns given path as an entry name : '/' as
+         *  separator, without leading './' and '/'.
+        **/
+        ////////////////////////////////////////////////////////////
+        static String NormalizeName(const StringView& path);
+
+    private:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns an owning stream on the decompressed bytes
+         *  of given entry, or null.
+        **/
+        ////////////////////////////////////////////////////////////
+        MemoryStream* decompress(const Entry& entry) const;
+    };
+
+    ////////////////////////////////////////////////////////////
+    /** @class ResourcePackWriter
+     *  @ingroup Core
+     *  @brief Builds a ResourcePack from files.
+     *  @code
+     *  ResourcePackWriter writer;
+     *  writer.addDirectory("media");
+     *  writer.write("media.pak");
+     *  @endcode
+     *
+     *  The files are read when write() is called.
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL ResourcePackWriter : public NonCopyable
+    {
+    public:
+
+        static const size_t DefaultAlignment = 16;  ///< Default alignment of the entries.
+        static const size_t MaxAlignment     = 4096;///< Maximum alignment of the entries.
+
+    private:
+
+        struct Source
+        {
+            String  name;     ///< Name of the entry.
+            String  path;     ///< File to read.
+            size_t  alignment;///< Alignment of the entry.
+            uint8_t method;   ///< Method to store the bytes.
+        };
+
+        Array<Source>         m_sources;  ///< Files to pack.
+        QuickMap<String, int> m_names;    ///< Names already added.
+        size_t                m_alignment;///< Alignment of the next files added.
+        uint8_t               m_method;   ///< Method of the next files added.
+
+    public:
+
+        ResourcePackWriter();
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Sets the alignment of the next files added. It is
+         *  rounded up to a power of 2, up to MaxAlignment.
+        **/
+        ////////////////////////////////////////////////////////////
+        void setAlignment(size_t alignment);
+        size_t getAlignment() const { return m_alignment; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Sets the method of the next files added.
+         *  @note A file which does not shrink is stored.
+        **/
+        ////////////////////////////////////////////////////////////
+        void setMethod(ResourcePack::Method method) { m_method = (uint8_t) method; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Adds a file, as entry with given name.
+         *  @return False if the name is already used.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool addFile(const String& name, const String& path);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Adds every file of given directory and of its
+         *  subdirectories, named by their path in it.
+         *  @return Number of files added.
+        **/
+        ////////////////////////////////////////////////////////////
+        size_t addDirectory(const String& directory);
+
+        size_t getFileCount() const { return m_sources.size(); }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Writes the pack.
+         *  @return False if a file can't be read, or the pack can't
+         *  be written.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool write(const String& filename) const;
+    };
+}
+
+#endif // APRO_RESOURCEPACK_H
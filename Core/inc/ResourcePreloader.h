@@ -0,0 +1,225 @@
+/////////////////////////////////////////////////////////////
+/** @file ResourcePreloader.h
+ *  @ingroup Core
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the ResourcePreloader class and its events.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_RESOURCEPRELOADER_H
+#define APRO_RESOURCEPRELOADER_H
+
+#include "Platform.h"
+#include "NonCopyable.h"
+#include "Array.h"
+#include "EventEmitter.h"
+#include "ResourceFuture.h"
+#include "ResourceManifest.h"
+#include "ThreadMutexI.h"
+
+namespace APro
+{
+    class ResourceManager;
+
+    ////////////////////////////////////////////////////////////
+    /** @class ResourcePreloader
+     *  @ingroup Core
+     *  @brief Follows the loading of a ResourceManifest, created by
+     *  ResourceManager::preload().
+     *
+     *  Nothing is loaded until start() is called, so listeners can be
+     *  added first. Each time an item is loaded, or fails to, a
+     *  ResourcePreloadedEvent is sent. Once every item is done, a
+     *  ResourcePreloadFinishedEvent is sent, by start() itself for an
+     *  empty manifest.
+     *  @note Events are sent by the loading threads, or by start() for
+     *  items already loaded : listeners must be thread-safe.
+     *
+     *  Callers can wait for every item, for the items of a minimum
+     *  priority, or for some items by name.
+     *  @code
+     *  ResourcePreloaderPtr preload = ResourceManager::Get().preload(manifest);
+     *  preload->addListener(listener);
+     *  preload->start();
+     *  preload->wait(100); // Items needed to show the first frame.
+     *  @endcode
+     *
+     *  The destructor waits for every item.
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL ResourcePreloader : public EventEmitter,
+                                       public NonCopyable
+    {
+    public:
+
+        struct Item
+        {
+            String         name;    ///< Name of the entry.
+            int            priority;///< Priority given in the manifest.
+            ResourceFuture future;  ///< Future of the loading.
+        };
+
+    private:
+
+        ResourceManager*     m_manager; ///< Manager loading the items.
+        ResourceManifest     m_manifest;///< Items to load.
+        bool                 m_started; ///< True once start() is called.
+        Array<Item>          m_items; ///< Items, in the order they are queued.
+        size_t               m_total; ///< Number of items in the manifest.
+        size_t               m_done;  ///< Number of items loaded or failed.
+        size_t               m_failed;///< Number of items which failed.
+        mutable ThreadMutexI m_mutex; ///< Protects m_done and m_failed.
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Constructs the preloader of given manifest, loaded
+         *  by given manager once started.
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourcePreloader(ResourceManager* manager, const ResourceManifest& manifest);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Waits for every item, then destroys the preloader.
+        **/
+        ////////////////////////////////////////////////////////////
+        ~ResourcePreloader();
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Queues every item in the loading threads, the
+         *  highest priorities first.
+         *  @note Does nothing if the preloader is already started.
+        **/
+        ////////////////////////////////////////////////////////////
+        void start();
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns true once start() is called.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool isStarted() const { return m_started; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the number of items.
+        **/
+        ////////////////////////////////////////////////////////////
+        size_t getTotal() const { return m_total; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the number of items loaded or failed.
+        **/
+        ////////////////////////////////////////////////////////////
+        size_t getDone() const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the number of items which failed.
+        **/
+        ////////////////////////////////////////////////////////////
+        size_t getFailed() const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the done part of the items, from 0 to 1.
+        **/
+        ////////////////////////////////////////////////////////////
+        Real getProgress() const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns true if every item is done, without
+         *  blocking.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool isFinished() const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the future of the item with given name, or
+         *  an invalid future.
+        **/
+        ////////////////////////////////////////////////////////////
+        ResourceFuture getFuture(const String& name) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Blocks until every item is done.
+         *  @note Returns at once if the preloader is not started.
+        **/
+        ////////////////////////////////////////////////////////////
+        void wait() const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Blocks until every item with at least given
+         *  priority is done.
+        **/
+        ////////////////////////////////////////////////////////////
+        void wait(int priority) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Blocks until every item with one of given names is
+         *  done.
+        **/
+        ////////////////////////////////////////////////////////////
+        void wait(const Array<String>& names) const;
+
+    protected:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Adds the item loaded by given future.
+        **/
+        ////////////////////////////////////////////////////////////
+        void _add(const String& name, int priority, const ResourceFuture& future);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Counts given request, and sends the events.
+        **/
+        ////////////////////////////////////////////////////////////
+        void _onLoaded(const ResourceRequest& request);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Creates the ResourcePreloadFinishedEvent.
+        **/
+        ////////////////////////////////////////////////////////////
+        EventLocalPtr createEvent(const HashType& e_type) const;
+    };
+
+    typedef AutoPointer<ResourcePreloader> ResourcePreloaderPtr;
+
+    APRO_DECLARE_EVENT_CONTENT(ResourcePreloadedEvent)
+        String name;   ///< Name of the entry.
+        bool   success;///< False if the resource can't be loaded.
+        size_t done;   ///< Number of items done, this one included.
+        size_t total;  ///< Number of items.
+
+        Prototype* clone() const {
+            ResourcePreloadedEvent* e = static_cast<ResourcePreloadedEvent*>(Event::clone());
+            e->name    = name;
+            e->success = success;
+            e->done    = done;
+            e->total   = total;
+            return e;
+        }
+    APRO_DECLARE_EVENT_CONTENT_END()
+
+    APRO_DECLARE_EVENT_NOCONTENT(ResourcePreloadFinishedEvent)
+}
+
+#endif // APRO_RESOURCEPRELOADER_H
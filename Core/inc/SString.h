@@ -36,6 +36,7 @@
 #include "Array.h"
 #include "List.h"
 #include "GenericHash.h"
+#include "StringView.h"
 
 namespace APro
 {
@@ -57,6 +58,8 @@ namespace APro
 
         Array<char> mstr;///< The string
 
+        friend class StringBuilder;
+
     public:
 
         ////////////////////////////////////////////////////////////
@@ -71,8 +74,20 @@ namespace APro
         **/
         ////////////////////////////////////////////////////////////
 		String(const char* str);
+
+        ////////////////////////////////////////////////////////////
+        /** Constructs the String from the sz first characters of
+         *  str, which does not need to be null-terminated.
+        **/
+        ////////////////////////////////////////////////////////////
         String(const char* str, size_t sz);
 
+        ////////////////////////////////////////////////////////////
+        /** Constructs the String by copying the viewed characters.
+        **/
+        ////////////////////////////////////////////////////////////
+        explicit String(const StringView& view);
+
         ////////////////////////////////////////////////////////////
         /** Copy constructor
         **/
@@ -107,6 +122,7 @@ namespace APro
         ////////////////////////////////////////////////////////////
         void append(char c);
         void append(const char* c);
+        void append(const char* c, size_t sz);
         void append(const String& c);
         void append(const Real& rhs);
         /** @} */
@@ -152,16 +168,39 @@ namespace APro
         ////////////////////////////////////////////////////////////
         void clear();
 
+        ////////////////////////////////////////////////////////////
+        /** @{
+         *  @brief Returns the index of the first or last occurence
+         *  of given character or String, or size() if not found.
+         *  @see StringSearch
+        **/
+        ////////////////////////////////////////////////////////////
         size_t findFirst(char c, size_t from = 0) const;
-        size_t findFirst(const String& str, size_t from = 0) const;
+        size_t findFirst(const StringView& str, size_t from = 0) const;
 
         size_t findLast(char c) const;
-        size_t findLast(const String& str) const;
+        size_t findLast(const StringView& str) const;
+        /** @} */
 
         /* Return the string[from, to). */
         String extract(size_t from, size_t to) const;
 
-        List<String> explode(const String & str) const;
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns a view on [from, to), as extract() does
+         *  but without copying anything.
+         *  @warning The view is invalidated when this String is
+         *  modified or destroyed.
+        **/
+        ////////////////////////////////////////////////////////////
+        StringView view(size_t from = 0, size_t to = (size_t) -1) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns a view on the whole String.
+        **/
+        ////////////////////////////////////////////////////////////
+        operator StringView () const { return StringView(toCstChar(), size()); }
+
+        List<String> explode(const StringView& str) const;
         List<String> explode(const char* str) const;
         List<String> explode(char c) const;
 
@@ -169,7 +208,7 @@ namespace APro
         void replace(const String& str, const String& to);
 
         bool match(char c) const;
-        bool match(const String& str) const;
+        bool match(const StringView& str) const;
 
         bool isEmpty() const;
         size_t size() const;
@@ -178,6 +178,14 @@ namespace APro
         /////////////////////////////////////////////////////////////
         virtual bool readInt(int& i) = 0;
 
+        /////////////////////////////////////////////////////////////
+        /** @brief Reads at most sz raw bytes.
+         *  @return The number of bytes read, which is less than sz
+         *  only at the end of the stream.
+        **/
+        /////////////////////////////////////////////////////////////
+        virtual size_t readBytes(Byte* bytes, size_t sz) = 0;
+
     };
 
     /////////////////////////////////////////////////////////////
@@ -241,6 +249,12 @@ namespace APro
         **/
         /////////////////////////////////////////////////////////////
         virtual bool write(const int& str) = 0;
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Writes sz raw bytes.
+        **/
+        /////////////////////////////////////////////////////////////
+        virtual bool writeBytes(const Byte* bytes, size_t sz) = 0;
     };
 }
 
@@ -0,0 +1,187 @@
+/////////////////////////////////////////////////////////////
+/** @file StringBuilder.h
+ *  @ingroup Global
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the StringBuilder class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_STRINGBUILDER_H
+#define APRO_STRINGBUILDER_H
+
+#include "Platform.h"
+#include "NonCopyable.h"
+#include "SString.h"
+
+namespace APro
+{
+    ////////////////////////////////////////////////////////////
+    /** @class StringBuilder
+     *  @ingroup Global
+     *  @brief Builds a long text from many small fragments.
+     *
+     *  The text is stored as a rope : a linked list of chunks of
+     *  at least ChunkSize characters. Appending copies the
+     *  fragment at the end of the last chunk, and never moves the
+     *  characters already written. Appending another StringBuilder
+     *  only links its chunks, whatever its size.
+     *
+     *  The text is flattened only once, by toString() or when
+     *  visiting the chunks with forEachChunk().
+     *  @code
+     *  StringBuilder doc;
+     *  doc << "Width : " << width << "\n";
+     *  String result = doc.toString();
+     *  @endcode
+     *
+     *  @note Use String for short texts which are modified, and
+     *  StringBuilder for logs and generated texts.
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL StringBuilder : public NonCopyable
+    {
+    public:
+
+        static const size_t ChunkSize = 4096 - 32;///< @brief Default minimum number of characters in a chunk.
+
+    private:
+
+        struct Chunk
+        {
+            Chunk* next;    ///< @brief Next chunk, or null if last.
+            size_t size;    ///< @brief Number of characters written.
+            size_t capacity;///< @brief Number of characters available.
+
+            char* data() { return (char*) (this + 1); }
+            const char* data() const { return (const char*) (this + 1); }
+        };
+
+        Chunk* mFirst;    ///< @brief First chunk.
+        Chunk* mLast;     ///< @brief Last chunk, where characters are appended.
+        size_t mSize;     ///< @brief Total number of characters.
+        size_t mChunkSize;///< @brief Minimum number of characters of a new chunk.
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Constructs an empty builder.
+         *  @param chunkSize : Minimum size of the allocated chunks.
+         *  Nothing is allocated before the first append.
+        **/
+        ////////////////////////////////////////////////////////////
+        StringBuilder(size_t chunkSize = ChunkSize);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Takes the chunks of another builder.
+        **/
+        ////////////////////////////////////////////////////////////
+        StringBuilder(StringBuilder&& rhs);
+
+        ~StringBuilder();
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the total number of characters.
+        **/
+        ////////////////////////////////////////////////////////////
+        size_t size() const { return mSize; }
+
+        bool isEmpty() const { return mSize == 0; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Releases every chunk.
+        **/
+        ////////////////////////////////////////////////////////////
+        void clear();
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @{
+         *  @brief Copies given characters at the end of the text.
+        **/
+        ////////////////////////////////////////////////////////////
+        void append(const char* str, size_t sz);
+        void append(const StringView& str) { append(str.data(), str.size()); }
+        void append(char c) { append(&c, 1); }
+        /** @} */
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Moves the chunks of rhs at the end of this text,
+         *  in constant time.
+         *
+         *  rhs is empty after this call.
+        **/
+        ////////////////////////////////////////////////////////////
+        void append(StringBuilder&& rhs);
+
+        StringBuilder& operator << (char c) { append(c); return *this; }
+        StringBuilder& operator << (const char* str) { append(StringView(str)); return *this; }
+        StringBuilder& operator << (const StringView& str) { append(str); return *this; }
+        StringBuilder& operator << (const String& str) { append(str.toCstChar(), str.size()); return *this; }
+        StringBuilder& operator << (StringBuilder&& rhs) { append(std::move(rhs)); return *this; }
+
+        ////////////////////////////////////////////////////////////
+        /** @{
+         *  @brief Appends given number.
+         *  @see NumberFormat::Format()
+        **/
+        ////////////////////////////////////////////////////////////
+        StringBuilder& operator << (int i);
+        StringBuilder& operator << (unsigned int u);
+        StringBuilder& operator << (long l);
+        StringBuilder& operator << (unsigned long ul);
+        StringBuilder& operator << (float r);
+        StringBuilder& operator << (double r);
+        /** @} */
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Flattens the text in a String, with only one
+         *  allocation.
+        **/
+        ////////////////////////////////////////////////////////////
+        String toString() const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Calls func with every chunk, in order.
+         *
+         *  This does not flatten the text, so it is the way to write
+         *  it to a file.
+        **/
+        ////////////////////////////////////////////////////////////
+        void forEachChunk(const std::function<void (const StringView&)>& func) const;
+
+    private:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Links a new chunk of at least sz characters.
+        **/
+        ////////////////////////////////////////////////////////////
+        Chunk* newChunk(size_t sz);
+    };
+}
+
+#endif // APRO_STRINGBUILDER_H
@@ -0,0 +1,102 @@
+/////////////////////////////////////////////////////////////
+/** @file StringSearch.h
+ *  @ingroup Global
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the search primitives used by String.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_STRINGSEARCH_H
+#define APRO_STRINGSEARCH_H
+
+#include "Platform.h"
+
+namespace APro
+{
+    ////////////////////////////////////////////////////////////
+    /** @namespace StringSearch
+     *  @ingroup Global
+     *  @brief Search primitives working on raw characters.
+     *
+     *  Every function works on a non null-terminated block of
+     *  characters, and returns the size of this block when nothing
+     *  is found, as String does.
+     *
+     *  When APRO_SIMD_AVX2 or APRO_SIMD_SSE2 is defined, substrings
+     *  are searched 32 or 16 positions at a time : the first and the
+     *  last character of the pattern are compared to the whole block,
+     *  and only positions matching both are verified with
+     *  memcmp(). Otherwise a scalar version is used.
+    **/
+    ////////////////////////////////////////////////////////////
+    namespace StringSearch
+    {
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the index of the first given character in
+         *  data, or sz.
+        **/
+        ////////////////////////////////////////////////////////////
+        APRO_DLL size_t FindChar(const char* data, size_t sz, char c);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the index of the last given character in
+         *  data, or sz.
+        **/
+        ////////////////////////////////////////////////////////////
+        APRO_DLL size_t FindLastChar(const char* data, size_t sz, char c);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the index of the first occurence of pattern
+         *  in data, or sz.
+         *  @note An empty pattern is never found.
+        **/
+        ////////////////////////////////////////////////////////////
+        APRO_DLL size_t Find(const char* data, size_t sz, const char* pattern, size_t psz);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the index of the last occurence of pattern
+         *  in data, or sz.
+         *  @note An empty pattern is never found.
+        **/
+        ////////////////////////////////////////////////////////////
+        APRO_DLL size_t FindLast(const char* data, size_t sz, const char* pattern, size_t psz);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Replaces every given character by another one in
+         *  data.
+         *  @return The number of characters replaced.
+        **/
+        ////////////////////////////////////////////////////////////
+        APRO_DLL size_t ReplaceChar(char* data, size_t sz, char from, char to);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief True for the ASCII letters, as isalpha() in the "C"
+         *  locale. Index it with an unsigned char.
+         *  @note Constant data : it can be used from any thread.
+        **/
+        ////////////////////////////////////////////////////////////
+        APRO_DLL extern const bool AlphaTable[256];
+    }
+}
+
+#endif // APRO_STRINGSEARCH_H
@@ -0,0 +1,188 @@
+/////////////////////////////////////////////////////////////
+/** @file StringView.h
+ *  @ingroup Global
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Defines the StringView class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#ifndef APRO_STRINGVIEW_H
+#define APRO_STRINGVIEW_H
+
+#include "Platform.h"
+#include "List.h"
+
+namespace APro
+{
+    ////////////////////////////////////////////////////////////
+    /** @class StringView
+     *  @ingroup Global
+     *  @brief A read-only view on characters owned by someone
+     *  else.
+     *
+     *  A StringView is only a pointer and a size. Slicing it with
+     *  extract() or explode() never copies any character, so it is
+     *  the type to use when parsing text.
+     *
+     *  Every String converts implicitly to a StringView, so read-only
+     *  functions should take a StringView instead of a String.
+     *  @code
+     *  String line("width = 800");
+     *  StringView key = line.view(0, line.findFirst('='));
+     *  @endcode
+     *
+     *  @warning A StringView does not own its characters : it must
+     *  not outlive the String (or buffer) it was made from, and is
+     *  invalidated when this String is modified. The characters are
+     *  also not null-terminated, use toString() to get a C-String.
+    **/
+    ////////////////////////////////////////////////////////////
+    class APRO_DLL StringView
+    {
+    private:
+
+        const char* mData;///< @brief Viewed characters.
+        size_t      mSize;///< @brief Number of viewed characters.
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Constructs an empty view.
+        **/
+        ////////////////////////////////////////////////////////////
+        StringView() : mData(""), mSize(0) {}
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Constructs a view on a null-terminated C-String.
+        **/
+        ////////////////////////////////////////////////////////////
+        StringView(const char* str);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Constructs a view on the sz first characters of
+         *  str.
+        **/
+        ////////////////////////////////////////////////////////////
+        StringView(const char* str, size_t sz) : mData(str), mSize(sz) {}
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns a pointer to the first character.
+         *  @note This is not a null-terminated C-String.
+        **/
+        ////////////////////////////////////////////////////////////
+        const char* data() const { return mData; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the number of characters.
+        **/
+        ////////////////////////////////////////////////////////////
+        size_t size() const { return mSize; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns true if there is no characters.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool isEmpty() const { return mSize == 0; }
+
+        const char& at(size_t index) const { return mData[index]; }
+        const char& operator [] (size_t index) const { return mData[index]; }
+
+        const char& first() const { return mData[0]; }
+        const char& last() const { return mData[mSize - 1]; }
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @{
+         *  @brief Returns the index of the first or last occurence
+         *  of given character or String, or size() if not found.
+         *  @see StringSearch
+        **/
+        ////////////////////////////////////////////////////////////
+        size_t findFirst(char c, size_t from = 0) const;
+        size_t findFirst(const StringView& str, size_t from = 0) const;
+
+        size_t findLast(char c) const;
+        size_t findLast(const StringView& str) const;
+        /** @} */
+
+        bool match(char c) const { return findFirst(c) != mSize; }
+        bool match(const StringView& str) const { return findFirst(str) != mSize; }
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns true if this view begins (or ends) with
+         *  given String.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool startsWith(const StringView& str) const;
+        bool endsWith(const StringView& str) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the view [from, to), without copying.
+        **/
+        ////////////////////////////////////////////////////////////
+        StringView extract(size_t from, size_t to) const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns this view without the leading and trailing
+         *  blank characters (spaces, tabulations and new lines).
+        **/
+        ////////////////////////////////////////////////////////////
+        StringView trimmed() const;
+
+        ////////////////////////////////////////////////////////////
+        /** @{
+         *  @brief Splits this view with given separator.
+         *  @note Only the List is allocated, every element is a view
+         *  on this view's characters.
+        **/
+        ////////////////////////////////////////////////////////////
+        List<StringView> explode(char c) const;
+        List<StringView> explode(const StringView& str) const;
+        /** @} */
+
+    public:
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Reads an integer or a real from the view.
+         *  @return 0 if the view does not begin with a number.
+         *  @see NumberFormat::Parse()
+        **/
+        ////////////////////////////////////////////////////////////
+        int  toInt() const;
+        Real toReal() const;
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Performs the same hash as String::hash().
+        **/
+        ////////////////////////////////////////////////////////////
+        HashType hash() const;
+    };
+
+    APRO_DLL bool operator == (const StringView& lhs, const StringView& rhs);
+    inline bool operator != (const StringView& lhs, const StringView& rhs) { return !(lhs == rhs); }
+}
+
+#endif // APRO_STRINGVIEW_H
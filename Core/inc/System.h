@@ -77,6 +77,34 @@ public:
 #   define APRO_ARCHITECTURE APRO_32
 #endif
 
+//----------------------------------------------//
+//              Instructions Sets               //
+//----------------------------------------------//
+
+// Those are set by the compiler depending on the target
+// processor (see the '--with-avx2' premake option). Every
+// function using them must have a scalar fallback.
+
+/** Defined if SSE2 instructions are available (always on x86_64). */
+#if defined(__SSE2__) || defined(_M_X64)
+#   define APRO_SIMD_SSE2
+#endif
+
+/** Defined if SSSE3 instructions are available. */
+#if defined(__SSSE3__)
+#   define APRO_SIMD_SSSE3
+#endif
+
+/** Defined if SSE4.2 instructions are available. */
+#if defined(__SSE4_2__)
+#   define APRO_SIMD_SSE42
+#endif
+
+/** Defined if AVX2 instructions are available. */
+#if defined(__AVX2__)
+#   define APRO_SIMD_AVX2
+#endif
+
 //----------------------------------------------//
 //              Compilators specs               //
 //----------------------------------------------//
@@ -68,6 +68,7 @@ namespace APro
         typedef void* apro_thread_t;  ///< Standard type for threads.
 
         String        m_name;      ///< Name of the thread.
+        Atom          m_atom;      ///< Interned name of the thread.
         apro_thread_t m_thread;    ///< Pointer Handle to the thread.
 
         MutexBool     m_started;   ///< Thread is started ?
@@ -131,6 +132,12 @@ namespace APro
         ////////////////////////////////////////////////////////////
         const String& getName() const;
 
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the interned name of the Thread.
+        **/
+        ////////////////////////////////////////////////////////////
+        const Atom& getAtom() const;
+
         ////////////////////////////////////////////////////////////
         /** @brief Set the callback to call during the Running process.
          *
@@ -34,6 +34,7 @@
 #include "Platform.h"
 #include "Array.h"
 #include "Singleton.h"
+#include "Atom.h"
 
 #include "ThreadMutex.h"
 #include "ThreadCondition.h"
@@ -127,6 +128,27 @@ namespace APro
         ////////////////////////////////////////////////////////////
         void destroyThread(const String& name);
 
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns a new thread with given interned name.
+        **/
+        ////////////////////////////////////////////////////////////
+        ThreadPtr createThread(const Atom& name);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the thread that have given interned name
+         *  if exists, or null.
+         *  @note Threads are compared by their Atom, so no String
+         *  comparison is done.
+        **/
+        ////////////////////////////////////////////////////////////
+        ThreadPtr getThread(const Atom& name);
+
+        ////////////////////////////////////////////////////////////
+        /** @brief Destroys the thread that have given interned name.
+        **/
+        ////////////////////////////////////////////////////////////
+        void destroyThread(const Atom& name);
+
     public:
 
         ////////////////////////////////////////////////////////////
@@ -50,19 +50,29 @@ namespace APro
     /** @class Token
      *  @ingroup Utils
      *  @brief A generic Token class used by the Token Scanner.
+     *
+     *  A Token created from a StringView only keeps the view on the
+     *  scanned input : its content String is built the first time
+     *  getContent() is called. Use getView() to read the Token
+     *  without any allocation.
+     *
+     *  @warning A viewed Token must not outlive its TokenScanner.
      **/
     ////////////////////////////////////////////////////////////
     class Token : public Swappable<Token>
     {
     private:
         
-        int         type;       ///< @brief The Token's type.
-        String      content;    ///< @brief The content of this token.
-        TokPosition position;   ///< @brief Position of the Token in the stream.
+        int            type;       ///< @brief The Token's type.
+        mutable String content;    ///< @brief The content of this token.
+        StringView     view;       ///< @brief View on the scanned input, if content is not built yet.
+        mutable bool   viewed;     ///< @brief True if the content is still the view.
+        TokPosition    position;   ///< @brief Position of the Token in the stream.
         
     public:
         
         Token (int tp, const String& cont, const TokPosition& pos);
+        Token (int tp, const StringView& cont, const TokPosition& pos);
         Token (const Token& tok);
         
         Token (Token&& tok);
@@ -87,13 +97,20 @@ namespace APro
         /** @brief Returns the content (or value) as a String.
         **/
         /////////////////////////////////////////////////////////////
-        String& getContent() { return content; }
+        String& getContent() { buildContent(); return content; }
         
         /////////////////////////////////////////////////////////////
         /** @brief Returns the content (or value) as a String.
         **/
         /////////////////////////////////////////////////////////////
-        const String& getContent() const { return content; }
+        const String& getContent() const { buildContent(); return content; }
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Returns the content (or value) as a StringView.
+         *  @note This never allocates anything.
+        **/
+        /////////////////////////////////////////////////////////////
+        StringView getView() const { return viewed ? view : StringView(content); }
         
         /////////////////////////////////////////////////////////////
         /** @brief Returns the position of the Token in the stream.
@@ -108,6 +125,15 @@ namespace APro
         };
         
         static Token Invalid; ///< @brief An invalid Token. (Type is TypeInvalid)
+
+    private:
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Copies the view to the content String, if not done
+         *  yet.
+        **/
+        /////////////////////////////////////////////////////////////
+        void buildContent() const;
     };
     
     typedef Array<Token> TokenArray;
@@ -122,7 +148,8 @@ namespace APro
     {
     protected:
         
-        String  input;              ///< @brief Given string.
+        String  input;              ///< @brief Given string, if copied.
+        StringView inputView;       ///< @brief Scanned characters : input, or a view given by the user.
         int     inputLenght;        ///< @brief Lenght of the input.
         int     currentCharacter;   ///< @brief Current character position.
         int     currentToken;       ///< @brief Current token position.
@@ -136,6 +163,15 @@ namespace APro
     public:
         
         TokenScanner (const String& str);
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Scans given characters without copying them, as a
+         *  FileMapping::view().
+         *  @note The viewed characters must stay valid as long as the
+         *  scanner and its Tokens are used.
+        **/
+        /////////////////////////////////////////////////////////////
+        TokenScanner (const StringView& view);
         virtual ~TokenScanner ();
         
     protected:
@@ -194,6 +230,13 @@ namespace APro
         **/
         /////////////////////////////////////////////////////////////
         void checkNewLine();
+
+        /////////////////////////////////////////////////////////////
+        /** @brief Returns a view on the input characters [first, last),
+         *  to create a Token without copying its content.
+        **/
+        /////////////////////////////////////////////////////////////
+        StringView getInputView(int first, int last) const;
         
     public:
         
@@ -81,6 +81,14 @@ namespace APro
         template <typename T>
         APRO_DLL bool IsCopyConstructible() { return std::is_copy_constructible<T>::value; }
 
+        ////////////////////////////////////////////////////////////
+        /** @brief Tell if a Type is a fundamental type (integer,
+         *  floating point, char...), which can be copied as bytes.
+        **/
+        ////////////////////////////////////////////////////////////
+        template <typename T>
+        APRO_DLL bool IsFundamental() { return std::is_fundamental<T>::value; }
+
         ////////////////////////////////////////////////////////////
         /** @brief Tell if a Type is a class.
         **/
@@ -109,6 +109,41 @@ namespace APro
         
         /// @brief Convert given CodePoint to char, and returns the valid char used.
         static int toChar(char* ret , const CodePoint& cp);
+        
+        /// @brief Returns the number of octets in the sequence beginning with given first octet.
+        /// @note The octet must begin a valid sequence.
+        static size_t GetSequenceSize(Octet first);
+        
+        /// @brief Decodes the valid sequence beginning at data.
+        static CodePoint DecodeSequence(const Octet* data);
+        
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the number of octets at the beginning of
+         *  data forming valid UTF-8 sequences.
+         *
+         *  This is sz if the whole data is valid, or the index of the
+         *  first invalid (or truncated) sequence. Overlong forms,
+         *  surrogates and code points above U+10FFFF are invalid.
+         *
+         *  When APRO_SIMD_AVX2 or APRO_SIMD_SSSE3 is defined, 32 or 16
+         *  octets are validated at a time with a lookup of the two
+         *  octets before each position. With only APRO_SIMD_SSE2,
+         *  ASCII blocks are skipped 16 octets at a time.
+        **/
+        ////////////////////////////////////////////////////////////
+        static size_t Validate(const Octet* data, size_t sz);
+        
+        /// @brief Returns the number of CodePoints in valid UTF-8 data.
+        static size_t CountCodePoints(const Octet* data, size_t sz);
+        
+        ////////////////////////////////////////////////////////////
+        /** @brief Decodes valid UTF-8 data to CodePoints.
+         *  @param out : Must be able to store CountCodePoints(data, sz)
+         *  CodePoints.
+         *  @return The number of CodePoints written.
+        **/
+        ////////////////////////////////////////////////////////////
+        static size_t Decode(const Octet* data, size_t sz, CodePoint* out);
         /// @brief Convert given hexadecimal string to CodePoint.
         static CodePoint fromStr(const char* str);
         
@@ -128,47 +163,100 @@ namespace APro
      *  @ingroup Global
      *  @brief Defines an UTF8 encoded String.
      *
-     *  The UTF8String class is constitued with a simple array of
-     *  codepoints (cp) , designating the sentence cp by cp. 
-     *  This method allows us to have fast managing of the sentence, 
-     *  but the disadvantage here is that an UTF8 string take 4 times
-     *  more memory than an ASCII string (as a cp is 4 char). 
+     *  The UTF8String class stores its sentence as UTF-8 octets,
+     *  exactly as they are in a file : an ASCII character takes only
+     *  one octet, and loading a file only needs to validate it.
+     *
+     *  Iterating over the String decodes one CodePoint at a time.
+     *  Random access with at() uses a sparse index, holding the
+     *  offset of every IndexStride CodePoints. It is built on the
+     *  first at() call after a modification, so at() costs at most
+     *  IndexStride steps.
      *
      *  @note Read/Write functions
      *  You can use the File IO functions to read/write to a file.
      *  We advice you to add a correct BOM at the beginning of every 
      *  UTF8 file.
+     *
+     *  @note The index is built in const functions, so a String
+     *  must not be read by several threads before calling at()
+     *  once.
     **/
     ////////////////////////////////////////////////////////////
     class APRO_DLL UTF8String
     {
     private:
         
-        Array<UTF8Char::CodePoint> mdata;///< The string data.
+        Array<UTF8Char::Octet> mdata;   ///< The string data, always valid UTF-8 and not null-terminated.
+        size_t                 mlength; ///< Number of CodePoints.
+        
+        mutable Array<size_t>  mindex;  ///< Offset of every IndexStride CodePoints.
+        mutable bool           mindexed;///< True if mindex is up to date.
+        
+    public:
+        
+        static const size_t IndexStride = 32;///< Number of CodePoints between two index entries.
+        
+        ////////////////////////////////////////////////////////////
+        /** @brief Iterates over the CodePoints of the String.
+         *  @note CodePoints can't be modified through it, as their
+         *  size may change.
+        **/
+        ////////////////////////////////////////////////////////////
+        class const_iterator
+        {
+        private:
+            
+            const UTF8Char::Octet* mptr;
+            
+        public:
+            
+            const_iterator(const UTF8Char::Octet* ptr = nullptr) : mptr(ptr) {}
+            
+            UTF8Char::CodePoint operator * () const { return UTF8Char::DecodeSequence(mptr); }
+            
+            const_iterator& operator ++ () { mptr += UTF8Char::GetSequenceSize(*mptr); return *this; }
+            const_iterator  operator ++ (int) { const_iterator tmp(*this); ++(*this); return tmp; }
+            
+            bool operator == (const const_iterator& rhs) const { return mptr == rhs.mptr; }
+            bool operator != (const const_iterator& rhs) const { return mptr != rhs.mptr; }
+            
+            /// @brief Returns the first octet of the current CodePoint.
+            const UTF8Char::Octet* pointer() const { return mptr; }
+        };
+        
+        typedef const_iterator iterator;
         
     public:
         
         UTF8String ();
         UTF8String (const UTF8String& str);
         UTF8String (UTF8String&& str);
-
+        
+        UTF8String& operator = (const UTF8String& str);
 
 	public:
         
-        size_t size() const { return mdata.size() - 1; }
-        bool isEmpty() const { return size() == 0; }
+        /// @brief Returns the number of CodePoints.
+        size_t size() const { return mlength; }
+        bool isEmpty() const { return mlength == 0; }
         
-        typedef Array<UTF8Char::CodePoint>::iterator iterator;
-        typedef Array<UTF8Char::CodePoint>::const_iterator const_iterator;
+        /// @brief Returns the number of octets.
+        size_t byteSize() const { return mdata.size(); }
         
-        iterator begin() { return mdata.begin(); }
-        const_iterator begin() const { mdata.begin(); }
+        /// @brief Returns the UTF-8 octets. They are not null-terminated.
+        const UTF8Char::Octet* data() const { return mdata.pointer(); }
         
-        iterator end() { return mdata.end(); }
-        const_iterator end() const { return mdata.end(); }
+        const_iterator begin() const { return const_iterator(mdata.pointer()); }
+        const_iterator end() const { return const_iterator(mdata.pointer() + mdata.size()); }
         
-        iterator last() { return mdata.last(); }
-        const_iterator last() const { return mdata.last(); }
+        ////////////////////////////////////////////////////////////
+        /** @brief Returns the CodePoint at given index, or
+         *  UTF8Char::CPInvalid if out of range.
+        **/
+        ////////////////////////////////////////////////////////////
+        UTF8Char::CodePoint at(size_t index) const;
+        UTF8Char::CodePoint operator [] (size_t index) const { return at(index); }
         
     public:
         
@@ -179,18 +267,46 @@ namespace APro
         void append (const UTF8Char::CodePoint& cp);
         void push_back (const UTF8Char::CodePoint& cp) { append(cp); }
         
+        ////////////////////////////////////////////////////////////
+        /** @brief Appends UTF-8 octets, after validating them.
+         *  @return false, and appends nothing, if data is not valid.
+        **/
+        ////////////////////////////////////////////////////////////
+        bool appendUtf8 (const UTF8Char::Octet* data, size_t sz);
+        
         void prepend (const UTF8String& str);
         void push_front (const UTF8String& str) { prepend(str); }
         
         void clear();
-        void erase(iterator beg, const_iterator e = nullptr);
         
-        void insert(const UTF8Char::CodePoint& cp, const_iterator);
+        ////////////////////////////////////////////////////////////
+        /** @brief Erases the CodePoints [beg, e). If e is null, erases
+         *  to the end of the String.
+        **/
+        ////////////////////////////////////////////////////////////
+        void erase(const_iterator beg, const_iterator e = nullptr);
+        
+        void insert(const UTF8Char::CodePoint& cp, const_iterator before);
         
     public:
         
         static UTF8String fromAscii (const char* str);
+        
+        ////////////////////////////////////////////////////////////
+        /** @brief Creates a String from null-terminated UTF-8 data.
+         *  @note Only the valid beginning of data is kept.
+        **/
+        ////////////////////////////////////////////////////////////
         static UTF8String fromUtf8Data(const UTF8Char::Octet* data);
+        static UTF8String fromUtf8Data(const UTF8Char::Octet* data, size_t sz);
+        
+    private:
+        
+        /// @brief Replaces the data by given one, assumed valid.
+        void assign(Array<UTF8Char::Octet>& data);
+        
+        /// @brief Builds the sparse index.
+        void buildIndex() const;
     };
 }
 
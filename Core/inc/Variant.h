@@ -17,6 +17,7 @@
 #include "Platform.h"
 #include "SString.h"
 #include "Maths.h"
+#include "Exception.h"
 
 namespace APro
 {
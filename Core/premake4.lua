@@ -76,31 +76,57 @@ newoption {
 	description	= "Disable multithreading support. Use it when your platform doesn't have the 'pthread' library."
 }
 
-solution "aproe"
-	configurations { "Debug", "Release" }
-	
-project("core")
-	kind "SharedLib"
-	includedirs { "inc", "src" }
-	targetdir "bin"
+--[[
+Option  : --with-avx2
+Summary : Compiles the Engine for processors supporting the AVX2 instructions set. String
+          search primitives use it instead of SSE2. The library will not run on older
+          processors.
+See     :
+--]]
+newoption {
+	trigger 	= "with-avx2",
+	description	= "Enable AVX2 instructions in the Engine. Produced library needs an AVX2 processor."
+}
 
-	language "c++"
-	files { "inc/*.h", "src/*.cpp" };
-	defines { "__builddll__" }
+--[[
+Option  : --with-sse42
+Summary : Compiles the Engine for processors supporting the SSE4.2 instructions set. The
+          CRC-32C checksum uses the crc32 instruction instead of tables. Implied by
+          --with-avx2.
+See     : --with-avx2
+--]]
+newoption {
+	trigger 	= "with-sse42",
+	description	= "Enable SSE4.2 instructions in the Engine. Produced library needs an SSE4.2 processor."
+}
 
+--[[
+Option  : --with-io-uring
+Summary : Linux only. The AsyncIO service submits requests to an io_uring instead of using
+          a thread pool. The thread pool is still used when the kernel doesn't support it.
+See     : --no-thread
+--]]
+newoption {
+	trigger 	= "with-io-uring",
+	description	= "Use io_uring for asynchronous I/O on Linux, when the kernel supports it."
+}
+
+--[[
+Function : EngineConfigurations
+Summary  : Platform, option and thread configurations shared by the core library and the
+           tools linking it, so every project is built with the same defines.
+--]]
+function EngineConfigurations()
 	configuration "windows"
 		defines {"__windows__"}
-		links {"shlwapi", "userenv", "kernel32"}
-	
+
 	configuration "linux"
 		defines {"__linux__"}
 		defines {"_HAVE_POSIX_"}
-		links {"dl"}
 
 	configuration "macosx"
 		defines {"__macosx__"}
 		defines {"_HAVE_POSIX_"}
-		links {"dl"}
 
 	configuration "with-exceptions"
 		defines {"_HAVE_EXCEPTIONS_"}
@@ -121,11 +147,46 @@ project("core")
 
 	configuration "double-angle"
 		defines {"_USE_DOUBLEANGLE_"}
-	
+
+	configuration "with-avx2"
+		buildoptions { "-mavx2" }
+
+	configuration "with-sse42"
+		buildoptions { "-msse4.2" }
+
+	configuration { "linux", "with-io-uring" }
+		defines {"_HAVE_IO_URING_"}
+
 	configuration "not no-thread"
 		defines {"_COMPILE_WITH_PTHREAD_"}
-		links   {"pthread"}
 		defines {"_REENTRANT"}
+end
+
+solution "aproe"
+	configurations { "Debug", "Release" }
+	
+project("core")
+	kind "SharedLib"
+	includedirs { "inc", "src" }
+	targetdir "bin"
+
+	language "c++"
+	files { "inc/*.h", "src/*.cpp" };
+	defines { "__builddll__" }
+
+	EngineConfigurations()
+
+	configuration "windows"
+		links {"shlwapi", "userenv", "kernel32"}
+
+	configuration "linux"
+		links {"dl"}
+
+	configuration "macosx"
+		links {"dl"}
+
+	configuration "not no-thread"
+		links {"pthread"}
 
 	configuration "debug"
 		defines {"_HAVE_DEBUG_MODE_"}
@@ -142,3 +203,149 @@ project("core")
 		objdir "obj_release"
 		targetname "aproe_core";
 		targetdir "bin/release";
+
+--[[
+Project : packer
+Summary : Command-line tool building a ResourcePack from a directory.
+          Usage : packer [-a alignment] [-c] <directory> <pack>
+--]]
+project("packer")
+	kind "ConsoleApp"
+	includedirs { "inc" }
+	targetdir "bin"
+
+	language "c++"
+	files { "tools/packer/*.cpp" };
+	links { "core" }
+
+	EngineConfigurations()
+
+	configuration "debug"
+		defines {"_HAVE_DEBUG_MODE_"}
+		flags "Symbols"
+		objdir "obj_debug/packer"
+		targetdir "bin/debug";
+
+	configuration "release"
+		flags {"OptimizeSpeed"};
+		buildoptions { "-std=c++11" }
+		objdir "obj_release/packer"
+		targetdir "bin/release";
+
+--[[
+Project : stringbench
+Summary : Command-line tool checking the StringSearch primitives against naive versions,
+          and measuring their speed in GB/s.
+          Usage : stringbench [size in MB]
+--]]
+project("stringbench")
+	kind "ConsoleApp"
+	includedirs { "inc" }
+	targetdir "bin"
+
+	language "c++"
+	files { "tools/stringbench/*.cpp" };
+	links { "core" }
+
+	EngineConfigurations()
+
+	configuration "debug"
+		defines {"_HAVE_DEBUG_MODE_"}
+		flags "Symbols"
+		objdir "obj_debug/stringbench"
+		targetdir "bin/debug";
+
+	configuration "release"
+		flags {"OptimizeSpeed"};
+		buildoptions { "-std=c++11" }
+		objdir "obj_release/stringbench"
+		targetdir "bin/release";
+
+--[[
+Project : numberbench
+Summary : Command-line tool checking that NumberFormat reals read back to the same value,
+          and measuring its speed against snprintf() and strtod().
+          Usage : numberbench [count]
+--]]
+project("numberbench")
+	kind "ConsoleApp"
+	includedirs { "inc" }
+	targetdir "bin"
+
+	language "c++"
+	files { "tools/numberbench/*.cpp" };
+	links { "core" }
+
+	EngineConfigurations()
+
+	configuration "debug"
+		defines {"_HAVE_DEBUG_MODE_"}
+		flags "Symbols"
+		objdir "obj_debug/numberbench"
+		targetdir "bin/debug";
+
+	configuration "release"
+		flags {"OptimizeSpeed"};
+		buildoptions { "-std=c++11" }
+		objdir "obj_release/numberbench"
+		targetdir "bin/release";
+
+--[[
+Project : checksumbench
+Summary : Command-line tool measuring the speed of the CheckSum implementations, in GB/s.
+          Usage : checksumbench [size in MB]
+--]]
+project("checksumbench")
+	kind "ConsoleApp"
+	includedirs { "inc" }
+	targetdir "bin"
+
+	language "c++"
+	files { "tools/checksumbench/*.cpp" };
+	links { "core" }
+
+	EngineConfigurations()
+
+	configuration "debug"
+		defines {"_HAVE_DEBUG_MODE_"}
+		flags "Symbols"
+		objdir "obj_debug/checksumbench"
+		targetdir "bin/debug";
+
+	configuration "release"
+		flags {"OptimizeSpeed"};
+		buildoptions { "-std=c++11" }
+		objdir "obj_release/checksumbench"
+		targetdir "bin/release";
+
+--[[
+Project : resourcetest
+Summary : Command-line tool checking that the ResourceManager loads an entry once when several
+          requests ask for it at once.
+          Usage : resourcetest
+--]]
+project("resourcetest")
+	kind "ConsoleApp"
+	includedirs { "inc" }
+	targetdir "bin"
+
+	language "c++"
+	files { "tools/resourcetest/*.cpp" };
+	links { "core" }
+
+	EngineConfigurations()
+
+	configuration "linux"
+		links {"pthread"}
+
+	configuration "debug"
+		defines {"_HAVE_DEBUG_MODE_"}
+		flags "Symbols"
+		objdir "obj_debug/resourcetest"
+		targetdir "bin/debug";
+
+	configuration "release"
+		flags {"OptimizeSpeed"};
+		buildoptions { "-std=c++11" }
+		objdir "obj_release/resourcetest"
+		targetdir "bin/release";
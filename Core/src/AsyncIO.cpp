@@ -0,0 +1,752 @@
+/////////////////////////////////////////////////////////////
+/** @file AsyncIO.cpp
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the AsyncIO service, the IORequest and IOFuture classes.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "AsyncIO.h"
+#include "Thread.h"
+#include "Console.h"
+
+#include <cerrno>
+#include <cstring>
+
+#if APRO_PLATFORM != APRO_WINDOWS
+#   include <unistd.h>
+#   include <sys/uio.h>
+#endif
+
+#ifdef _HAVE_IO_URING_
+#   include <sys/mman.h>
+#   include <sys/syscall.h>
+#   include <linux/io_uring.h>
+#endif
+
+namespace APro
+{
+    IORequest::IORequest()
+        : operation(Read), handle(0), offset(0), buffer(nullptr), size(0), next(nullptr),
+          done(false), refs(1)
+    {
+        result.success = false;
+        result.size    = 0;
+        result.error   = 0;
+    }
+
+    void IORequest::retain()
+    {
+        mutex.lock();
+        refs++;
+        mutex.unlock();
+    }
+
+    void IORequest::release()
+    {
+        mutex.lock();
+        bool last = --refs == 0;
+        mutex.unlock();
+
+        if(last)
+        {
+            IORequest* _this = this;
+            AProDelete(_this);
+        }
+    }
+
+    void IORequest::complete(size_t transferred, int err)
+    {
+        result.success = err == 0 && transferred == size;
+        result.size    = transferred;
+        result.error   = err;
+
+        if(callback)
+            callback(result);
+
+        mutex.lock();
+        done = true;
+        condition.signalAll();
+        mutex.unlock();
+    }
+
+    IOFuture::IOFuture()
+        : m_request(nullptr)
+    {
+
+    }
+
+    IOFuture::IOFuture(IORequest* request)
+        : m_request(request)
+    {
+
+    }
+
+    IOFuture::IOFuture(const IOFuture& rhs)
+        : m_request(rhs.m_request)
+    {
+        if(m_request)
+            m_request->retain();
+    }
+
+    IOFuture& IOFuture::operator = (const IOFuture& rhs)
+    {
+        if(rhs.m_request)
+            rhs.m_request->retain();
+        if(m_request)
+            m_request->release();
+
+        m_request = rhs.m_request;
+        return *this;
+    }
+
+    IOFuture::~IOFuture()
+    {
+        if(m_request)
+            m_request->release();
+    }
+
+    bool IOFuture::isReady() const
+    {
+        if(!m_request)
+            return false;
+
+        m_request->mutex.lock();
+        bool ret = m_request->done;
+        m_request->mutex.unlock();
+        return ret;
+    }
+
+    const IOResult& IOFuture::wait() const
+    {
+        static const IOResult Invalid = { false, 0, EINVAL };
+        if(!m_request)
+            return Invalid;
+
+        m_request->mutex.lock();
+        while(!m_request->done)
+            m_request->condition.wait(&m_request->mutex);
+        m_request->mutex.unlock();
+
+        return m_request->result;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /** @brief Completes a request and drops the reference of the
+     *  service.
+    **/
+    ////////////////////////////////////////////////////////////
+    static void Finish(IORequest* request, size_t transferred, int error)
+    {
+        request->complete(transferred, error);
+        request->release();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /** @brief Completes coalesced requests after a vectored
+     *  system call transferred given number of bytes.
+     *
+     *  Requests which were not fully served are finished with
+     *  positional calls.
+    **/
+    ////////////////////////////////////////////////////////////
+    static void FinishBatch(IORequest** batch, size_t count, size_t transferred)
+    {
+        for(size_t i = 0; i < count; ++i)
+        {
+            IORequest* request = batch[i];
+            size_t got = transferred < request->size ? transferred : request->size;
+            transferred -= got;
+
+            int error = 0;
+            if(got < request->size)
+                got += AsyncIO::Transfer(request, got, error);
+
+            Finish(request, got, error);
+        }
+    }
+
+    class IOWorkerThread : public Thread
+    {
+    public:
+
+        IOWorkerThread(AsyncIO* service)
+            : Thread(String("AsyncIO Worker")), m_service(service)
+        {
+
+        }
+
+        void exec()
+        {
+            IORequest* batch[AsyncIO::MaxCoalesced];
+            size_t count;
+
+            while((count = m_service->take(batch)) != 0)
+                AsyncIO::Execute(batch, count);
+        }
+
+    private:
+
+        AsyncIO* m_service;
+    };
+
+#ifdef _HAVE_IO_URING_
+
+    ////////////////////////////////////////////////////////////
+    /** @class IOUringThread
+     *  @brief Submits the requests to an io_uring, and harvests
+     *  their completions.
+     *
+     *  Each taken batch of coalesced requests uses one entry of
+     *  the ring. The rings are used directly with the system calls,
+     *  so it doesn't need liburing.
+    **/
+    ////////////////////////////////////////////////////////////
+    class IOUringThread : public Thread
+    {
+    private:
+
+        struct Batch
+        {
+            IORequest*   requests[AsyncIO::MaxCoalesced];
+            struct iovec iovecs[AsyncIO::MaxCoalesced];
+            size_t       count;
+        };
+
+        AsyncIO*        m_service;
+        int             m_fd;       ///< Ring file descriptor, or -1.
+        unsigned        m_entries;  ///< Number of submission entries.
+
+        void*           m_sq_ptr;
+        size_t          m_sq_size;
+        void*           m_cq_ptr;
+        size_t          m_cq_size;
+        io_uring_sqe*   m_sqes;
+        unsigned*       m_sq_tail;
+        unsigned*       m_sq_head;
+        unsigned*       m_sq_mask;
+        unsigned*       m_sq_array;
+        unsigned*       m_cq_head;
+        unsigned*       m_cq_tail;
+        unsigned*       m_cq_mask;
+        io_uring_cqe*   m_cqes;
+
+        Batch*          m_batches;  ///< One batch per submission entry.
+        unsigned*       m_free;     ///< Stack of unused batches.
+        unsigned        m_free_count;
+
+    public:
+
+        IOUringThread(AsyncIO* service, unsigned entries)
+            : Thread(String("AsyncIO io_uring")), m_service(service), m_fd(-1), m_entries(0),
+              m_sq_ptr(MAP_FAILED), m_sq_size(0), m_cq_ptr(MAP_FAILED), m_cq_size(0), m_sqes((io_uring_sqe*) MAP_FAILED),
+              m_batches(nullptr), m_free(nullptr), m_free_count(0)
+        {
+            io_uring_params params;
+            memset(&params, 0, sizeof(params));
+
+            m_fd = (int) syscall(__NR_io_uring_setup, entries, &params);
+            if(m_fd < 0)
+            {
+                m_fd = -1;
+                return;
+            }
+
+            m_entries = params.sq_entries;
+
+            m_sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            m_cq_size = params.cq_off.cqes  + params.cq_entries * sizeof(io_uring_cqe);
+            if(params.features & IORING_FEAT_SINGLE_MMAP)
+            {
+                if(m_cq_size > m_sq_size)
+                    m_sq_size = m_cq_size;
+                m_cq_size = 0;
+            }
+
+            m_sq_ptr = mmap(nullptr, m_sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQ_RING);
+            if(m_sq_ptr == MAP_FAILED)
+            {
+                destroy();
+                return;
+            }
+
+            if(m_cq_size)
+            {
+                m_cq_ptr = mmap(nullptr, m_cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_CQ_RING);
+                if(m_cq_ptr == MAP_FAILED)
+                {
+                    destroy();
+                    return;
+                }
+            }
+
+            m_sqes = (io_uring_sqe*) mmap(nullptr, params.sq_entries * sizeof(io_uring_sqe), PROT_READ | PROT_WRITE,
+                                          MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQES);
+            if(m_sqes == MAP_FAILED)
+            {
+                destroy();
+                return;
+            }
+
+            char* sq = (char*) m_sq_ptr;
+            char* cq = m_cq_size ? (char*) m_cq_ptr : sq;
+            m_sq_head  = (unsigned*) (sq + params.sq_off.head);
+            m_sq_tail  = (unsigned*) (sq + params.sq_off.tail);
+            m_sq_mask  = (unsigned*) (sq + params.sq_off.ring_mask);
+            m_sq_array = (unsigned*) (sq + params.sq_off.array);
+            m_cq_head  = (unsigned*) (cq + params.cq_off.head);
+            m_cq_tail  = (unsigned*) (cq + params.cq_off.tail);
+            m_cq_mask  = (unsigned*) (cq + params.cq_off.ring_mask);
+            m_cqes     = (io_uring_cqe*) (cq + params.cq_off.cqes);
+
+            m_batches = (Batch*) AProAllocate(sizeof(Batch) * m_entries);
+            m_free    = (unsigned*) AProAllocate(sizeof(unsigned) * m_entries);
+            for(unsigned i = 0; i < m_entries; ++i)
+                m_free[i] = m_entries - i - 1;
+            m_free_count = m_entries;
+        }
+
+        ~IOUringThread()
+        {
+            destroy();
+        }
+
+        bool isValid() const { return m_fd >= 0; }
+
+        void exec()
+        {
+            unsigned inflight = 0;///< Entries consumed by the kernel and not completed.
+            unsigned pending  = 0;///< Entries not yet consumed by the kernel.
+
+            for(;;)
+            {
+                // Only blocks on the queue when nothing is in the ring,
+                // else completions are waited for.
+                while(m_free_count)
+                {
+                    Batch& batch = m_batches[m_free[m_free_count - 1]];
+                    batch.count = m_service->take(batch.requests, inflight + pending == 0);
+                    if(!batch.count)
+                        break;
+
+                    m_free_count--;
+                    push(batch);
+                    pending++;
+                }
+
+                if(inflight + pending == 0)
+                    break;
+
+                int ret = (int) syscall(__NR_io_uring_enter, m_fd, pending, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+                if(ret < 0)
+                {
+                    if(errno != EINTR && errno != EAGAIN && errno != EBUSY)
+                        aprodebug("io_uring_enter failed (errno ") << (int) errno << ").";
+                    ret = 0;
+                }
+
+                pending  -= (unsigned) ret;
+                inflight += (unsigned) ret;
+                inflight -= harvest();
+            }
+        }
+
+    private:
+
+        void push(Batch& batch)
+        {
+            IORequest* first = batch.requests[0];
+            for(size_t i = 0; i < batch.count; ++i)
+            {
+                batch.iovecs[i].iov_base = batch.requests[i]->buffer;
+                batch.iovecs[i].iov_len  = batch.requests[i]->size;
+            }
+
+            unsigned tail  = *m_sq_tail;
+            unsigned index = tail & *m_sq_mask;
+
+            io_uring_sqe* sqe = &m_sqes[index];
+            memset(sqe, 0, sizeof(io_uring_sqe));
+            sqe->opcode    = first->operation == IORequest::Read ? IORING_OP_READV : IORING_OP_WRITEV;
+            sqe->fd        = first->handle;
+            sqe->off       = first->offset;
+            sqe->addr      = (unsigned long) batch.iovecs;
+            sqe->len       = (unsigned) batch.count;
+            sqe->user_data = (unsigned long) (&batch - m_batches);
+
+            m_sq_array[index] = index;
+            __atomic_store_n(m_sq_tail, tail + 1, __ATOMIC_RELEASE);
+        }
+
+        unsigned harvest()
+        {
+            unsigned count = 0;
+            unsigned head  = *m_cq_head;
+            unsigned tail  = __atomic_load_n(m_cq_tail, __ATOMIC_ACQUIRE);
+
+            while(head != tail)
+            {
+                io_uring_cqe* cqe = &m_cqes[head & *m_cq_mask];
+                unsigned index = (unsigned) cqe->user_data;
+                int res = cqe->res;
+                head++;
+                __atomic_store_n(m_cq_head, head, __ATOMIC_RELEASE);
+
+                Batch& batch = m_batches[index];
+                if(res < 0 && batch.count == 1)
+                    Finish(batch.requests[0], 0, -res);
+                else
+                    FinishBatch(batch.requests, batch.count, res < 0 ? 0 : (size_t) res);
+
+                m_free[m_free_count++] = index;
+                count++;
+            }
+
+            return count;
+        }
+
+        void destroy()
+        {
+            if(m_sqes != MAP_FAILED)
+                munmap(m_sqes, m_entries * sizeof(io_uring_sqe));
+            if(m_cq_ptr != MAP_FAILED)
+                munmap(m_cq_ptr, m_cq_size);
+            if(m_sq_ptr != MAP_FAILED)
+                munmap(m_sq_ptr, m_sq_size);
+            if(m_fd >= 0)
+                close(m_fd);
+            if(m_batches)
+                AProDeallocate(m_batches);
+            if(m_free)
+                AProDeallocate(m_free);
+
+            m_sqes    = (io_uring_sqe*) MAP_FAILED;
+            m_cq_ptr  = MAP_FAILED;
+            m_sq_ptr  = MAP_FAILED;
+            m_fd      = -1;
+            m_batches = nullptr;
+            m_free    = nullptr;
+        }
+    };
+
+#endif // _HAVE_IO_URING_
+
+    APRO_IMPLEMENT_SINGLETON(AsyncIO)
+
+    AsyncIO::AsyncIO()
+        : m_first(nullptr), m_last(nullptr), m_depth(0), m_max_depth(DefaultQueueDepth),
+          m_running(false), m_stopping(false), m_uring(false)
+    {
+
+    }
+
+    AsyncIO::~AsyncIO()
+    {
+        stop();
+    }
+
+    bool AsyncIO::start(size_t threads, size_t queueDepth)
+    {
+#ifdef _COMPILE_WITH_PTHREAD_
+        m_mutex.lock();
+        if(m_running)
+        {
+            m_mutex.unlock();
+            return false;
+        }
+
+        m_max_depth = queueDepth ? queueDepth : DefaultQueueDepth;
+
+#ifdef _HAVE_IO_URING_
+        IOUringThread* uring = AProNew(IOUringThread, this, (unsigned) m_max_depth);
+        if(uring->isValid())
+        {
+            m_threads.append(uring);
+            m_uring = true;
+        }
+        else
+        {
+            aprodebug("io_uring is not available, using a thread pool.");
+            AProDelete(uring);
+        }
+#endif // _HAVE_IO_URING_
+
+        if(!m_uring)
+        {
+            m_threads.reserve(threads ? threads : 1);
+            for(size_t i = 0; i < (threads ? threads : 1); ++i)
+                m_threads.append(AProNew(IOWorkerThread, this));
+        }
+
+        for(size_t i = 0; i < m_threads.size(); ++i)
+            m_threads[i]->start();
+
+        m_running = true;
+        m_mutex.unlock();
+        return true;
+#else
+        return false;
+#endif // _COMPILE_WITH_PTHREAD_
+    }
+
+    void AsyncIO::stop()
+    {
+        m_mutex.lock();
+        if(!m_running || m_stopping)
+        {
+            m_mutex.unlock();
+            return;
+        }
+
+        m_stopping = true;
+        m_not_empty.signalAll();
+        m_mutex.unlock();
+
+        for(size_t i = 0; i < m_threads.size(); ++i)
+        {
+            m_threads[i]->join();
+            AProDelete(m_threads[i]);
+        }
+        Array<Thread*>().swap(m_threads);
+
+        m_mutex.lock();
+        m_running  = false;
+        m_stopping = false;
+        m_uring    = false;
+        m_mutex.unlock();
+    }
+
+    IOFuture AsyncIO::submit(IORequest::Operation operation, IOHandle handle, Offset offset,
+                             Byte* buffer, size_t size, const IOCallback& callback)
+    {
+        IORequest* request = AProNew(IORequest);
+        request->operation = operation;
+        request->handle    = handle;
+        request->offset    = offset;
+        request->buffer    = buffer;
+        request->size      = size;
+        request->callback  = callback;
+        request->refs      = 2;// The service, and the future.
+
+        IOFuture future(request);
+
+        if(!m_running)
+            start();
+
+        m_mutex.lock();
+        if(!m_running || m_stopping)
+        {
+            // No thread to serve it : done now.
+            m_mutex.unlock();
+            Execute(&request, 1);
+            return future;
+        }
+
+        while(m_depth >= m_max_depth)
+            m_not_full.wait(&m_mutex);
+
+        if(m_last)
+            m_last->next = request;
+        else
+            m_first = request;
+        m_last = request;
+        m_depth++;
+
+        m_not_empty.signal();
+        m_mutex.unlock();
+        return future;
+    }
+
+    size_t AsyncIO::take(IORequest** batch, bool wait)
+    {
+        m_mutex.lock();
+        while(!m_first && wait && !m_stopping)
+            m_not_empty.wait(&m_mutex);
+
+        if(!m_first)
+        {
+            m_mutex.unlock();
+            return 0;
+        }
+
+        IORequest* first = m_first;
+        m_first = first->next;
+        if(!m_first)
+            m_last = nullptr;
+        first->next = nullptr;
+
+        batch[0] = first;
+        size_t count = 1;
+
+#if APRO_PLATFORM != APRO_WINDOWS
+        // Looks for a queued request starting where the batch ends,
+        // until none is found.
+        Offset end = first->offset + first->size;
+        bool found = true;
+        while(found && count < MaxCoalesced)
+        {
+            found = false;
+
+            IORequest* prev = nullptr;
+            for(IORequest* it = m_first; it; prev = it, it = it->next)
+            {
+                if(it->handle == first->handle && it->operation == first->operation && it->offset == end)
+                {
+                    if(prev)
+                        prev->next = it->next;
+                    else
+                        m_first = it->next;
+                    if(m_last == it)
+                        m_last = prev;
+                    it->next = nullptr;
+
+                    batch[count++] = it;
+                    end  += it->size;
+                    found = true;
+                    break;
+                }
+            }
+        }
+#endif
+
+        m_depth -= count;
+        m_not_full.signalAll();
+        m_mutex.unlock();
+        return count;
+    }
+
+#if APRO_PLATFORM == APRO_WINDOWS
+
+    void AsyncIO::Execute(IORequest** batch, size_t count)
+    {
+        for(size_t i = 0; i < count; ++i)
+        {
+            int error = 0;
+            size_t got = Transfer(batch[i], 0, error);
+            Finish(batch[i], got, error);
+        }
+    }
+
+    size_t AsyncIO::Transfer(IORequest* request, size_t from, int& error)
+    {
+        size_t done = from;
+        error = 0;
+
+        while(done < request->size)
+        {
+            Offset position = request->offset + done;
+            OVERLAPPED overlapped;
+            memset(&overlapped, 0, sizeof(overlapped));
+            overlapped.Offset     = (DWORD) position;
+            overlapped.OffsetHigh = (DWORD) (position >> 32);
+
+            size_t left  = request->size - done;
+            DWORD  chunk = left > (1u << 30) ? (1u << 30) : (DWORD) left;
+            DWORD  count = 0;
+
+            BOOL ok = request->operation == IORequest::Read ?
+                      ReadFile(request->handle, request->buffer + done, chunk, &count, &overlapped) :
+                      WriteFile(request->handle, request->buffer + done, chunk, &count, &overlapped);
+
+            if(!ok)
+            {
+                DWORD err = GetLastError();
+                if(err != ERROR_HANDLE_EOF)
+                    error = (int) err;
+                break;
+            }
+
+            if(count == 0)
+                break;
+
+            done += count;
+        }
+
+        return done - from;
+    }
+
+#else
+
+    void AsyncIO::Execute(IORequest** batch, size_t count)
+    {
+        if(count == 1)
+        {
+            int error = 0;
+            size_t got = Transfer(batch[0], 0, error);
+            Finish(batch[0], got, error);
+            return;
+        }
+
+        struct iovec iovecs[MaxCoalesced];
+        for(size_t i = 0; i < count; ++i)
+        {
+            iovecs[i].iov_base = batch[i]->buffer;
+            iovecs[i].iov_len  = batch[i]->size;
+        }
+
+        IORequest* first = batch[0];
+        ssize_t ret;
+        do
+        {
+            ret = first->operation == IORequest::Read ?
+                  preadv(first->handle, iovecs, (int) count, (off_t) first->offset) :
+                  pwritev(first->handle, iovecs, (int) count, (off_t) first->offset);
+        }
+        while(ret < 0 && errno == EINTR);
+
+        // On error, every request is tried again alone, so it gets
+        // its own error.
+        FinishBatch(batch, count, ret < 0 ? 0 : (size_t) ret);
+    }
+
+    size_t AsyncIO::Transfer(IORequest* request, size_t from, int& error)
+    {
+        size_t done = from;
+        error = 0;
+
+        while(done < request->size)
+        {
+            ssize_t ret = request->operation == IORequest::Read ?
+                          pread(request->handle, request->buffer + done, request->size - done, (off_t) (request->offset + done)) :
+                          pwrite(request->handle, request->buffer + done, request->size - done, (off_t) (request->offset + done));
+
+            if(ret < 0)
+            {
+                if(errno == EINTR)
+                    continue;
+
+                error = errno;
+                break;
+            }
+
+            if(ret == 0)
+                break;
+
+            done += (size_t) ret;
+        }
+
+        return done - from;
+    }
+
+#endif
+}
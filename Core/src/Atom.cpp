@@ -0,0 +1,197 @@
+/////////////////////////////////////////////////////////////
+/** @file Atom.cpp
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the Atom class and the AtomTable.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "Atom.h"
+
+namespace APro
+{
+    APRO_IMPLEMENT_SINGLETON(AtomTable)
+
+    AtomTable::AtomTable()
+    {
+        mNumBuckets = 256;
+        mNumEntries = 0;
+
+        mBuckets = AProNewA(Entry*, mNumBuckets);
+        for(uint32_t i = 0; i < mNumBuckets; ++i) {
+            mBuckets[i] = nullptr;
+        }
+    }
+
+    AtomTable::~AtomTable()
+    {
+        for(uint32_t i = 0; i < mNumBuckets; ++i)
+        {
+            Entry* cur = mBuckets[i];
+            while(cur != nullptr)
+            {
+                Entry* next = cur->link;
+                AProDelete(cur);
+                cur = next;
+            }
+        }
+
+        AProDelete(mBuckets);
+    }
+
+    const AtomTable::Entry* AtomTable::intern(const char* str, size_t sz)
+    {
+        HashType hash = HashData(str, sz);
+
+        APRO_THREADSAFE_AUTOLOCK
+
+        Entry* entry = findEntry(hash, str, sz);
+        if(entry == nullptr)
+        {
+            // We keep a load factor under 2 so chains stay short.
+            if(mNumEntries + 1 > mNumBuckets * 2)
+                rehash();
+
+            entry = AProNew(Entry);
+            entry->str  = String(str, sz);
+            entry->hash = hash;
+
+            uint32_t index = hash % mNumBuckets;
+            entry->link = mBuckets[index];
+            mBuckets[index] = entry;
+            mNumEntries++;
+        }
+
+        return entry;
+    }
+
+    const AtomTable::Entry* AtomTable::lookup(const char* str, size_t sz) const
+    {
+        HashType hash = HashData(str, sz);
+
+        APRO_THREADSAFE_AUTOLOCK
+        return findEntry(hash, str, sz);
+    }
+
+    uint32_t AtomTable::size() const
+    {
+        APRO_THREADSAFE_AUTOLOCK
+        return mNumEntries;
+    }
+
+    const AtomTable::Entry* AtomTable::EmptyEntry()
+    {
+        static const Entry* empty = AtomTable::Get().intern("", 0);
+        return empty;
+    }
+
+    AtomTable::Entry* AtomTable::findEntry(HashType hash, const char* str, size_t sz) const
+    {
+        for(Entry* cur = mBuckets[hash % mNumBuckets]; cur != nullptr; cur = cur->link)
+        {
+            if(cur->hash == hash && cur->str.size() == sz &&
+               Memory::Cmp(cur->str.toCstChar(), str, sz) == 0)
+                return cur;
+        }
+
+        return nullptr;
+    }
+
+    void AtomTable::rehash()
+    {
+        Entry**  oldBuckets    = mBuckets;
+        uint32_t oldNumBuckets = mNumBuckets;
+
+        mNumBuckets = oldNumBuckets * 2;
+        mBuckets = AProNewA(Entry*, mNumBuckets);
+        for(uint32_t i = 0; i < mNumBuckets; ++i) {
+            mBuckets[i] = nullptr;
+        }
+
+        // Entries are moved, never reallocated, so Atoms stay valid.
+        for(uint32_t i = 0; i < oldNumBuckets; ++i)
+        {
+            Entry* cur = oldBuckets[i];
+            while(cur != nullptr)
+            {
+                Entry* next = cur->link;
+                uint32_t index = cur->hash % mNumBuckets;
+                cur->link = mBuckets[index];
+                mBuckets[index] = cur;
+                cur = next;
+            }
+        }
+
+        AProDelete(oldBuckets);
+    }
+
+    HashType AtomTable::HashData(const char* str, size_t sz)
+    {
+        // Must stay the same as String::Hash() to keep Events types compatibles.
+        HashType h = 0;
+        for(size_t i = 0; i < sz; ++i)
+        {
+            h = 65599 * h + str[i];
+        }
+
+        return h ^ (h << 16);
+    }
+
+    Atom Atom::Empty = Atom();
+
+    Atom::Atom()
+        : mEntry(AtomTable::EmptyEntry())
+    {
+
+    }
+
+    Atom::Atom(const char* str)
+        : mEntry(AtomTable::Get().intern(str, String::Size(str)))
+    {
+
+    }
+
+    Atom::Atom(const char* str, size_t sz)
+        : mEntry(AtomTable::Get().intern(str, sz))
+    {
+
+    }
+
+    Atom::Atom(const String& str)
+        : mEntry(AtomTable::Get().intern(str.toCstChar(), str.size()))
+    {
+
+    }
+
+    bool Atom::Find(const String& str, Atom& result)
+    {
+        const AtomTable::Entry* entry = AtomTable::Get().lookup(str.toCstChar(), str.size());
+        if(entry != nullptr)
+        {
+            result.mEntry = entry;
+            return true;
+        }
+
+        return false;
+    }
+}
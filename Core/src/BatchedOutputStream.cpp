@@ -0,0 +1,286 @@
+/////////////////////////////////////////////////////////////
+/** @file BatchedOutputStream.cpp
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the BatchedOutputStream class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "BatchedOutputStream.h"
+#include "Console.h"
+#include "NumberFormat.h"
+
+#include <cerrno>
+#include <cstring>
+
+#if APRO_PLATFORM != APRO_WINDOWS
+#   include <unistd.h>
+#   include <sys/uio.h>
+#endif
+
+namespace APro
+{
+    BatchedOutputStream::BatchedOutputStream(File& f, size_t threshold, unsigned maxDelay)
+        : m_file(nullptr), m_arena(nullptr), m_arena_size(0), m_slice_count(0), m_pending(0),
+          m_threshold(threshold ? threshold : 1), m_max_delay(maxDelay), m_sync(false)
+    {
+        if(f.isOpened())
+            m_file = std::move(FilePtr(&f, nullptr, true, nullptr));
+
+        m_arena = (Byte*) AProAllocate(m_threshold);
+    }
+
+    BatchedOutputStream::~BatchedOutputStream()
+    {
+        // File object musn't be closed, but it must see what we wrote.
+        flush();
+
+        if(m_arena)
+            AProDeallocate(m_arena);
+    }
+
+    void BatchedOutputStream::setThreshold(size_t threshold)
+    {
+        flush();
+
+        m_threshold = threshold ? threshold : 1;
+        AProDeallocate(m_arena);
+        m_arena = (Byte*) AProAllocate(m_threshold);
+    }
+
+    bool BatchedOutputStream::writeBytes(const Byte* bytes, size_t sz)
+    {
+        if(m_file.isNull() || !m_file->isOpened())
+            return false;
+        if(!sz)
+            return true;
+
+        if(sz >= LargeFragment || sz > m_threshold)
+        {
+            // Written now with the pending slices, so the caller's
+            // bytes are not used after we return.
+            if(m_slice_count == MaxSlices && !flush())
+                return false;
+
+            Slice& slice = m_slices[m_slice_count++];
+            slice.data   = bytes;
+            slice.size   = sz;
+            m_pending   += sz;
+            return flush();
+        }
+
+        if(m_arena_size + sz > m_threshold || m_slice_count == MaxSlices)
+        {
+            if(!flush())
+                return false;
+        }
+
+        Byte* copy = m_arena + m_arena_size;
+        memcpy(copy, bytes, sz);
+        m_arena_size += sz;
+
+        // Consecutive copies make one slice.
+        if(m_slice_count && m_slices[m_slice_count - 1].data + m_slices[m_slice_count - 1].size == copy)
+        {
+            m_slices[m_slice_count - 1].size += sz;
+        }
+        else
+        {
+            Slice& slice = m_slices[m_slice_count++];
+            slice.data   = copy;
+            slice.size   = sz;
+        }
+
+        if(!m_pending)
+            m_oldest = Clock::now();
+        m_pending += sz;
+
+        if(m_pending >= m_threshold)
+            return flush();
+
+        if(m_max_delay && Clock::now() - m_oldest >= std::chrono::milliseconds(m_max_delay))
+            return flush();
+
+        return true;
+    }
+
+    bool BatchedOutputStream::flush()
+    {
+        if(!m_slice_count)
+            return true;
+
+        bool ret = writeSlices();
+
+        m_slice_count = 0;
+        m_arena_size  = 0;
+        m_pending     = 0;
+        return ret;
+    }
+
+    bool BatchedOutputStream::writeSlices()
+    {
+        if(m_file.isNull() || !m_file->isOpened())
+            return false;
+
+        // Bytes buffered by the File go before ours.
+        m_file->flush();
+
+#if APRO_PLATFORM == APRO_WINDOWS
+
+        for(size_t i = 0; i < m_slice_count; ++i)
+        {
+            if(!m_file->write(m_slices[i].data, m_slices[i].size))
+            {
+                aprodebug("Can't write to file '") << m_file->getFullPath() << "'.";
+                return false;
+            }
+        }
+
+        m_file->flush();
+
+        if(m_sync && !FlushFileBuffers(m_file->getIOHandle()))
+        {
+            aprodebug("Can't sync file '") << m_file->getFullPath() << "'.";
+            return false;
+        }
+
+#else
+
+        struct iovec iov[MaxSlices];
+        for(size_t i = 0; i < m_slice_count; ++i)
+        {
+            iov[i].iov_base = const_cast<Byte*>(m_slices[i].data);
+            iov[i].iov_len  = m_slices[i].size;
+        }
+
+        int    fd     = m_file->getIOHandle();
+        Offset offset = m_file->tell();
+
+        // A partial write continues from the first unwritten byte.
+        struct iovec* cur = iov;
+        int count = (int) m_slice_count;
+        while(count && cur->iov_len == 0)
+        {
+            cur++;
+            count--;
+        }
+
+        while(count)
+        {
+            ssize_t n = pwritev(fd, cur, count, (off_t) offset);
+            if(n < 0)
+            {
+                if(errno == EINTR)
+                    continue;
+
+                aprodebug("Can't write to file '") << m_file->getFullPath() << "' : " << strerror(errno) << ".";
+                return false;
+            }
+
+            // Nothing written while bytes remain : trying again would
+            // loop forever.
+            if(n == 0)
+            {
+                aprodebug("Can't write to file '") << m_file->getFullPath() << "' : no byte written.";
+                return false;
+            }
+
+            offset += (Offset) n;
+            while(count && (size_t) n >= cur->iov_len)
+            {
+                n -= (ssize_t) cur->iov_len;
+                cur++;
+                count--;
+            }
+
+            if(count)
+            {
+                cur->iov_base = (Byte*) cur->iov_base + n;
+                cur->iov_len -= (size_t) n;
+            }
+        }
+
+        // pwritev() does not move the File cursor.
+        m_file->seek(File::C_BEGIN, offset);
+
+        if(m_sync)
+        {
+#   if APRO_PLATFORM == APRO_OSX
+            int err = fsync(fd);
+#   else
+            int err = fdatasync(fd);
+#   endif
+            if(err != 0)
+            {
+                aprodebug("Can't sync file '") << m_file->getFullPath() << "' : " << strerror(errno) << ".";
+                return false;
+            }
+        }
+
+#endif
+
+        return true;
+    }
+
+    bool BatchedOutputStream::write(const String& str)
+    {
+        return writeBytes((const Byte*) str.toCstChar(), str.size());
+    }
+
+    bool BatchedOutputStream::write(const Real& str)
+    {
+        char buffer[NumberFormat::MaxRealSize];
+        size_t sz = NumberFormat::Format(buffer, str);
+        return writeBytes((const Byte*) buffer, sz);
+    }
+
+    bool BatchedOutputStream::write(const int& str)
+    {
+        char buffer[NumberFormat::MaxIntegerSize];
+        size_t sz = NumberFormat::Format(buffer, (int32_t) str);
+        return writeBytes((const Byte*) buffer, sz);
+    }
+
+    bool BatchedOutputStream::isEOS() const
+    {
+        return m_file.isNull() || !m_file->isOpened();
+    }
+
+    size_t BatchedOutputStream::tell() const
+    {
+        if(isEOS())
+            return 0;
+
+        return (size_t) m_file->tell() + m_pending;
+    }
+
+    void BatchedOutputStream::seek(size_t pos, CursorPosition cp)
+    {
+        flush();
+
+        if(isEOS())
+            return;
+
+        m_file->seek( (File::CursorPosition) (File::C_BEGIN + (int) cp), (Offset) pos);
+    }
+}
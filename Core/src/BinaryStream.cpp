@@ -0,0 +1,182 @@
+/////////////////////////////////////////////////////////////
+/** @file BinaryStream.cpp
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the BinaryOutputStream and BinaryInputStream classes.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "BinaryStream.h"
+#include "Console.h"
+
+#include <cstring>
+
+namespace APro
+{
+    /// Bytes beginning every archive.
+    static const Byte ArchiveMagic[4] = { 'A', 'P', 'R', 'B' };
+
+    BinaryOutputStream::BinaryOutputStream(OutputStream& stream)
+        : m_stream(&stream), m_good(true)
+    {
+
+    }
+
+    bool BinaryOutputStream::writeHeader(uint32_t tag, uint32_t version)
+    {
+        writeBytes(ArchiveMagic, sizeof(ArchiveMagic));
+        write(tag);
+        return write(version);
+    }
+
+    bool BinaryOutputStream::writeBytes(const void* bytes, size_t sz)
+    {
+        if(m_good && sz)
+            m_good = m_stream->writeBytes((const Byte*) bytes, sz);
+        return m_good;
+    }
+
+    bool BinaryOutputStream::writeVarUInt(uint64_t value)
+    {
+        Byte buffer[10];
+        size_t sz = 0;
+
+        while(value >= 0x80)
+        {
+            buffer[sz++] = (Byte) (value | 0x80);
+            value >>= 7;
+        }
+        buffer[sz++] = (Byte) value;
+
+        return writeBytes(buffer, sz);
+    }
+
+    bool BinaryOutputStream::writeVarInt(int64_t value)
+    {
+        // Zigzag : 0, -1, 1, -2... become 0, 1, 2, 3...
+        return writeVarUInt(((uint64_t) value << 1) ^ (uint64_t) (value >> 63));
+    }
+
+    bool BinaryOutputStream::write(const String& str)
+    {
+        writeVarUInt(str.size());
+        return writeBytes(str.toCstChar(), str.size());
+    }
+
+    BinaryInputStream::BinaryInputStream(InputStream& stream)
+        : m_stream(&stream), m_good(true), m_max_size(DefaultMaxSize)
+    {
+
+    }
+
+    bool BinaryInputStream::readHeader(uint32_t tag, uint32_t& version)
+    {
+        Byte magic[4];
+        uint32_t readtag;
+
+        if(!readBytes(magic, sizeof(magic)) || !read(readtag) || !read(version))
+            return false;
+
+        if(memcmp(magic, ArchiveMagic, sizeof(magic)) != 0 || readtag != tag)
+        {
+            aprodebug("Invalid archive header.");
+            m_good = false;
+        }
+
+        return m_good;
+    }
+
+    bool BinaryInputStream::readBytes(void* bytes, size_t sz)
+    {
+        if(m_good && sz)
+            m_good = m_stream->readBytes((Byte*) bytes, sz) == sz;
+        return m_good;
+    }
+
+    bool BinaryInputStream::readVarUInt(uint64_t& value)
+    {
+        value = 0;
+        for(unsigned shift = 0; shift < 64; shift += 7)
+        {
+            Byte b;
+            if(!readBytes(&b, 1))
+                return false;
+
+            value |= (uint64_t) (b & 0x7F) << shift;
+            if(!(b & 0x80))
+                return true;
+        }
+
+        // More than 10 bytes : corrupted.
+        m_good = false;
+        return false;
+    }
+
+    bool BinaryInputStream::readVarInt(int64_t& value)
+    {
+        uint64_t zigzag;
+        if(!readVarUInt(zigzag))
+            return false;
+
+        value = (int64_t) (zigzag >> 1) ^ -(int64_t) (zigzag & 1);
+        return true;
+    }
+
+    bool BinaryInputStream::read(String& str)
+    {
+        str.clear();
+
+        size_t sz;
+        if(!readSize(sz))
+            return false;
+
+        // Read by blocks, so a truncated archive stops early.
+        char block[4096];
+        while(sz && m_good)
+        {
+            size_t part = sz < sizeof(block) ? sz : sizeof(block);
+            if(readBytes(block, part))
+                str.append(block, part);
+            sz -= part;
+        }
+
+        return m_good;
+    }
+
+    bool BinaryInputStream::readSize(size_t& sz)
+    {
+        uint64_t value;
+        if(!readVarUInt(value))
+            return false;
+
+        if(value > (uint64_t) m_max_size)
+        {
+            aprodebug("Archive size ") << (unsigned long) value << " is too big.";
+            m_good = false;
+            return false;
+        }
+
+        sz = (size_t) value;
+        return true;
+    }
+}
@@ -0,0 +1,119 @@
+/////////////////////////////////////////////////////////////
+/** @file CheckSum.cpp
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the CheckSum class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "CheckSum.h"
+#include "File.h"
+#include "StreamInterface.h"
+#include "Console.h"
+
+namespace APro
+{
+    bool CheckSum::generateFile(File& file, CheckSumType& result, size_t chunkSize)
+    {
+        if(!file.isOpened())
+        {
+            aprodebug("Can't checksum a closed file.");
+            return false;
+        }
+
+        if(!chunkSize)
+            chunkSize = DefaultChunkSize;
+
+        // Two buffers : one is read by an I/O thread while the other
+        // one is checksummed.
+        Byte*    buffers[2] = { (Byte*) AProAllocate(chunkSize), (Byte*) AProAllocate(chunkSize) };
+        IOFuture reads[2];
+        Offset   size = file.getSize();
+        Offset   next = 0;
+
+        for(int i = 0; i < 2 && next < size; ++i)
+        {
+            size_t sz = size - next < (Offset) chunkSize ? (size_t) (size - next) : chunkSize;
+            reads[i]  = file.readAsync(next, buffers[i], sz);
+            next     += sz;
+        }
+
+        begin();
+
+        bool ok      = true;
+        int  current = 0;
+        while(reads[current].isValid())
+        {
+            const IOResult& read = reads[current].wait();
+            if(!read.success)
+            {
+                aprodebug("Can't read file to checksum (error ") << read.error << ").";
+                ok = false;
+                break;
+            }
+
+            update(buffers[current], read.size);
+            reads[current] = IOFuture();
+
+            if(next < size)
+            {
+                size_t sz      = size - next < (Offset) chunkSize ? (size_t) (size - next) : chunkSize;
+                reads[current] = file.readAsync(next, buffers[current], sz);
+                next          += sz;
+            }
+
+            current ^= 1;
+        }
+
+        // A read still running writes in its buffer.
+        for(int i = 0; i < 2; ++i)
+        {
+            if(reads[i].isValid())
+                reads[i].wait();
+        }
+
+        AProDeallocate(buffers[0]);
+        AProDeallocate(buffers[1]);
+
+        if(ok)
+            result = finalize();
+        return ok;
+    }
+
+    CheckSumType CheckSum::generateStream(InputStream& stream, size_t chunkSize)
+    {
+        if(!chunkSize)
+            chunkSize = DefaultChunkSize;
+
+        Byte* buffer = (Byte*) AProAllocate(chunkSize);
+
+        begin();
+
+        size_t sz;
+        while((sz = stream.readBytes(buffer, chunkSize)) != 0)
+            update(buffer, sz);
+
+        AProDeallocate(buffer);
+        return finalize();
+    }
+}
@@ -66,8 +66,29 @@ namespace APro
         0x6e17,  0x7e36,  0x4e55,  0x5e74,  0x2e93,  0x3eb2,  0x0ed1,  0x1ef0
     };
     
+    /// Tables of the slicing-by-8 algorithm : values[k][b] is the
+    /// CRC of byte b followed by k zero bytes.
+    struct CRC16Tables
+    {
+        uint16_t values[8][256];
+
+        CRC16Tables(const uint32_t* table)
+        {
+            for(int i = 0; i < 256; ++i)
+                values[0][i] = (uint16_t) table[i];
+
+            for(int k = 1; k < 8; ++k)
+            {
+                for(int i = 0; i < 256; ++i)
+                    values[k][i] = (uint16_t) (values[k - 1][i] << 8) ^ values[0][values[k - 1][i] >> 8];
+            }
+        }
+    };
+
     CheckSumCRC16::CheckSumCRC16()
+        : mFast(false), mCrc(0)
     {
+        _initCRC16Data(mCrcData);
         setCustomProperty(String("Fast"), true);
     }
     
@@ -78,11 +99,8 @@ namespace APro
     
     CheckSumType CheckSumCRC16::generate(const void* data, uint32_t lenght)
     {
-        static String FastProperty = String("Fast");
-        bool _fastvalue = mCustomProperties[FastProperty];
-        
-        if(_fastvalue)
-            return _computeFast(data, lenght);
+        if(mFast)
+            return (CheckSumType) (uintptr_t) _computeFast(0, data, lenght);
         
         uint8_t* cdata = (uint8_t*) data;
         CRC16Data crcdata;
@@ -94,7 +112,38 @@ namespace APro
         _processCRC16Data(crcdata, 0x00);
         _processCRC16Data(crcdata, 0x00);
         
-        return (CheckSumType) crcdata.part.remainder;
+        return (CheckSumType) (uintptr_t) crcdata.part.remainder;
+    }
+    
+    void CheckSumCRC16::begin()
+    {
+        mCrc = 0;
+        _initCRC16Data(mCrcData);
+    }
+    
+    void CheckSumCRC16::update(const void* data, size_t lenght)
+    {
+        if(mFast)
+        {
+            mCrc = _computeFast(mCrc, data, lenght);
+            return;
+        }
+        
+        const uint8_t* cdata = (const uint8_t*) data;
+        for(size_t i = 0; i < lenght; ++i)
+            _processCRC16Data(mCrcData, cdata[i]);
+    }
+    
+    CheckSumType CheckSumCRC16::finalize()
+    {
+        if(mFast)
+            return (CheckSumType) (uintptr_t) mCrc;
+        
+        CRC16Data crcdata = mCrcData;
+        _processCRC16Data(crcdata, 0x00);
+        _processCRC16Data(crcdata, 0x00);
+        
+        return (CheckSumType) (uintptr_t) crcdata.part.remainder;
     }
     
     CompareResult CheckSumCRC16::compare(const CheckSumType first, const CheckSumType second) const
@@ -109,6 +158,12 @@ namespace APro
             return CompareResult::Inferior;
     }
     
+    void CheckSumCRC16::_onCustomPropertyChanged(const String& name, bool value)
+    {
+        if(name == String("Fast"))
+            mFast = value;
+    }
+    
     void CheckSumCRC16::_initCRC16Data(CRC16Data& crcdata)
     {
         crcdata.value = CRC16_INITVALUE;
@@ -128,14 +183,22 @@ namespace APro
         } while (--nByteCount);
     }
     
-    CheckSumType CheckSumCRC16::_computeFast(const void* data, uint32_t lenght)
+    uint16_t CheckSumCRC16::_computeFast(uint16_t crc, const void* data, size_t lenght)
     {
-        register uint16_t crc = 0;
-        register uint8_t* cp = (uint8_t*) data;
+        static const CRC16Tables tables(CRCTAB);
+        const uint16_t (*t)[256] = tables.values;
+        
+        const uint8_t* cp = (const uint8_t*) data;
+        
+        for(; lenght >= 8; lenght -= 8, cp += 8)
+        {
+            crc = t[7][cp[0] ^ (crc >> 8)] ^ t[6][cp[1] ^ (crc & 0xFF)] ^
+                  t[5][cp[2]] ^ t[4][cp[3]] ^ t[3][cp[4]] ^ t[2][cp[5]] ^ t[1][cp[6]] ^ t[0][cp[7]];
+        }
         
         while(lenght--)
-            crc = (crc<<8) ^ CRCTAB[(crc>>(8)) ^ *cp++];
+            crc = (uint16_t) (crc<<8) ^ t[0][(crc>>(8)) ^ *cp++];
         
-        return (CheckSumType) crc;
+        return crc;
     }
 }
@@ -0,0 +1,188 @@
+/////////////////////////////////////////////////////////////
+/** @file CheckSumCRC32C.cpp
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the CheckSumCRC32C class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "CheckSumCRC32C.h"
+
+#if defined(APRO_SIMD_SSE42)
+#   include <nmmintrin.h>
+#endif
+
+#include <cstring>
+
+namespace APro
+{
+    /// Tables of the slicing-by-8 algorithm : values[k][b] is the
+    /// CRC of byte b followed by k zero bytes (reflected).
+    struct Crc32CTables
+    {
+        uint32_t values[8][256];
+
+        Crc32CTables()
+        {
+            for(uint32_t i = 0; i < 256; ++i)
+            {
+                uint32_t crc = i;
+                for(int bit = 0; bit < 8; ++bit)
+                    crc = (crc >> 1) ^ (0x82F63B78 & (0 - (crc & 1)));
+                values[0][i] = crc;
+            }
+
+            for(int k = 1; k < 8; ++k)
+            {
+                for(uint32_t i = 0; i < 256; ++i)
+                    values[k][i] = (values[k - 1][i] >> 8) ^ values[0][values[k - 1][i] & 0xFF];
+            }
+        }
+    };
+
+    static const Crc32CTables& GetCrc32CTables()
+    {
+        static const Crc32CTables tables;
+        return tables;
+    }
+
+    CheckSumCRC32C::CheckSumCRC32C()
+        : mCrc(0)
+    {
+
+    }
+
+    Prototype* CheckSumCRC32C::clone() const
+    {
+        return AProNew(CheckSumCRC32C);
+    }
+
+    CheckSumType CheckSumCRC32C::generate(const void* data, uint32_t lenght)
+    {
+        return (CheckSumType) (uintptr_t) Compute(data, lenght);
+    }
+
+    void CheckSumCRC32C::begin()
+    {
+        mCrc = 0;
+    }
+
+    void CheckSumCRC32C::update(const void* data, size_t lenght)
+    {
+        mCrc = Compute(data, lenght, mCrc);
+    }
+
+    CheckSumType CheckSumCRC32C::finalize()
+    {
+        return (CheckSumType) (uintptr_t) mCrc;
+    }
+
+    CompareResult CheckSumCRC32C::compare(const CheckSumType first, const CheckSumType second) const
+    {
+        uint32_t c1 = (uint32_t) (uintptr_t) first;
+        uint32_t c2 = (uint32_t) (uintptr_t) second;
+        if(c1 == c2)
+            return CompareResult::Equal;
+        else if(c1 > c2)
+            return CompareResult::Superior;
+        else
+            return CompareResult::Inferior;
+    }
+
+    uint32_t CheckSumCRC32C::Compute(const void* data, size_t sz, uint32_t crc)
+    {
+#if defined(APRO_SIMD_SSE42)
+
+        const Byte* p = (const Byte*) data;
+        crc = ~crc;
+
+        // One instruction per 8 bytes. The bytes before the first
+        // aligned word go one by one.
+        while(sz && ((uintptr_t) p & 7))
+        {
+            crc = _mm_crc32_u8(crc, *p++);
+            sz--;
+        }
+
+#   if APRO_ARCHITECTURE == APRO_64
+        uint64_t crc64 = crc;
+        for(; sz >= 8; sz -= 8, p += 8)
+        {
+            uint64_t word;
+            memcpy(&word, p, sizeof(word));
+            crc64 = _mm_crc32_u64(crc64, word);
+        }
+        crc = (uint32_t) crc64;
+#   endif
+
+        for(; sz >= 4; sz -= 4, p += 4)
+        {
+            uint32_t word;
+            memcpy(&word, p, sizeof(word));
+            crc = _mm_crc32_u32(crc, word);
+        }
+
+        while(sz--)
+            crc = _mm_crc32_u8(crc, *p++);
+
+        return ~crc;
+
+#else
+
+        return ComputeSoftware(data, sz, crc);
+
+#endif
+    }
+
+    uint32_t CheckSumCRC32C::ComputeSoftware(const void* data, size_t sz, uint32_t crc)
+    {
+        const Crc32CTables& t = GetCrc32CTables();
+        const Byte*         p = (const Byte*) data;
+
+        crc = ~crc;
+
+        while(sz && ((uintptr_t) p & 7))
+        {
+            crc = t.values[0][(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+            sz--;
+        }
+
+        // Bytes are read one by one, so the result does not depend
+        // on the endianness.
+        for(; sz >= 8; sz -= 8, p += 8)
+        {
+            uint32_t low  = crc ^ ((uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24));
+            uint32_t high = (uint32_t) p[4] | ((uint32_t) p[5] << 8) | ((uint32_t) p[6] << 16) | ((uint32_t) p[7] << 24);
+
+            crc = t.values[7][low & 0xFF]         ^ t.values[6][(low >> 8) & 0xFF] ^
+                  t.values[5][(low >> 16) & 0xFF] ^ t.values[4][low >> 24]         ^
+                  t.values[3][high & 0xFF]        ^ t.values[2][(high >> 8) & 0xFF] ^
+                  t.values[1][(high >> 16) & 0xFF] ^ t.values[0][high >> 24];
+        }
+
+        while(sz--)
+            crc = t.values[0][(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+
+        return ~crc;
+    }
+}
@@ -0,0 +1,45 @@
+/////////////////////////////////////////////////////////////
+/** @file CheckSumFactory.cpp
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the CheckSumFactory class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "CheckSumFactory.h"
+#include "CheckSumCRC16.h"
+#include "CheckSumCRC32C.h"
+#include "CheckSumXXH64.h"
+
+namespace APro
+{
+    APRO_IMPLEMENT_MANUALSINGLETON(CheckSumFactory)
+
+    CheckSumFactory::CheckSumFactory()
+        : Factory<CheckSum>()
+    {
+        register_prototype(String("CRC16"),  AProNew(CheckSumCRC16));
+        register_prototype(String("CRC32C"), AProNew(CheckSumCRC32C));
+        register_prototype(String("XXH64"),  AProNew(CheckSumXXH64));
+    }
+}
@@ -0,0 +1,227 @@
+/////////////////////////////////////////////////////////////
+/** @file CheckSumXXH64.cpp
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the CheckSumXXH64 class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "CheckSumXXH64.h"
+
+#include <cstring>
+
+namespace APro
+{
+    static const uint64_t Prime1 = 0x9E3779B185EBCA87ULL;
+    static const uint64_t Prime2 = 0xC2B2AE3D27D4EB4FULL;
+    static const uint64_t Prime3 = 0x165667B19E3779F9ULL;
+    static const uint64_t Prime4 = 0x85EBCA77C2B2AE63ULL;
+    static const uint64_t Prime5 = 0x27D4EB2F165667C5ULL;
+
+    static inline uint64_t RotateLeft(uint64_t value, int bits)
+    {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    /// Reads 8 little endian bytes.
+    static inline uint64_t Read64(const Byte* p)
+    {
+        return (uint64_t) p[0]         | ((uint64_t) p[1] << 8)  | ((uint64_t) p[2] << 16) | ((uint64_t) p[3] << 24) |
+               ((uint64_t) p[4] << 32) | ((uint64_t) p[5] << 40) | ((uint64_t) p[6] << 48) | ((uint64_t) p[7] << 56);
+    }
+
+    /// Reads 4 little endian bytes.
+    static inline uint64_t Read32(const Byte* p)
+    {
+        return (uint64_t) p[0] | ((uint64_t) p[1] << 8) | ((uint64_t) p[2] << 16) | ((uint64_t) p[3] << 24);
+    }
+
+    static inline uint64_t Round(uint64_t acc, uint64_t input)
+    {
+        acc += input * Prime2;
+        acc  = RotateLeft(acc, 31);
+        return acc * Prime1;
+    }
+
+    static inline uint64_t MergeRound(uint64_t acc, uint64_t value)
+    {
+        acc ^= Round(0, value);
+        return acc * Prime1 + Prime4;
+    }
+
+    /// Sets the lanes for given seed.
+    static inline void InitLanes(uint64_t* v, uint64_t seed)
+    {
+        v[0] = seed + Prime1 + Prime2;
+        v[1] = seed + Prime2;
+        v[2] = seed;
+        v[3] = seed - Prime1;
+    }
+
+    /// Eats every whole stripe between p and end, and returns the
+    /// first byte left.
+    static inline const Byte* ConsumeStripes(uint64_t* v, const Byte* p, const Byte* end)
+    {
+        // The lanes don't depend on each other : the processor
+        // runs them in parallel.
+        uint64_t v1 = v[0], v2 = v[1], v3 = v[2], v4 = v[3];
+        for(; (size_t) (end - p) >= CheckSumXXH64::StripeSize; p += CheckSumXXH64::StripeSize)
+        {
+            v1 = Round(v1, Read64(p));
+            v2 = Round(v2, Read64(p + 8));
+            v3 = Round(v3, Read64(p + 16));
+            v4 = Round(v4, Read64(p + 24));
+        }
+
+        v[0] = v1; v[1] = v2; v[2] = v3; v[3] = v4;
+        return p;
+    }
+
+    static inline uint64_t MergeLanes(const uint64_t* v)
+    {
+        uint64_t hash = RotateLeft(v[0], 1) + RotateLeft(v[1], 7) + RotateLeft(v[2], 12) + RotateLeft(v[3], 18);
+        hash = MergeRound(hash, v[0]);
+        hash = MergeRound(hash, v[1]);
+        hash = MergeRound(hash, v[2]);
+        hash = MergeRound(hash, v[3]);
+        return hash;
+    }
+
+    /// Eats the last bytes (less than a stripe), and mixes the
+    /// result.
+    static inline uint64_t Finish(uint64_t hash, const Byte* p, const Byte* end)
+    {
+        for(; p + 8 <= end; p += 8)
+            hash = RotateLeft(hash ^ Round(0, Read64(p)), 27) * Prime1 + Prime4;
+
+        if(p + 4 <= end)
+        {
+            hash = RotateLeft(hash ^ (Read32(p) * Prime1), 23) * Prime2 + Prime3;
+            p   += 4;
+        }
+
+        for(; p < end; ++p)
+            hash = RotateLeft(hash ^ (*p * Prime5), 11) * Prime1;
+
+        hash ^= hash >> 33;
+        hash *= Prime2;
+        hash ^= hash >> 29;
+        hash *= Prime3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+    CheckSumXXH64::CheckSumXXH64()
+    {
+        begin();
+    }
+
+    Prototype* CheckSumXXH64::clone() const
+    {
+        return AProNew(CheckSumXXH64);
+    }
+
+    CheckSumType CheckSumXXH64::generate(const void* data, uint32_t lenght)
+    {
+        return (CheckSumType) (uintptr_t) Compute(data, lenght);
+    }
+
+    void CheckSumXXH64::begin()
+    {
+        InitLanes(mLanes, 0);
+        mTotal    = 0;
+        mBuffered = 0;
+    }
+
+    void CheckSumXXH64::update(const void* data, size_t lenght)
+    {
+        const Byte* p   = (const Byte*) data;
+        const Byte* end = p + lenght;
+
+        mTotal += lenght;
+
+        if(mBuffered + lenght < StripeSize)
+        {
+            if(lenght)
+                memcpy(mStripe + mBuffered, p, lenght);
+            mBuffered += lenght;
+            return;
+        }
+
+        if(mBuffered)
+        {
+            size_t missing = StripeSize - mBuffered;
+            memcpy(mStripe + mBuffered, p, missing);
+            ConsumeStripes(mLanes, mStripe, mStripe + StripeSize);
+            p        += missing;
+            mBuffered = 0;
+        }
+
+        p = ConsumeStripes(mLanes, p, end);
+
+        mBuffered = (size_t) (end - p);
+        if(mBuffered)
+            memcpy(mStripe, p, mBuffered);
+    }
+
+    CheckSumType CheckSumXXH64::finalize()
+    {
+        uint64_t hash = mTotal >= StripeSize ? MergeLanes(mLanes) : Prime5;
+        hash += mTotal;
+        return (CheckSumType) (uintptr_t) Finish(hash, mStripe, mStripe + mBuffered);
+    }
+
+    CompareResult CheckSumXXH64::compare(const CheckSumType first, const CheckSumType second) const
+    {
+        uintptr_t c1 = (uintptr_t) first;
+        uintptr_t c2 = (uintptr_t) second;
+        if(c1 == c2)
+            return CompareResult::Equal;
+        else if(c1 > c2)
+            return CompareResult::Superior;
+        else
+            return CompareResult::Inferior;
+    }
+
+    uint64_t CheckSumXXH64::Compute(const void* data, size_t sz, uint64_t seed)
+    {
+        const Byte* p   = (const Byte*) data;
+        const Byte* end = p + sz;
+        uint64_t    hash;
+
+        if(sz >= StripeSize)
+        {
+            uint64_t v[4];
+            InitLanes(v, seed);
+            p    = ConsumeStripes(v, p, end);
+            hash = MergeLanes(v);
+        }
+        else
+        {
+            hash = seed + Prime5;
+        }
+
+        hash += (uint64_t) sz;
+        return Finish(hash, p, end);
+    }
+}
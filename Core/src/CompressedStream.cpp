@@ -0,0 +1,482 @@
+/////////////////////////////////////////////////////////////
+/** @file CompressedStream.cpp
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the CompressedOutputStream and DecompressingInputStream
+ *  classes.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "CompressedStream.h"
+#include "LZCodec.h"
+#include "Console.h"
+#include "NumberFormat.h"
+#include "StringSearch.h"
+
+#include <cctype>
+#include <cstring>
+
+namespace APro
+{
+    /// Writes given integer as 4 little endian bytes.
+    static bool WriteUInt32(OutputStream& out, uint32_t value)
+    {
+        Byte bytes[4] = { (Byte) value, (Byte) (value >> 8), (Byte) (value >> 16), (Byte) (value >> 24) };
+        return out.writeBytes(bytes, 4);
+    }
+
+    /// Reads an integer written by WriteUInt32().
+    static bool ReadUInt32(InputStream& in, uint32_t& value)
+    {
+        Byte bytes[4];
+        if(in.readBytes(bytes, 4) != 4)
+            return false;
+
+        value = (uint32_t) bytes[0] | ((uint32_t) bytes[1] << 8) | ((uint32_t) bytes[2] << 16) | ((uint32_t) bytes[3] << 24);
+        return true;
+    }
+
+    CompressedOutputStream::CompressedOutputStream(OutputStream& out, size_t blockSize)
+        : m_out(out), m_block(nullptr), m_compressed(nullptr), m_block_size(blockSize), m_pending(0), m_written(0),
+          m_finished(false), m_good(true)
+    {
+        if(!m_block_size)
+            m_block_size = DefaultBlockSize;
+        if(m_block_size > FrameMaxBlock)
+            m_block_size = FrameMaxBlock;
+
+        m_block      = (Byte*) AProAllocate(m_block_size);
+        m_compressed = (Byte*) AProAllocate(LZCodec::CompressBound(m_block_size));
+
+        m_good = WriteUInt32(m_out, FrameMagic) && WriteUInt32(m_out, (uint32_t) m_block_size);
+    }
+
+    CompressedOutputStream::~CompressedOutputStream()
+    {
+        finish();
+
+        AProDeallocate(m_block);
+        AProDeallocate(m_compressed);
+    }
+
+    bool CompressedOutputStream::finish()
+    {
+        if(m_finished)
+            return m_good;
+
+        if(m_pending)
+            writeBlock();
+
+        m_good     = m_good && WriteUInt32(m_out, 0);
+        m_finished = true;
+        return m_good;
+    }
+
+    bool CompressedOutputStream::writeBlock()
+    {
+        size_t sz = LZCodec::Compress(m_block, m_pending, m_compressed, LZCodec::CompressBound(m_block_size));
+
+        if(sz && sz < m_pending)
+        {
+            m_good = m_good && WriteUInt32(m_out, (uint32_t) sz) && m_out.writeBytes(m_compressed, sz);
+        }
+        else
+        {
+            // Incompressible : decompression will only copy it.
+            m_good = m_good && WriteUInt32(m_out, (uint32_t) m_pending | FrameStoredBlock) && m_out.writeBytes(m_block, m_pending);
+        }
+
+        m_pending = 0;
+        if(!m_good)
+            aprodebug("Can't write compressed block.");
+        return m_good;
+    }
+
+    bool CompressedOutputStream::writeBytes(const Byte* bytes, size_t sz)
+    {
+        if(isEOS())
+            return false;
+
+        m_written += sz;
+        while(sz)
+        {
+            size_t chunk = m_block_size - m_pending;
+            if(chunk > sz)
+                chunk = sz;
+
+            memcpy(m_block + m_pending, bytes, chunk);
+            m_pending += chunk;
+            bytes     += chunk;
+            sz        -= chunk;
+
+            if(m_pending == m_block_size && !writeBlock())
+                return false;
+        }
+
+        return true;
+    }
+
+    bool CompressedOutputStream::write(const String& str)
+    {
+        return writeBytes((const Byte*) str.toCstChar(), str.size());
+    }
+
+    bool CompressedOutputStream::write(const Real& str)
+    {
+        char buffer[NumberFormat::MaxRealSize];
+        size_t sz = NumberFormat::Format(buffer, str);
+        return writeBytes((const Byte*) buffer, sz);
+    }
+
+    bool CompressedOutputStream::write(const int& str)
+    {
+        char buffer[NumberFormat::MaxIntegerSize];
+        size_t sz = NumberFormat::Format(buffer, (int32_t) str);
+        return writeBytes((const Byte*) buffer, sz);
+    }
+
+    void CompressedOutputStream::seek(size_t, CursorPosition)
+    {
+        aprodebug("Can't seek in a compressed stream.");
+    }
+
+    DecompressingInputStream::DecompressingInputStream(InputStream& in)
+        : m_in(in), m_start(in.tell()), m_block(nullptr), m_compressed(nullptr), m_block_size(0),
+          m_size(0), m_pos(0), m_offset(0), m_ended(false), m_good(true)
+    {
+        readFrameHeader();
+    }
+
+    DecompressingInputStream::~DecompressingInputStream()
+    {
+        if(m_block)
+            AProDeallocate(m_block);
+        if(m_compressed)
+            AProDeallocate(m_compressed);
+    }
+
+    bool DecompressingInputStream::readFrameHeader()
+    {
+        uint32_t magic = 0, block_size = 0;
+        if(!ReadUInt32(m_in, magic) || !ReadUInt32(m_in, block_size) ||
+           magic != FrameMagic || !block_size || block_size > FrameMaxBlock)
+        {
+            aprodebug("Stream is not a compressed frame.");
+            m_good  = false;
+            m_ended = true;
+            return false;
+        }
+
+        if(block_size != m_block_size)
+        {
+            if(m_block)
+                AProDeallocate(m_block);
+            if(m_compressed)
+                AProDeallocate(m_compressed);
+
+            m_block_size = block_size;
+            m_block      = (Byte*) AProAllocate(m_block_size);
+            m_compressed = (Byte*) AProAllocate(LZCodec::CompressBound(m_block_size));
+        }
+
+        return true;
+    }
+
+    bool DecompressingInputStream::fill()
+    {
+        if(m_pos < m_size)
+            return true;
+        if(m_ended)
+            return false;
+
+        m_offset += m_size;
+        m_size    = 0;
+        m_pos     = 0;
+
+        uint32_t header;
+        if(!ReadUInt32(m_in, header))
+        {
+            aprodebug("Compressed frame is truncated.");
+            m_good  = false;
+            m_ended = true;
+            return false;
+        }
+
+        if(!header)
+        {
+            m_ended = true;
+            return false;
+        }
+
+        size_t sz = header & ~FrameStoredBlock;
+        if(header & FrameStoredBlock)
+        {
+            if(sz > m_block_size || m_in.readBytes(m_block, sz) != sz)
+            {
+                aprodebug("Compressed frame is corrupted.");
+                m_good  = false;
+                m_ended = true;
+                return false;
+            }
+
+            m_size = sz;
+        }
+        else
+        {
+            if(sz > LZCodec::CompressBound(m_block_size) || m_in.readBytes(m_compressed, sz) != sz ||
+               !LZCodec::Decompress(m_compressed, sz, m_block, m_block_size, m_size))
+            {
+                aprodebug("Compressed frame is corrupted.");
+                m_good  = false;
+                m_ended = true;
+                return false;
+            }
+        }
+
+        // An empty block does not end the frame.
+        return fill();
+    }
+
+    bool DecompressingInputStream::isEOS() const
+    {
+        return m_pos >= m_size && m_ended;
+    }
+
+    bool DecompressingInputStream::readChar(char& to)
+    {
+        if(!fill())
+            return false;
+
+        to = (char) m_block[m_pos++];
+        return true;
+    }
+
+    size_t DecompressingInputStream::readBytes(Byte* bytes, size_t sz)
+    {
+        size_t read = 0;
+        while(read < sz && fill())
+        {
+            size_t chunk = m_size - m_pos;
+            if(chunk > sz - read)
+                chunk = sz - read;
+
+            memcpy(bytes + read, m_block + m_pos, chunk);
+            m_pos += chunk;
+            read  += chunk;
+        }
+
+        return read;
+    }
+
+    bool DecompressingInputStream::skipBlanck(char& c)
+    {
+        if(!readChar(c))
+            return false;
+
+        while(isblank((unsigned char) c))
+        {
+            // Only blanck characters until the end : the last one is
+            // returned.
+            if(!readChar(c))
+                return true;
+        }
+
+        return true;
+    }
+
+    void DecompressingInputStream::readSpan(String& str, const bool* accepted)
+    {
+        while(fill())
+        {
+            const Byte* data = m_block + m_pos;
+            size_t available = m_size - m_pos;
+
+            size_t sz = 0;
+            while(sz < available && accepted[data[sz]])
+                sz++;
+
+            str.append((const char*) data, sz);
+            if(sz < available)
+            {
+                m_pos += sz + 1;
+                return;
+            }
+
+            // The span goes on in the next block.
+            m_pos += sz;
+        }
+    }
+
+    bool DecompressingInputStream::readWord(String& str)
+    {
+        char c;
+        if(!skipBlanck(c))
+            return false;
+
+        if(!StringSearch::AlphaTable[(unsigned char) c])
+            return true;
+
+        str.append(c);
+        readSpan(str, StringSearch::AlphaTable);
+        return true;
+    }
+
+    bool DecompressingInputStream::readLine(String& str)
+    {
+        if(!fill())
+            return false;
+
+        static bool not_eol[256];
+        static bool not_eol_init = false;
+        if(!not_eol_init)
+        {
+            for(int i = 0; i < 256; ++i)
+                not_eol[i] = i != '\n';
+            not_eol_init = true;
+        }
+
+        size_t begin = str.size();
+        readSpan(str, not_eol);
+
+        // Windows line ending.
+        if(str.size() > begin && str[str.size() - 1] == '\r')
+            str = str.extract(0, str.size() - 1);
+        return true;
+    }
+
+    bool DecompressingInputStream::readUntill(String& str, ByteArray clist)
+    {
+        if(!fill())
+            return false;
+
+        bool accepted[256];
+        for(int i = 0; i < 256; ++i)
+            accepted[i] = true;
+        for(ByteArray::const_iterator it = clist.begin(); it != clist.end(); ++it)
+            accepted[*it] = false;
+
+        readSpan(str, accepted);
+        return true;
+    }
+
+    bool DecompressingInputStream::readReal(Real& r)
+    {
+        char c;
+        if(!skipBlanck(c))
+            return false;
+
+        // The character following the number is skipped as
+        // FileStream does.
+        char   number[NumberFormat::MaxRealSize];
+        size_t sz = 0;
+        while(isdigit((unsigned char) c) || c == '+' || c == '-' || c == '.' || c == 'e' || c == 'E')
+        {
+            if(sz < NumberFormat::MaxRealSize)
+                number[sz] = c;
+            sz++;
+            if(!readChar(c))
+                break;
+        }
+
+        Real value = 0;
+        if(!NumberFormat::Parse(number, sz < NumberFormat::MaxRealSize ? sz : NumberFormat::MaxRealSize, value))
+            return false;
+
+        r = value;
+        return true;
+    }
+
+    bool DecompressingInputStream::readInt(int& i)
+    {
+        char c;
+        if(!skipBlanck(c))
+            return false;
+
+        char   number[NumberFormat::MaxIntegerSize];
+        size_t sz = 0;
+        while(isdigit((unsigned char) c) || (sz == 0 && (c == '-' || c == '+')))
+        {
+            if(sz == NumberFormat::MaxIntegerSize)
+            {
+                aprodebug("Integer too long in compressed stream.");
+                return false;
+            }
+
+            number[sz++] = c;
+            if(!readChar(c))
+                break;
+        }
+
+        int32_t value = 0;
+        if(!NumberFormat::Parse(number, sz, value))
+            return false;
+
+        i = value;
+        return true;
+    }
+
+    size_t DecompressingInputStream::size()
+    {
+        size_t pos = tell();
+        seek(0, CP_END);
+        size_t ret = tell();
+        seek(pos, CP_BEGIN);
+        return ret;
+    }
+
+    void DecompressingInputStream::seek(size_t pos, CursorPosition cp)
+    {
+        size_t target = cp == CP_CUR ? tell() + pos : (cp == CP_END ? (size_t) -1 : pos);
+
+        if(target < m_offset)
+        {
+            // Blocks are not kept : the frame is read again.
+            m_in.seek(m_start, CP_BEGIN);
+            m_size   = 0;
+            m_pos    = 0;
+            m_offset = 0;
+            m_ended  = false;
+            m_good   = true;
+            if(!readFrameHeader())
+                return;
+        }
+
+        if(target - m_offset < m_size)
+        {
+            m_pos = target - m_offset;
+            return;
+        }
+
+        m_pos = m_size;
+        while(fill())
+        {
+            if(target - m_offset < m_size)
+            {
+                m_pos = target - m_offset;
+                return;
+            }
+
+            m_pos = m_size;
+        }
+    }
+}
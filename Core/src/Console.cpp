@@ -31,6 +31,7 @@
 ////////////////////////////////////////////////////////////
 #define _WIN32_WINNT 0x0500
 #include "Console.h"
+#include "NumberFormat.h"
 #include <stdio.h>
 #include <iostream>
 #include "ThreadMutex.h"
@@ -69,7 +70,9 @@ namespace APro
             {
                 fprintf(file, "Console Log");
                 fprintf(file, "\n-----------\n\n");
-                fprintf(file, "%s", dumpedLog.toCstChar());
+                dumpedLog.forEachChunk([file] (const StringView& chunk) {
+                    fwrite(chunk.data(), 1, chunk.size(), file);
+                });
                 fclose(file);
             }
         }
@@ -171,16 +174,14 @@ namespace APro
 
     Console& Console::operator<<(int i)
     {
-        char buffer[33];
-        sprintf(buffer, "%d", i);
-        return put(String(buffer));
+        char buffer[NumberFormat::MaxIntegerSize];
+        return put(String(buffer, NumberFormat::Format(buffer, (int32_t) i)));
     }
 
     Console& Console::operator<<(unsigned long li)
     {
-        char buffer[33];
-        sprintf(buffer, "%lu", li);
-        return put(String(buffer));
+        char buffer[NumberFormat::MaxIntegerSize];
+        return put(String(buffer, NumberFormat::Format(buffer, (uint64_t) li)));
     }
 
     Console& Console::operator<<(Real r)
@@ -190,9 +191,8 @@ namespace APro
 
     Console& Console::operator<< (unsigned int u)
     {
-        char buffer[33];
-        sprintf(buffer, "%u", u);
-        return put(String(buffer));
+        char buffer[NumberFormat::MaxIntegerSize];
+        return put(String(buffer, NumberFormat::Format(buffer, (uint32_t) u)));
     }
 
 #if APRO_PLATFORM == APRO_WINDOWS
@@ -209,7 +209,7 @@ namespace APro
 
         printf(str.toCstChar());
 
-        dumpedLog.append(str);
+        dumpedLog << str;
     }
 
 #else
@@ -237,7 +237,7 @@ namespace APro
 
         printf("%s", str.toCstChar());
 
-        dumpedLog.append(str);
+        dumpedLog << str;
     }
 
     #undef makeC
@@ -12,6 +12,8 @@
 **/
 /////////////////////////////////////////////////////////////
 #include "Dictionnary.h"
+#include "BinaryStream.h"
+#include "Console.h"
 
 namespace APro
 {
@@ -25,4 +27,132 @@ namespace APro
 
         console << "\n]";
     }
+
+    /// Type of a serialized Variant.
+    enum VariantTag
+    {
+        VT_Empty  = 0,
+        VT_Bool   = 1,
+        VT_Int    = 2,
+        VT_UInt   = 3,
+        VT_Float  = 4,
+        VT_Double = 5,
+        VT_String = 6
+    };
+
+    BinaryOutputStream& operator << (BinaryOutputStream& stream, const Dictionnary& dict)
+    {
+        size_t count = 0;
+        Dictionnary::const_iterator e = dict.end();
+        for(Dictionnary::const_iterator it = dict.begin(); it != e; it++)
+            count++;
+
+        stream.writeVarUInt(count);
+        for(Dictionnary::const_iterator it = dict.begin(); it != e && stream; it++)
+        {
+            const Variant& value = it.value();
+            stream << it.key();
+
+            if(value.isCompatible<bool>())
+            {
+                stream << (uint8_t) VT_Bool << (uint8_t) value.cast<bool>();
+            }
+            else if(value.isCompatible<int>())
+            {
+                stream << (uint8_t) VT_Int;
+                stream.writeVarInt(value.cast<int>());
+            }
+            else if(value.isCompatible<unsigned int>())
+            {
+                stream << (uint8_t) VT_UInt;
+                stream.writeVarUInt(value.cast<unsigned int>());
+            }
+            else if(value.isCompatible<float>())
+            {
+                stream << (uint8_t) VT_Float << value.cast<float>();
+            }
+            else if(value.isCompatible<double>())
+            {
+                stream << (uint8_t) VT_Double << value.cast<double>();
+            }
+            else if(value.isCompatible<String>())
+            {
+                stream << (uint8_t) VT_String << value.cast<String>();
+            }
+            else
+            {
+                if(!value.isEmpty())
+                    aprodebug("Value '") << it.key() << "' can't be serialized.";
+                stream << (uint8_t) VT_Empty;
+            }
+        }
+
+        return stream;
+    }
+
+    BinaryInputStream& operator >> (BinaryInputStream& stream, Dictionnary& dict)
+    {
+        uint64_t count;
+        if(!stream.readVarUInt(count))
+            return stream;
+
+        for(uint64_t entry = 0; entry < count && stream; ++entry)
+        {
+            String  key;
+            uint8_t tag;
+            Variant value;
+            stream >> key >> tag;
+
+            bool     b;
+            int64_t  i;
+            uint64_t u;
+            float    f;
+            double   d;
+            String   str;
+
+            switch(tag)
+            {
+            case VT_Bool:
+                if(stream.read(b))
+                    value = b;
+                break;
+            case VT_Int:
+                if(stream.readVarInt(i))
+                    value = (int) i;
+                break;
+            case VT_UInt:
+                if(stream.readVarUInt(u))
+                    value = (unsigned int) u;
+                break;
+            case VT_Float:
+                if(stream.read(f))
+                    value = f;
+                break;
+            case VT_Double:
+                if(stream.read(d))
+                    value = d;
+                break;
+            case VT_String:
+                if(stream.read(str))
+                    value = str;
+                break;
+            case VT_Empty:
+                break;
+            default:
+                // Written by a newer version, or corrupted : the size
+                // of the value is unknown, so nothing after it can be read.
+                if(stream)
+                {
+                    aprodebug("Value '") << key << "' has unknown type " << (int) tag << ".";
+                    stream.setFailed();
+                }
+                break;
+            }
+
+            if(stream)
+                dict.push(key, value);
+        }
+
+        return stream;
+    }
 }
@@ -14,6 +14,9 @@
 #include "Directory.h"
 #include "Console.h"
 #include "FileSystem.h"
+#include "DirectoryScanner.h"
+
+#include <algorithm>
 
 namespace APro
 {
@@ -133,12 +136,9 @@ namespace APro
             rewind();
 
             int i = 0;
-            Entry e = next();
-            while(!e.isEnd())
-            {
+            Entry e;
+            while(*this >> e)
                 ++i;
-                *this >> e;
-            }
 
             rewind();
             return i;
@@ -220,26 +220,56 @@ namespace APro
 
     bool Directory::isEmpty()
     {
-        return countEntries() == 0;
+        if(!isOpened())
+            return false;
+
+        // Stops at the first entry which is not '.' or '..'.
+        rewind();
+
+        bool empty = true;
+        struct dirent* _e;
+        while(empty && (_e = readdir(hDir)) != nullptr)
+        {
+            const char* name = _e->d_name;
+            empty = name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'));
+        }
+
+        rewind();
+        return empty;
     }
 
     void Directory::makeEmpty(bool recursive_mode)
     {
         if(isOpened())
         {
-            Entry e = Entry::Invalid;
-            while (e != Entry::End)
-            {
-                *this >> e;
-                if(e == Entry::Invalid)
-                    break;
+            // One scan gives every entry with its type, without
+            // stat'ing each of them.
+            DirectoryScanner scanner;
+            scanner.setRecursive(recursive_mode);
+            Array<DirectoryScanner::Entry> entries = scanner.scan(m_dir_path);
 
-                if (FileSystem::IsDirectory(e.name))
-                    FileSystem::RemoveDirectory(e.name, recursive_mode);
-                else
-                    FileSystem::RemoveFile(e.name);
+            for(size_t i = 0; i < entries.size(); ++i)
+            {
+                if(entries[i].type != DirectoryScanner::ET_Directory)
+                    FileSystem::RemoveFile(entries[i].path);
+            }
 
+            // Subdirectories are removed before their parents : their
+            // paths are longer.
+            Array<const Path*> directories;
+            for(size_t i = 0; i < entries.size(); ++i)
+            {
+                if(entries[i].type == DirectoryScanner::ET_Directory)
+                    directories.append(&entries[i].path);
             }
+
+            std::sort(directories.begin(), directories.end(),
+                      [] (const Path* a, const Path* b) { return a->size() > b->size(); });
+
+            for(size_t i = 0; i < directories.size(); ++i)
+                FileSystem::RemoveDirectory(*directories[i], false);
+
+            rewind();
         }
     }
 
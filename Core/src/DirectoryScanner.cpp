@@ -0,0 +1,402 @@
+/////////////////////////////////////////////////////////////
+/** @file DirectoryScanner.cpp
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the DirectoryScanner class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "DirectoryScanner.h"
+#include "FileSystem.h"
+#include "Console.h"
+
+#ifdef _COMPILE_WITH_PTHREAD_
+#   include "Thread.h"
+#   include "ThreadMutexI.h"
+#   include "ThreadCondition.h"
+#endif
+
+#include <cerrno>
+#include <cstring>
+#include <sys/stat.h>
+
+#if APRO_PLATFORM != APRO_WINDOWS
+#   include <dirent.h>
+#   include <fcntl.h>
+#endif
+
+#if APRO_PLATFORM == APRO_LINUX
+#   include <unistd.h>
+#   include <sys/syscall.h>
+#endif
+
+namespace APro
+{
+#if APRO_PLATFORM == APRO_LINUX
+
+    /// Entry returned by getdents64.
+    struct LinuxDirent64
+    {
+        uint64_t       d_ino;
+        int64_t        d_off;
+        unsigned short d_reclen;
+        unsigned char  d_type;
+        char           d_name[1];
+    };
+
+#endif
+
+#if APRO_PLATFORM != APRO_WINDOWS
+
+    /// Returns the type given by the directory listing, or stats
+    /// the entry if the file system does not give it.
+    static DirectoryScanner::EntryType GetEntryType(int dirfd, const char* name, unsigned char d_type)
+    {
+        switch(d_type)
+        {
+            case DT_REG: return DirectoryScanner::ET_File;
+            case DT_DIR: return DirectoryScanner::ET_Directory;
+            case DT_UNKNOWN: break;
+            default: return DirectoryScanner::ET_Other;
+        }
+
+        struct stat st;
+        if(fstatat(dirfd, name, &st, AT_SYMLINK_NOFOLLOW) != 0)
+            return DirectoryScanner::ET_Other;
+
+        if(S_ISREG(st.st_mode))
+            return DirectoryScanner::ET_File;
+        if(S_ISDIR(st.st_mode))
+            return DirectoryScanner::ET_Directory;
+        return DirectoryScanner::ET_Other;
+    }
+
+#endif
+
+    DirectoryScanner::DirectoryScanner()
+        : m_recursive(false), m_skip_files(false), m_skip_dirs(false), m_skip_hidden(false), m_threads(DefaultThreads)
+    {
+
+    }
+
+    void DirectoryScanner::addExtension(const String& extension)
+    {
+        String lower;
+        for(size_t i = 0; i < extension.size(); ++i)
+            lower.append(String::toLower(extension[i]));
+        m_extensions.append(lower);
+    }
+
+    bool DirectoryScanner::Match(const StringView& pattern, const StringView& name)
+    {
+        size_t p = 0, n = 0;
+        size_t star = pattern.size(), retry = 0;
+
+        while(n < name.size())
+        {
+            if(p < pattern.size() && (pattern[p] == '?' || pattern[p] == name[n]))
+            {
+                p++;
+                n++;
+            }
+            else if(p < pattern.size() && pattern[p] == '*')
+            {
+                // Remember the star : if the rest does not match, it
+                // eats one more character.
+                star  = p++;
+                retry = n;
+            }
+            else if(star != pattern.size())
+            {
+                p = star + 1;
+                n = ++retry;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        while(p < pattern.size() && pattern[p] == '*')
+            p++;
+        return p == pattern.size();
+    }
+
+    bool DirectoryScanner::acceptsFile(const StringView& name) const
+    {
+        if(!m_pattern.isEmpty() && !Match(StringView(m_pattern.toCstChar(), m_pattern.size()), name))
+            return false;
+
+        if(m_extensions.isEmpty())
+            return true;
+
+        size_t dot = name.findLast('.');
+        if(dot == name.size())
+            return false;
+
+        StringView extension = name.extract(dot + 1, name.size());
+        for(size_t i = 0; i < m_extensions.size(); ++i)
+        {
+            const String& accepted = m_extensions[i];
+            if(accepted.size() != extension.size())
+                continue;
+
+            size_t c = 0;
+            while(c < extension.size() && String::toLower(extension[c]) == accepted[c])
+                c++;
+            if(c == extension.size())
+                return true;
+        }
+
+        return false;
+    }
+
+    void DirectoryScanner::addEntry(const Path& directory, const char* name, EntryType type, Id ino,
+                                    Array<Entry>& entries, Array<Path>& directories) const
+    {
+        if(name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0')))
+            return;
+        if(m_skip_hidden && name[0] == '.')
+            return;
+
+        bool traverse = m_recursive && type == ET_Directory;
+        bool listed   = type == ET_Directory ? !m_skip_dirs
+                                             : !m_skip_files && acceptsFile(StringView(name));
+        if(!traverse && !listed)
+            return;
+
+        Path path(directory);
+        if(path.isEmpty() || path[path.size() - 1] != FileSystem::GetSeparator())
+            path.append(FileSystem::GetSeparator());
+        path.append(name);
+
+        if(traverse)
+            directories.append(path);
+
+        if(listed)
+        {
+            Entry entry;
+            entry.path  = path;
+            entry.type  = type;
+            entry.d_ino = ino;
+            entries.append(entry);
+        }
+    }
+
+    void DirectoryScanner::scanOne(const Path& directory, Array<Entry>& entries, Array<Path>& directories) const
+    {
+#if APRO_PLATFORM == APRO_LINUX
+
+        int fd = open(directory.toCstChar(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if(fd < 0)
+        {
+            aprodebug("Can't open directory '") << directory << "'.";
+            return;
+        }
+
+        // One call lists hundreds of entries, with their types.
+        alignas(8) char buffer[32 * 1024];
+        for(;;)
+        {
+            long sz = syscall(SYS_getdents64, fd, buffer, sizeof(buffer));
+            if(sz < 0 && errno == EINTR)
+                continue;
+            if(sz <= 0)
+                break;
+
+            for(long pos = 0; pos < sz;)
+            {
+                const LinuxDirent64* dirent = (const LinuxDirent64*) (buffer + pos);
+                pos += dirent->d_reclen;
+
+                addEntry(directory, dirent->d_name, GetEntryType(fd, dirent->d_name, dirent->d_type),
+                         (Id) dirent->d_ino, entries, directories);
+            }
+        }
+
+        close(fd);
+
+#elif APRO_PLATFORM == APRO_WINDOWS
+
+        DIR* dir = opendir(directory.toCstChar());
+        if(!dir)
+        {
+            aprodebug("Can't open directory '") << directory << "'.";
+            return;
+        }
+
+        // The listing does not give types : each entry is stat'ed.
+        struct dirent* ent;
+        while((ent = readdir(dir)) != nullptr)
+        {
+            Path path(directory);
+            path.append(FileSystem::GetSeparator());
+            path.append(ent->d_name);
+
+            EntryType type = FileSystem::IsDirectory(path) ? ET_Directory :
+                             (FileSystem::IsFile(path) ? ET_File : ET_Other);
+            addEntry(directory, ent->d_name, type, ent->d_ino, entries, directories);
+        }
+
+        closedir(dir);
+
+#else
+
+        DIR* dir = opendir(directory.toCstChar());
+        if(!dir)
+        {
+            aprodebug("Can't open directory '") << directory << "'.";
+            return;
+        }
+
+        struct dirent* ent;
+        while((ent = readdir(dir)) != nullptr)
+        {
+            addEntry(directory, ent->d_name, GetEntryType(dirfd(dir), ent->d_name, ent->d_type),
+                     (Id) ent->d_ino, entries, directories);
+        }
+
+        closedir(dir);
+
+#endif
+    }
+
+#ifdef _COMPILE_WITH_PTHREAD_
+
+    /// Directories waiting to be scanned, shared by the threads.
+    struct ScanQueue
+    {
+        ThreadMutexI    mutex;      ///< Protects every field.
+        ThreadCondition condition;  ///< Signaled when directories are queued, or the scan ends.
+        Array<Path>     directories;///< Directories found, scanned or not.
+        size_t          next;       ///< Index of the next directory to scan.
+        size_t          active;     ///< Number of directories being scanned.
+    };
+
+    /// Scans directories from the queue until every one is scanned.
+    static void ScanQueued(const DirectoryScanner* scanner, ScanQueue* queue, Array<DirectoryScanner::Entry>& entries)
+    {
+        Array<Path> found;
+
+        queue->mutex.lock();
+        for(;;)
+        {
+            // Directories being scanned may still queue others.
+            while(queue->next == queue->directories.size() && queue->active)
+                queue->condition.wait(&queue->mutex);
+            if(queue->next == queue->directories.size())
+                break;
+
+            Path directory = queue->directories[queue->next++];
+            queue->active++;
+            queue->mutex.unlock();
+
+            scanner->scanOne(directory, entries, found);
+
+            queue->mutex.lock();
+            queue->directories.append(found);
+            queue->active--;
+            if(!found.isEmpty() || !queue->active)
+                queue->condition.signalAll();
+            Array<Path>().swap(found);
+        }
+        queue->mutex.unlock();
+    }
+
+    class ScannerThread : public Thread
+    {
+    public:
+
+        ScannerThread(const DirectoryScanner* scanner, ScanQueue* queue)
+            : Thread(String("DirectoryScanner Worker")), m_scanner(scanner), m_queue(queue)
+        {
+
+        }
+
+        void exec()
+        {
+            ScanQueued(m_scanner, m_queue, entries);
+        }
+
+        Array<DirectoryScanner::Entry> entries;///< Entries found by this thread.
+
+    private:
+
+        const DirectoryScanner* m_scanner;
+        ScanQueue*              m_queue;
+    };
+
+#endif // _COMPILE_WITH_PTHREAD_
+
+    Array<DirectoryScanner::Entry> DirectoryScanner::scan(const Path& directory) const
+    {
+        Array<Entry> entries;
+        scan(directory, entries);
+        return entries;
+    }
+
+    size_t DirectoryScanner::scan(const Path& directory, Array<Entry>& entries) const
+    {
+        size_t before = entries.size();
+
+#ifdef _COMPILE_WITH_PTHREAD_
+        if(m_recursive && m_threads > 1)
+        {
+            ScanQueue queue;
+            queue.directories.append(directory);
+            queue.next   = 0;
+            queue.active = 0;
+
+            // The calling thread scans too.
+            Array<ScannerThread*> threads;
+            threads.reserve(m_threads - 1);
+            for(size_t i = 0; i < m_threads - 1; ++i)
+            {
+                threads.append(AProNew(ScannerThread, this, &queue));
+                threads[i]->start();
+            }
+
+            ScanQueued(this, &queue, entries);
+
+            for(size_t i = 0; i < threads.size(); ++i)
+            {
+                threads[i]->join();
+                entries.append(threads[i]->entries);
+                AProDelete(threads[i]);
+            }
+
+            return entries.size() - before;
+        }
+#endif // _COMPILE_WITH_PTHREAD_
+
+        Array<Path> directories;
+        directories.append(directory);
+        for(size_t next = 0; next < directories.size(); ++next)
+        {
+            Path current = directories[next];
+            scanOne(current, entries, directories);
+        }
+
+        return entries.size() - before;
+    }
+}
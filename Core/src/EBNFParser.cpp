@@ -103,8 +103,7 @@ namespace APro
         Token EBNFScanner::scanIdentifier()
         {
             TokPosition pos = createPosition();
-            char currchar   = getCurrentCharacter();
-            String content  = String(&currchar, 1);
+            int first       = currentCharacter;
             CharArray _equals; _equals << '-' << '_';
             
             while (hasNextCharacter())
@@ -112,31 +111,26 @@ namespace APro
                 nextCharacter();
                 
                 // Ensure this character is in identifier.
-                if(TokenScannerHelper::isAlphaNum(getCurrentCharacter()) ||
-                   TokenScannerHelper::isEquals(getCurrentCharacter(), _equals) )
-                {
-                    content.append(getCurrentCharacter());
-                }
-                else
+                if(!TokenScannerHelper::isAlphaNum(getCurrentCharacter()) &&
+                   !TokenScannerHelper::isEquals(getCurrentCharacter(), _equals) )
                 {
                     backupCharacter();
                     break;
                 }
             }
             
-            return Token (TokIdentifier, content, pos);
+            return Token (TokIdentifier, getInputView(first, currentCharacter + 1), pos);
         }
         
         Token EBNFScanner::scanLiteral()
         {
             TokPosition pos = createPosition();
             char _start = getCurrentCharacter();
-            String content(&_start, 1);
+            int first   = currentCharacter;
             
             while (hasNextCharacter())
             {
                 nextCharacter();
-                content.append(getCurrentCharacter());
                 
                 // Ensure begin and end of literal.
                 if(TokenScannerHelper::isQuote(getCurrentCharacter()) && getCurrentCharacter() == _start) {
@@ -144,56 +138,48 @@ namespace APro
                 }
             }
             
-            return Token (TokLiteral, content, pos);
+            return Token (TokLiteral, getInputView(first, currentCharacter + 1), pos);
         }
         
         Token EBNFScanner::scanComment()
         {
-        	char currchar   = getCurrentCharacter();
             TokPosition pos = createPosition();
-            String content  = String(&currchar, 1);
+            int first       = currentCharacter;
             
             while (hasNextCharacter())
             {
                 nextCharacter();
-                content.append(getCurrentCharacter());
                 
                 if(getCurrentCharacter() == '*' && peekCharacter() == ')')
                 {
                     nextCharacter();
-                    content.append(getCurrentCharacter());
                     break;
                 }
                 
                 checkNewLine();
             }
             
-            return Token (TokComment, content, pos);
+            return Token (TokComment, getInputView(first, currentCharacter + 1), pos);
         }
         
         Token EBNFScanner::scanOperator()
         {
             TokPosition pos = createPosition();
-            char currchar   = getCurrentCharacter();
-            String content  = String(&currchar, 1);
+            int first       = currentCharacter;
             char peak       = peekCharacter();
             
             if(getCurrentCharacter() == ':' && peak == ':')
             {
                 nextCharacter();
-                content.append(getCurrentCharacter());
                 nextCharacter();
                 
                 if(getCurrentCharacter() != '=') {
                     raiseError (String("Expecting '=' but got '") + getCurrentCharacter() + "' instead.");
-                    content.append(getCurrentCharacter());
-                    return Token (Token::TypeInvalid, content, pos);
+                    return Token (Token::TypeInvalid, getInputView(first, currentCharacter + 1), pos);
                 }
-                
-                content.append(getCurrentCharacter());
             }
             
-            return Token (TokOperator, content, pos);
+            return Token (TokOperator, getInputView(first, currentCharacter + 1), pos);
         }
         
         String EBNFScanner::GetUnquotedLiteral(const Token& literal)
@@ -32,6 +32,7 @@
 #include "EventEmitter.h"
 #include "EventUniter.h"
 #include "Console.h"
+#include "StringBuilder.h"
 
 namespace APro
 {
@@ -247,8 +248,9 @@ namespace APro
 
     String EventEmitter::documentation() const
     {
-        String ret("[EventEmitter] Events documentation");
-        ret   << "\n-----------------------------------"
+        StringBuilder ret;
+        ret   << "[EventEmitter] Events documentation"
+              << "\n-----------------------------------"
               << "\n";
 			
 		APRO_THREADSAFE_AUTOLOCK
@@ -256,11 +258,11 @@ namespace APro
         EventsList::const_iterator e = events.end();
         for (EventsList::const_iterator it = events.begin(); it != e; it++)
         {
-            ret << " + Hash['" << String::toString(it.key()) << "'] : " << it.value() << "\n";
+            ret << " + Hash['" << it.key() << "'] : " << it.value() << "\n";
         }
 
         ret << "-----------------------------------";
-        return ret;
+        return ret.toString();
     }
 
     const String& EventEmitter::getEventDocumentation(const HashType& event) const
@@ -280,6 +282,11 @@ namespace APro
     {
         return events.keyExists(event);
     }
+
+    bool EventEmitter::isEventHandled(const Atom& event) const
+    {
+        return events.keyExists(event.hash());
+    }
     
     EventListenerPtr EventEmitter::registerListener(const String& nlistener)
     {
@@ -442,6 +449,11 @@ namespace APro
         return -1;
     }
 
+    int EventEmitter::unregisterListener(const Atom& name)
+    {
+        return unregisterListener(name.toString());
+    }
+
     const EventListenerPtr& EventEmitter::getListener(const String& name) const
     {
         if(!name.isEmpty())
@@ -520,6 +532,30 @@ namespace APro
         return EventListenerPtr::Null;
     }
 
+    const EventListenerPtr& EventEmitter::getListener(const Atom& name) const
+    {
+        return const_cast<EventEmitter*>(this)->getListener(name);
+    }
+
+    EventListenerPtr& EventEmitter::getListener(const Atom& name)
+    {
+        if(!name.isEmpty())
+        {
+            APRO_THREADSAFE_AUTOLOCK
+
+            for(unsigned int i = 0; i < listeners.size(); ++i)
+            {
+                EventListenerPtr& _listener = listeners.at(i);
+                if(!_listener.isNull() && _listener->getAtom() == name)
+                {
+                    return _listener;
+                }
+            }
+        }
+
+        return EventListenerPtr::Null;
+    }
+
     EventLocalPtr EventEmitter::createEvent(const HashType& e_type) const
     {
         aprodebug("Creating default NullEvent because no overwritten function is available.");
@@ -37,6 +37,7 @@ namespace APro
     EventListener::EventListener(const String& name)
     {
         m_name = name;
+        m_atom = Atom(name);
         id     = IdGenerator::Get().canPick() ? IdGenerator::Get().pick() : 0;
         last_event = nullptr;
     }
@@ -44,6 +45,7 @@ namespace APro
     EventListener::EventListener(const EventListener& other)
     {
         m_name = other.m_name;
+        m_atom = other.m_atom;
         id     = IdGenerator::Get().canPick() ? IdGenerator::Get().pick() : 0;
         last_event = nullptr;
     }
@@ -74,6 +76,11 @@ namespace APro
         return m_name;
     }
 
+    const Atom& EventListener::getAtom() const
+    {
+        return m_atom;
+    }
+
     const EventRef EventListener::getLastEventReceived() const
     {
         return *last_event;
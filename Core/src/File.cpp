@@ -35,6 +35,10 @@
 
 #include "Console.h"
 
+#if APRO_PLATFORM == APRO_WINDOWS
+#   include <io.h>
+#endif
+
 namespace APro
 {
     File::File()
@@ -108,7 +112,61 @@ namespace APro
 
         return false;
     }
+
+    size_t File::readSome(Byte* buffer, size_t sz)
+    {
+        if(isOpened())
+        {
+            if(m_last_operation == 2)
+                flush();
+
+            m_last_operation = 1;
+            return fread(buffer, sizeof(Byte), sz, hFile);
+        }
+
+        return 0;
+    }
     
+    FileMapping File::map(FileMapping::Advice advice)
+    {
+        FileMapping mapping;
+        if(isOpened())
+        {
+            if(m_last_operation == 2)
+                flush();
+
+            if(!mapping.map(hFile, advice))
+                aprodebug("Can't map file '") << getFileName() << "'.";
+        }
+
+        return mapping;
+    }
+
+    IOFuture File::readAsync(Offset offset, Byte* buffer, size_t sz, const IOCallback& callback)
+    {
+        if(isOpened() && m_last_operation == 2)
+            flush();
+
+        return AsyncIO::Get().submit(IORequest::Read, getIOHandle(), offset, buffer, sz, callback);
+    }
+
+    IOFuture File::writeAsync(Offset offset, const Byte* bytes, size_t sz, const IOCallback& callback)
+    {
+        if(isOpened() && m_last_operation == 2)
+            flush();
+
+        return AsyncIO::Get().submit(IORequest::Write, getIOHandle(), offset, const_cast<Byte*>(bytes), sz, callback);
+    }
+
+    IOHandle File::getIOHandle() const
+    {
+#if APRO_PLATFORM == APRO_WINDOWS
+        return isOpened() ? (IOHandle) _get_osfhandle(_fileno(hFile)) : INVALID_HANDLE_VALUE;
+#else
+        return isOpened() ? fileno(hFile) : -1;
+#endif
+    }
+
     void File::readbom()
     {
         // Try to read UTF8 BOM
@@ -0,0 +1,229 @@
+/////////////////////////////////////////////////////////////
+/** @file FileMapping.cpp
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the FileMapping class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "FileMapping.h"
+#include "Console.h"
+
+#if APRO_PLATFORM == APRO_WINDOWS
+#   include <io.h>
+#else
+#   include <sys/mman.h>
+#endif
+
+namespace APro
+{
+    FileMapping::FileMapping()
+        : m_data(nullptr), m_size(0), m_valid(false)
+#if APRO_PLATFORM == APRO_WINDOWS
+        , m_handle(NULL)
+#endif
+    {
+
+    }
+
+    FileMapping::FileMapping(FileMapping&& rhs)
+        : m_data(rhs.m_data), m_size(rhs.m_size), m_valid(rhs.m_valid)
+#if APRO_PLATFORM == APRO_WINDOWS
+        , m_handle(rhs.m_handle)
+#endif
+    {
+        rhs.m_data  = nullptr;
+        rhs.m_size  = 0;
+        rhs.m_valid = false;
+#if APRO_PLATFORM == APRO_WINDOWS
+        rhs.m_handle = NULL;
+#endif
+    }
+
+    FileMapping& FileMapping::operator = (FileMapping&& rhs)
+    {
+        if(this != &rhs)
+        {
+            unmap();
+
+            m_data  = rhs.m_data;
+            m_size  = rhs.m_size;
+            m_valid = rhs.m_valid;
+            rhs.m_data  = nullptr;
+            rhs.m_size  = 0;
+            rhs.m_valid = false;
+#if APRO_PLATFORM == APRO_WINDOWS
+            m_handle     = rhs.m_handle;
+            rhs.m_handle = NULL;
+#endif
+        }
+
+        return *this;
+    }
+
+    FileMapping::~FileMapping()
+    {
+        unmap();
+    }
+
+#if APRO_PLATFORM == APRO_WINDOWS
+
+    bool FileMapping::map(FILE* file, Advice advice)
+    {
+        unmap();
+
+        if(!file)
+            return false;
+
+        HANDLE hfile = (HANDLE) _get_osfhandle(_fileno(file));
+        LARGE_INTEGER size;
+        if(hfile == INVALID_HANDLE_VALUE || !GetFileSizeEx(hfile, &size))
+            return false;
+
+        // Empty files can't be mapped, but are valid.
+        if(size.QuadPart == 0)
+        {
+            m_valid = true;
+            return true;
+        }
+
+        m_handle = CreateFileMapping(hfile, NULL, PAGE_READONLY, 0, 0, NULL);
+        if(!m_handle)
+        {
+            aprodebug("Can't create file mapping (error ") << (int) GetLastError() << ").";
+            return false;
+        }
+
+        m_data = (const Byte*) MapViewOfFile(m_handle, FILE_MAP_READ, 0, 0, 0);
+        if(!m_data)
+        {
+            aprodebug("Can't map view of file (error ") << (int) GetLastError() << ").";
+            CloseHandle(m_handle);
+            m_handle = NULL;
+            return false;
+        }
+
+        m_size  = (size_t) size.QuadPart;
+        m_valid = true;
+        advise(advice);
+        return true;
+    }
+
+    void FileMapping::unmap()
+    {
+        if(m_data)
+            UnmapViewOfFile(m_data);
+        if(m_handle)
+            CloseHandle(m_handle);
+
+        m_data   = nullptr;
+        m_size   = 0;
+        m_valid  = false;
+        m_handle = NULL;
+    }
+
+    void FileMapping::advise(Advice advice)
+    {
+        // Windows reads ahead by itself, it only can be asked to load
+        // the pages now.
+        if(advice == WillNeed && m_data)
+        {
+            WIN32_MEMORY_RANGE_ENTRY range;
+            range.VirtualAddress = (PVOID) m_data;
+            range.NumberOfBytes  = m_size;
+            PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+        }
+    }
+
+#else
+
+    bool FileMapping::map(FILE* file, Advice advice)
+    {
+        unmap();
+
+        if(!file)
+            return false;
+
+        int fd = fileno(file);
+        struct stat st;
+        if(fd < 0 || fstat(fd, &st) != 0)
+            return false;
+
+        // Empty files can't be mapped, but are valid.
+        if(st.st_size == 0)
+        {
+            m_valid = true;
+            return true;
+        }
+
+        void* data = mmap(nullptr, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if(data == MAP_FAILED)
+        {
+            aprodebug("Can't map file (errno ") << (int) errno << ").";
+            return false;
+        }
+
+        m_data  = (const Byte*) data;
+        m_size  = (size_t) st.st_size;
+        m_valid = true;
+        advise(advice);
+        return true;
+    }
+
+    void FileMapping::unmap()
+    {
+        if(m_data)
+            munmap((void*) m_data, m_size);
+
+        m_data  = nullptr;
+        m_size  = 0;
+        m_valid = false;
+    }
+
+    void FileMapping::advise(Advice advice)
+    {
+        if(!m_data)
+            return;
+
+        int flag = MADV_NORMAL;
+        switch(advice)
+        {
+        case Sequential:
+            flag = MADV_SEQUENTIAL;
+            break;
+        case Random:
+            flag = MADV_RANDOM;
+            break;
+        case WillNeed:
+            flag = MADV_WILLNEED;
+            break;
+        case Normal:
+        default:
+            break;
+        }
+
+        madvise((void*) m_data, m_size, flag);
+    }
+
+#endif
+}
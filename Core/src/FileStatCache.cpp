@@ -0,0 +1,436 @@
+/////////////////////////////////////////////////////////////
+/** @file FileStatCache.cpp
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the FileStatCache class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "FileStatCache.h"
+#include "FileSystem.h"
+#include "DirectoryScanner.h"
+#include "Array.h"
+
+#include <cstdlib>
+
+#if APRO_PLATFORM != APRO_WINDOWS
+#   include <sys/stat.h>
+#endif
+
+#if APRO_PLATFORM == APRO_LINUX
+#   include <unistd.h>
+#   include <sys/inotify.h>
+#endif
+
+namespace APro
+{
+#if APRO_PLATFORM == APRO_LINUX
+    /// Changes of a watched directory which invalidate entries.
+    static const uint32_t WatchMask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO |
+                                      IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+#endif
+
+    /// Asks the system about given path.
+    static FileStat SystemStat(const String& path)
+    {
+        FileStat st;
+
+#if APRO_PLATFORM == APRO_WINDOWS
+
+        DWORD attributes = GetFileAttributesA(path.toCstChar());
+        st.exists    = attributes != INVALID_FILE_ATTRIBUTES;
+        st.directory = st.exists && (attributes & FILE_ATTRIBUTE_DIRECTORY);
+
+#else
+
+        struct stat s;
+        st.exists    = ::stat(path.toCstChar(), &s) == 0;
+        st.directory = st.exists && S_ISDIR(s.st_mode);
+
+#endif
+
+        return st;
+    }
+
+    /// Asks the system for the absolute path of given path.
+    static String SystemAbsolutePath(const String& path)
+    {
+#if APRO_PLATFORM == APRO_WINDOWS
+
+        TCHAR buffer[BUFSIZ] = TEXT("");
+        GetFullPathName(path.toCstChar(), BUFSIZ, buffer, NULL);
+        return String(buffer);
+
+#else
+
+        char* actualpath = realpath(path.toCstChar(), NULL);
+        if(!actualpath)
+            return String();
+
+        String ret(actualpath);
+        free(actualpath);
+        return ret;
+
+#endif
+    }
+
+    /// Returns the normalized path of an entry of given normalized
+    /// directory.
+    static String JoinPath(const String& directory, const char* name)
+    {
+        if(directory == ".")
+            return String(name);
+
+        String path(directory);
+        if(path[path.size() - 1] != FileSystem::GetSeparator())
+            path.append(FileSystem::GetSeparator());
+        path.append(name);
+        return path;
+    }
+
+    /// Returns the directory holding given normalized path, or an
+    /// empty string for '.' and the root.
+    static String ParentOf(const String& path)
+    {
+        if(path == "." || path == "/")
+            return String();
+
+        size_t separator = path.findLast(FileSystem::GetSeparator());
+        if(separator == path.size())
+            return String(".");
+        if(separator == 0)
+            return String("/");
+        return path.extract(0, separator);
+    }
+
+    APRO_IMPLEMENT_SINGLETON(FileStatCache)
+
+    FileStatCache::FileStatCache()
+        : m_stats(1024), m_absolutes(64), m_watched(64), m_watches(64),
+          m_enabled(false), m_ttl(DefaultTTL), m_watched_ttl(DefaultWatchedTTL), m_inotify(-1)
+    {
+
+    }
+
+    FileStatCache::~FileStatCache()
+    {
+        setEnabled(false);
+    }
+
+    void FileStatCache::setEnabled(bool enabled)
+    {
+        m_mutex.lock();
+
+        if(enabled && !m_enabled)
+        {
+#if APRO_PLATFORM == APRO_LINUX
+            m_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+        }
+        else if(!enabled && m_enabled)
+        {
+            clear();
+
+#if APRO_PLATFORM == APRO_LINUX
+            if(m_inotify >= 0)
+                close(m_inotify);
+            m_inotify = -1;
+#endif
+        }
+
+        m_enabled = enabled;
+        m_mutex.unlock();
+    }
+
+    bool FileStatCache::isFresh(bool watched, const Clock::time_point& time) const
+    {
+        unsigned ttl = (watched && m_inotify >= 0) ? m_watched_ttl : m_ttl;
+        if(!ttl)
+            return true;
+
+        return Clock::now() - time < std::chrono::milliseconds(ttl);
+    }
+
+    FileStat FileStatCache::stat(const String& path)
+    {
+        String key = Normalize(path);
+
+        m_mutex.lock();
+        readEvents();
+
+        if(m_stats.contains(key))
+        {
+            const CachedStat& cached = m_stats.get(key);
+            if(isFresh(cached.watched, cached.time))
+            {
+                FileStat st = cached.stat;
+                m_mutex.unlock();
+                return st;
+            }
+        }
+
+        // Watched before stat'ing, so a change following the stat
+        // is seen.
+        watch(ParentOf(key));
+        m_mutex.unlock();
+
+        FileStat st = SystemStat(key);
+
+        m_mutex.lock();
+        store(key, st);
+        m_mutex.unlock();
+        return st;
+    }
+
+    String FileStatCache::getAbsolutePath(const String& path)
+    {
+        m_mutex.lock();
+        readEvents();
+
+        if(m_absolutes.contains(path))
+        {
+            const CachedPath& cached = m_absolutes.get(path);
+            if(isFresh(false, cached.time))
+            {
+                String ret = cached.path;
+                m_mutex.unlock();
+                return ret;
+            }
+        }
+
+        m_mutex.unlock();
+
+        CachedPath cached;
+        cached.path = SystemAbsolutePath(path);
+        cached.time = Clock::now();
+
+        m_mutex.lock();
+        m_absolutes.put(path, cached);
+        m_mutex.unlock();
+        return cached.path;
+    }
+
+    size_t FileStatCache::prefetch(const String& directory, bool recursive)
+    {
+        String key = Normalize(directory);
+
+        m_mutex.lock();
+        watch(ParentOf(key));
+        bool watched = watch(key);
+        m_mutex.unlock();
+
+        if(!watched && !SystemStat(key).directory)
+            return 0;
+
+        DirectoryScanner scanner;
+        scanner.setRecursive(recursive);
+        Array<DirectoryScanner::Entry> entries = scanner.scan(Path(key));
+
+        m_mutex.lock();
+
+        FileStat st;
+        st.exists    = true;
+        st.directory = true;
+        store(key, st);
+
+        size_t count = 0;
+        for(size_t i = 0; i < entries.size(); ++i)
+        {
+            // Links are stat'ed when asked : their target is not
+            // known.
+            if(entries[i].type == DirectoryScanner::ET_Other)
+                continue;
+
+            st.directory = entries[i].type == DirectoryScanner::ET_Directory;
+            if(st.directory && recursive)
+                watch(entries[i].path);
+
+            store(entries[i].path, st);
+            count++;
+        }
+
+        m_mutex.unlock();
+        return count;
+    }
+
+    void FileStatCache::invalidate(const String& path)
+    {
+        m_mutex.lock();
+        m_stats.remove(Normalize(path));
+        m_absolutes.clear();
+        m_mutex.unlock();
+    }
+
+    void FileStatCache::invalidateAll()
+    {
+        // Relative paths are watched in the old working directory :
+        // the watches go too.
+        m_mutex.lock();
+        clear();
+        m_mutex.unlock();
+    }
+
+    void FileStatCache::store(const String& normalized, const FileStat& st)
+    {
+        CachedStat cached;
+        cached.stat    = st;
+        cached.time    = Clock::now();
+        cached.watched = false;
+
+        String parent = ParentOf(normalized);
+        if(!parent.isEmpty() && m_watched.contains(parent))
+            cached.watched = true;
+
+        m_stats.put(normalized, cached);
+    }
+
+    bool FileStatCache::watch(const String& directory)
+    {
+#if APRO_PLATFORM == APRO_LINUX
+
+        if(m_inotify < 0 || directory.isEmpty())
+            return false;
+        if(m_watched.contains(directory))
+            return true;
+
+        int wd = inotify_add_watch(m_inotify, directory.toCstChar(), WatchMask);
+        if(wd < 0)
+            return false;
+
+        // Two paths of one directory share its watch descriptor.
+        m_watched.put(directory, wd);
+        if(!m_watches.contains(wd))
+            m_watches.put(wd, Array<String>());
+        m_watches.get(wd).append(directory);
+        return true;
+
+#else
+
+        return false;
+
+#endif
+    }
+
+    void FileStatCache::readEvents()
+    {
+#if APRO_PLATFORM == APRO_LINUX
+
+        if(m_inotify < 0)
+            return;
+
+        alignas(struct inotify_event) char buffer[4096];
+        bool changed = false;
+        bool lost    = false;
+
+        for(;;)
+        {
+            ssize_t sz = read(m_inotify, buffer, sizeof(buffer));
+            if(sz <= 0)
+                break;
+
+            for(ssize_t pos = 0; pos < sz;)
+            {
+                const struct inotify_event* event = (const struct inotify_event*) (buffer + pos);
+                pos += sizeof(struct inotify_event) + event->len;
+
+                // A watched directory moved, or events were lost :
+                // nothing can be trusted.
+                if(event->mask & (IN_Q_OVERFLOW | IN_IGNORED | IN_DELETE_SELF | IN_MOVE_SELF))
+                {
+                    lost = true;
+                    continue;
+                }
+
+                if(!event->len || !m_watches.contains(event->wd))
+                    continue;
+
+                const Array<String>& directories = m_watches.get(event->wd);
+                for(size_t i = 0; i < directories.size(); ++i)
+                    m_stats.remove(JoinPath(directories[i], event->name));
+                changed = true;
+            }
+        }
+
+        if(lost)
+            clear();
+        else if(changed)
+            m_absolutes.clear();
+
+#endif
+    }
+
+    void FileStatCache::clear()
+    {
+        m_stats.clear();
+        m_absolutes.clear();
+        m_watched.clear();
+        m_watches.clear();
+
+#if APRO_PLATFORM == APRO_LINUX
+        // Closing the descriptor removes every watch.
+        if(m_inotify >= 0)
+        {
+            close(m_inotify);
+            m_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        }
+#endif
+    }
+
+    String FileStatCache::Normalize(const String& path)
+    {
+        const char separator = FileSystem::GetSeparator();
+
+        String ret;
+        size_t i = 0;
+        while(i < path.size())
+        {
+            char c = path[i];
+            bool at_component = ret.isEmpty() || ret[ret.size() - 1] == separator;
+
+            if(c == separator || c == '/')
+            {
+                // '//' is '/'.
+                if(ret.isEmpty() || ret[ret.size() - 1] != separator)
+                    ret.append(separator);
+                i++;
+            }
+            else if(c == '.' && at_component && (i + 1 == path.size() || path[i + 1] == separator || path[i + 1] == '/'))
+            {
+                // './' is nothing.
+                i += 2;
+            }
+            else
+            {
+                ret.append(c);
+                i++;
+            }
+        }
+
+        if(ret.size() > 1 && ret[ret.size() - 1] == separator)
+            ret = ret.extract(0, ret.size() - 1);
+
+        if(ret.isEmpty())
+            ret = ".";
+        return ret;
+    }
+}
@@ -14,24 +14,29 @@
 #include "FileStream.h"
 #include "Console.h"
 #include "UTF8String.h"
+#include "NumberFormat.h"
+#include "StringSearch.h"
+
+#include <cstring>
 
 namespace APro
 {
     FileStream::FileStream()
-        : m_file(nullptr)
+        : m_file(nullptr), m_read_data(nullptr), m_read_pos(0), m_read_end(0), m_write_size(0), m_buffer_size(DefaultBufferSize)
     {
 
     }
 
     FileStream::FileStream(FileStream& f_stream)
-        : m_file(nullptr)
+        : m_file(nullptr), m_read_data(nullptr), m_read_pos(0), m_read_end(0), m_write_size(0), m_buffer_size(f_stream.m_buffer_size)
     {
+        f_stream.flush();
         if(!f_stream.m_file.isNull() && f_stream.m_file->isOpened())
             m_file = f_stream.m_file;
     }
 
     FileStream::FileStream(File& f)
-        : m_file(nullptr)
+        : m_file(nullptr), m_read_data(nullptr), m_read_pos(0), m_read_end(0), m_write_size(0), m_buffer_size(DefaultBufferSize)
     {
         if(f.isOpened())
             m_file = std::move(FilePtr(&f, nullptr, true, nullptr));
@@ -39,13 +44,17 @@ namespace APro
 
     FileStream::~FileStream()
     {
-        // We do nothing as file object musn't be closed.
+        // File object musn't be closed, but it must see what we wrote.
+        flush();
     }
 
     bool FileStream::set(File& f)
     {
         if(f.isOpened())
         {
+            flush();
+            m_mapping.unmap();
+            m_read_pos = m_read_end = 0;
             m_file = std::move(FilePtr(&f, nullptr, true, nullptr));
             return true;
         }
@@ -57,6 +66,10 @@ namespace APro
     {
         if(!other.m_file.isNull() && other.m_file->isOpened())
         {
+            flush();
+            other.flush();
+            m_mapping.unmap();
+            m_read_pos = m_read_end = 0;
             m_file = other.m_file;
             return true;
         }
@@ -74,16 +87,163 @@ namespace APro
         return m_file;
     }
 
-    bool FileStream::readChar(char& to)
+    bool FileStream::flush()
+    {
+        if(m_file.isNull() || !m_file->isOpened())
+            return false;
+
+        if(isMapped())
+        {
+            // Nothing was written, the File only needs our position.
+            m_file->seek(File::C_BEGIN, (Offset) m_read_pos);
+            return true;
+        }
+
+        dropReadBuffer();
+
+        if(m_write_size)
+        {
+            size_t sz = m_write_size;
+            m_write_size = 0;
+            return m_file->write(m_write_buffer.pointer(), sz);
+        }
+
+        return true;
+    }
+
+    bool FileStream::map(FileMapping::Advice advice)
+    {
+        if(m_file.isNull() || !m_file->isOpened())
+            return false;
+        if(isMapped())
+            return true;
+
+        size_t pos = tell();
+        if(!flush())
+            return false;
+
+        m_mapping = m_file->map(advice);
+        if(!m_mapping.isValid())
+            return false;
+
+        m_read_data = m_mapping.data();
+        m_read_end  = m_mapping.size();
+        m_read_pos  = pos < m_read_end ? pos : m_read_end;
+        return true;
+    }
+
+    void FileStream::setBufferSize(size_t sz)
+    {
+        flush();
+
+        // Buffers are allocated again on next use.
+        ByteArray().swap(m_read_buffer);
+        ByteArray().swap(m_write_buffer);
+        if(!isMapped())
+            m_read_pos = m_read_end = 0;
+        m_buffer_size = sz ? sz : 1;
+    }
+
+    bool FileStream::fillReadBuffer()
     {
         if(m_file.isNull() || !m_file->isOpened())
+            return false;
+
+        // The mapping holds the whole File.
+        if(isMapped())
+            return false;
+
+        if(m_write_size && !flush())
+            return false;
+
+        if(m_read_buffer.size() != m_buffer_size)
+            m_read_buffer.resize(m_buffer_size);
+
+        m_read_data = m_read_buffer.pointer();
+        m_read_pos  = 0;
+        m_read_end  = m_file->readSome(m_read_buffer.pointer(), m_buffer_size);
+        return m_read_end > 0;
+    }
+
+    void FileStream::dropReadBuffer()
+    {
+        if(m_read_pos < m_read_end)
+        {
+            // The File is ahead of us by the unused bytes.
+            Offset pos = m_file->tell() - (Offset) (m_read_end - m_read_pos);
+            m_file->seek(File::C_BEGIN, pos);
+        }
+
+        m_read_pos = m_read_end = 0;
+    }
+
+    bool FileStream::readSpan(String& str, const bool* accepted)
+    {
+        for(;;)
         {
+            const Byte* data = m_read_data + m_read_pos;
+            size_t available = m_read_end - m_read_pos;
+
+            size_t sz = 0;
+            while(sz < available && accepted[data[sz]])
+                sz++;
+
+            str.append((const char*) data, sz);
+            m_read_pos += sz;
+
+            if(sz < available)
+            {
+                m_read_pos++;
+                return true;
+            }
+
+            if(!fillReadBuffer())
+                return false;
+        }
+    }
+
+    bool FileStream::writeBytes(const Byte* bytes, size_t sz)
+    {
+        if(m_file.isNull() || !m_file->isOpened())
             return false;
+
+        if(isMapped())
+        {
+            // Writing goes back to the buffered mode.
+            flush();
+            m_mapping.unmap();
+            m_read_pos = m_read_end = 0;
+        }
+        else if(m_read_end)
+        {
+            dropReadBuffer();
         }
-        else
+
+        if(m_write_size + sz > m_buffer_size)
         {
-            return m_file->read((unsigned char*) &to, sizeof(char));
+            if(!flush())
+                return false;
+
+            // Big blocks are not worth copying.
+            if(sz >= m_buffer_size)
+                return m_file->write(bytes, sz);
         }
+
+        if(m_write_buffer.size() != m_buffer_size)
+            m_write_buffer.resize(m_buffer_size);
+
+        memcpy(m_write_buffer.pointer() + m_write_size, bytes, sz);
+        m_write_size += sz;
+        return true;
+    }
+
+    bool FileStream::readChar(char& to)
+    {
+        if(m_read_pos == m_read_end && !fillReadBuffer())
+            return false;
+
+        to = (char) m_read_data[m_read_pos++];
+        return true;
     }
 
     bool FileStream::readWord(String& str)
@@ -95,32 +255,67 @@ namespace APro
         if(skipBlanck(c) < 0)
             return false;
 
-        while(isalpha((int) c))
+        if(!StringSearch::AlphaTable[(unsigned char) c])
+            return true;
+
+        str.append(c);
+        readSpan(str, StringSearch::AlphaTable);
+        return true;
+    }
+
+    bool FileStream::readLine(String& str)
+    {
+        if(m_file.isNull() || !m_file->isOpened())
+            return false;
+
+        if(m_read_pos == m_read_end && !fillReadBuffer())
+            return false;
+
+        // Lines are searched with memchr, which is faster than testing
+        // every byte.
+        for(;;)
         {
-            str.append(c);
-            if(!readChar(c))
+            const Byte* data = m_read_data + m_read_pos;
+            size_t available = m_read_end - m_read_pos;
+
+            const Byte* eol = (const Byte*) memchr(data, '\n', available);
+            size_t sz = eol ? (size_t) (eol - data) : available;
+
+            str.append((const char*) data, sz);
+            m_read_pos += sz;
+
+            if(eol)
+            {
+                m_read_pos++;
+                break;
+            }
+
+            if(!fillReadBuffer())
                 break;
         }
 
+        // Windows line ending.
+        if(!str.isEmpty() && str.at(str.size() - 1) == '\r')
+            str = str.extract(0, str.size() - 1);
+
         return true;
     }
 
     bool FileStream::readUntill(String& str, ByteArray clist)
     {
-        char c;
         if(m_file.isNull() || !m_file->isOpened())
             return false;
 
-        if(!readChar(c))
+        if(m_read_pos == m_read_end && !fillReadBuffer())
             return false;
 
-        while(!clist.contains((Byte) c))
-        {
-            str.append(c);
-            if(!readChar(c))
-                break;
-        }
+        bool accepted[256];
+        for(int i = 0; i < 256; ++i)
+            accepted[i] = true;
+        for(ByteArray::const_iterator it = clist.begin(); it != clist.end(); ++it)
+            accepted[*it] = false;
 
+        readSpan(str, accepted);
         return true;
     }
 
@@ -130,21 +325,33 @@ namespace APro
         if(m_file.isNull() || !m_file->isOpened())
             return false;
 
-        ByteArray authorized_characters;
-        authorized_characters << (Byte) '+' << (Byte) '-' << (Byte) '.' << (Byte) 'e' << (Byte) 'E';
-
-        String real;
         if(skipBlanck(c) < 0)
             return false;
 
-        while(isdigit(c) || authorized_characters.contains(c))
+        // Characters are kept on the stack, a number never needs more.
+        char   buffer[NumberFormat::MaxRealSize * 2];
+        size_t sz = 0;
+
+        while(isdigit(c) || c == '+' || c == '-' || c == '.' || c == 'e' || c == 'E')
         {
-            real.append(c);
+            if(sz < sizeof(buffer))
+                buffer[sz] = c;
+            sz++;
+
             if(!readChar(c))
                 break;
         }
 
-        r = real.toReal();
+        if(sz > sizeof(buffer)) {
+            aprodebug("Real number too long in file '") << m_file->getFileName() << "'.\n";
+            return false;
+        }
+
+        Real value = 0;
+        if(!NumberFormat::Parse(buffer, sz, value))
+            return false;
+
+        r = value;
         return true;
     }
 
@@ -154,18 +361,32 @@ namespace APro
         if(m_file.isNull() || !m_file->isOpened())
             return false;
 
-        String real;
         if(skipBlanck(c) < 0)
             return false;
 
-        while(isdigit(c))
+        char   buffer[NumberFormat::MaxIntegerSize];
+        size_t sz = 0;
+
+        while(isdigit(c) || (sz == 0 && (c == '-' || c == '+')))
         {
-            real.append(c);
+            if(sz < sizeof(buffer))
+                buffer[sz] = c;
+            sz++;
+
             if(!readChar(c))
                 break;
         }
 
-        i = real.toInt();
+        if(sz > sizeof(buffer)) {
+            aprodebug("Integer too long in file '") << m_file->getFileName() << "'.\n";
+            return false;
+        }
+
+        int32_t value = 0;
+        if(!NumberFormat::Parse(buffer, sz, value))
+            return false;
+
+        i = value;
         return true;
     }
     
@@ -182,13 +403,13 @@ namespace APro
         UTF8Char::Octet octets [4] = { 0x00, 0x00, 0x00, 0x00 };
         
         // Read Octet 1
-        if(!m_file->read((Byte*)&octets[0], 1)) {
+        if(!readChar((char&) octets[0])) {
             aprodebug("Can't read UTF8 Octet1 from file '") << m_file->getFileName() << "'.\n";
             return false;
         }
         
         // Checking Octet
-        if(!UTF8Char::OctetType(octets[0]) != UTF8Char::TBegin) {
+        if(UTF8Char::OctetType(octets[0]) != UTF8Char::TBegin) {
             aprodebug("Invalid UTF8 Octet1 from file '") << m_file->getFileName() << "'.\n";
             return false;
         }
@@ -198,7 +419,7 @@ namespace APro
         // Read Octet 2
         if(numoctet > 1)
         {
-            if(!m_file->read((Byte*)&octets[1], 1)) {
+            if(!readChar((char&) octets[1])) {
                 aprodebug("Can't read UTF8 Octet2 from file '") << m_file->getFileName() << "'.\n";
                 return false;
             }
@@ -207,7 +428,7 @@ namespace APro
         // Read Octet 3
         if(numoctet > 2)
         {
-            if(!m_file->read((Byte*)&octets[2], 1)) {
+            if(!readChar((char&) octets[2])) {
                 aprodebug("Can't read UTF8 Octet3 from file '") << m_file->getFileName() << "'.\n";
                 return false;
             }
@@ -216,7 +437,7 @@ namespace APro
         // Read Octet 4
         if(numoctet > 3)
         {
-            if(!m_file->read((Byte*)&octets[3], 1)) {
+            if(!readChar((char&) octets[3])) {
                 aprodebug("Can't read UTF8 Octet4 from file '") << m_file->getFileName() << "'.\n";
                 return false;
             }
@@ -241,17 +462,40 @@ namespace APro
             return false;
         }
         
-        UTF8Char::CodePoint cp = UTF8Char::CPNull;
+        // Spaces and the null character are ASCII, so they can't be part
+        // of a multi-octet sequence : the word is read octet by octet and
+        // validated only once.
+        Array<UTF8Char::Octet> octets;
+        size_t length = 0;
+        UTF8Char::Octet o = 0;
         
-        if(!readUTF8Char(cp)) {
-            return false;
-        }
+        do {
+            if(!readChar((char&) o))
+                return false;
+        } while(o != 0x00 && UTF8Char::IsSpace(o));
         
-        while (cp != UTF8Char::CPNull &&
-               !UTF8Char::IsSpace(cp))
+        while(o != 0x00 && !UTF8Char::IsSpace(o))
         {
-            str.append(cp);
-            readUTF8Char(cp);
+            if((o & 0xC0) != 0x80)
+            {
+                // Keeps the first octet of the next CodePoint in the file.
+                if(maxsz && length == maxsz) {
+                    m_read_pos--;
+                    break;
+                }
+                
+                length++;
+            }
+            
+            octets.append(o);
+            
+            if(!readChar((char&) o))
+                break;
+        }
+        
+        if(!str.appendUtf8(octets.pointer(), octets.size())) {
+            aprodebug("Invalid UTF8 Word from file '") << m_file->getFileName() << "'.\n";
+            return false;
         }
         
         return true;
@@ -262,24 +506,75 @@ namespace APro
         if(m_file.isNull() || !m_file->isOpened())
             return -1;
 
-        int ret = 0;
-        if(!readChar(c))
+        if(m_read_pos == m_read_end && !fillReadBuffer())
             return -1;
-        while(isblank(c))
+
+        int ret = 0;
+        for(;;)
         {
-            if(!readChar(c))
-                return ret;
-            ret++;
+            const Byte* data = m_read_data;
+            while(m_read_pos < m_read_end && isblank(data[m_read_pos]))
+            {
+                m_read_pos++;
+                ret++;
+            }
+
+            if(m_read_pos < m_read_end)
+                break;
+
+            // Only blanck characters until the end : the last one is
+            // returned.
+            char last = (char) data[m_read_end - 1];
+            if(!fillReadBuffer())
+            {
+                c = last;
+                return ret - 1;
+            }
         }
+
+        c = (char) m_read_data[m_read_pos++];
         return ret;
     }
 
+    size_t FileStream::readBytes(Byte* bytes, size_t sz)
+    {
+        size_t done = 0;
+        while(done < sz)
+        {
+            if(m_read_pos == m_read_end)
+            {
+                // Big blocks are not worth copying.
+                if(!isMapped() && sz - done >= m_buffer_size && !m_file.isNull() && m_file->isOpened())
+                {
+                    if(m_write_size && !flush())
+                        break;
+
+                    done += m_file->readSome(bytes + done, sz - done);
+                    break;
+                }
+
+                if(!fillReadBuffer())
+                    break;
+            }
+
+            size_t part = m_read_end - m_read_pos;
+            if(part > sz - done)
+                part = sz - done;
+
+            memcpy(bytes + done, m_read_data + m_read_pos, part);
+            m_read_pos += part;
+            done       += part;
+        }
+
+        return done;
+    }
+
     bool FileStream::write(const String& str)
     {
         if(m_file.isNull() || !m_file->isOpened())
             return false;
 
-        return m_file->write((const Byte*) str.toCstChar(), str.size());
+        return writeBytes((const Byte*) str.toCstChar(), str.size());
     }
 
     bool FileStream::write(const Real& str)
@@ -287,7 +582,9 @@ namespace APro
         if(m_file.isNull() || !m_file->isOpened())
             return false;
 
-        return write(String::toString(str));
+        char buffer[NumberFormat::MaxRealSize];
+        size_t sz = NumberFormat::Format(buffer, str);
+        return writeBytes((const Byte*) buffer, sz);
     }
 
     bool FileStream::write(const int& str)
@@ -295,7 +592,9 @@ namespace APro
         if(m_file.isNull() || !m_file->isOpened())
             return false;
 
-        return write(String::toString(str));
+        char buffer[NumberFormat::MaxIntegerSize];
+        size_t sz = NumberFormat::Format(buffer, (int32_t) str);
+        return writeBytes((const Byte*) buffer, sz);
     }
     
     bool FileStream::write(const UTF8Char::CodePoint& cp)
@@ -310,7 +609,7 @@ namespace APro
             return false;
         
         // Write the current used char.
-        return m_file->write ((const Byte*) cptoc, vcu);
+        return writeBytes((const Byte*) cptoc, (size_t) vcu);
     }
     
     bool FileStream::write(const UTF8String& str)
@@ -318,32 +617,47 @@ namespace APro
         if(m_file.isNull() || !m_file->isOpened())
             return false;
         
-        for(UTF8String::const_iterator it = str.begin(); it != str.end(); it++) {
-            if(!write(*it))
-                return false;
-        }
+        if(str.isEmpty())
+            return true;
         
-        return true;
+        // The String is already stored as UTF-8.
+        return writeBytes((const Byte*) str.data(), str.byteSize());
     }
 
     bool FileStream::isEOS() const
     {
         if(m_file.isNull())
             return false;
-        return m_file->isEOF();
+        if(isMapped())
+            return m_read_pos == m_read_end;
+        return m_read_pos == m_read_end && m_file->isEOF();
     }
 
     size_t FileStream::tell() const
     {
         if(m_file.isNull())
             return 0;
-        return m_file->tell();
+        if(isMapped())
+            return m_read_pos;
+
+        // The File is ahead of us when reading, and behind when
+        // writing.
+        return (size_t) m_file->tell() - (m_read_end - m_read_pos) + m_write_size;
     }
 
     void FileStream::seek(size_t pos, CursorPosition cp)
     {
         if(m_file.isNull())
             return;
+
+        if(isMapped())
+        {
+            size_t base = cp == CP_CUR ? m_read_pos : (cp == CP_END ? m_read_end : 0);
+            m_read_pos  = base + pos < m_read_end ? base + pos : m_read_end;
+            return;
+        }
+
+        flush();
         m_file->seek( (File::CursorPosition) (File::C_BEGIN + (int) cp), (Offset) pos);
     }
 
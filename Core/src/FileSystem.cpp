@@ -32,17 +32,46 @@
 #include "FileSystem.h"
 #include "Directory.h"
 #include "Path.h"
+#include "Console.h"
+#include "FileStatCache.h"
 
 #if APRO_PLATFORM == APRO_WINDOWS
 
 #else
 #   include <fcntl.h>
+#   include <unistd.h>
+#   include <sys/stat.h>
 #endif // APRO_PLATFORM
 
+#if APRO_PLATFORM == APRO_LINUX
+#   include <sys/ioctl.h>
+#   include <sys/sendfile.h>
+#   include <sys/syscall.h>
+#   include <linux/fs.h>
+#endif
+
+#ifdef _COMPILE_WITH_PTHREAD_
+#   include "Thread.h"
+#   include "ThreadMutexI.h"
+#endif
+
+#include <cerrno>
+#include <cstring>
+
 namespace APro
 {
+    /// Forgets the cached stat of a path the program changed.
+    static void Uncache(const String& path)
+    {
+        if(FileStatCache::Get().isEnabled())
+            FileStatCache::Get().invalidate(path);
+    }
+
     bool FileSystem::Exists(const String& path)
     {
+        if(FileStatCache::Get().isEnabled())
+            return FileStatCache::Get().stat(path).exists;
+
 #if APRO_PLATFORM == APRO_WINDOWS
 
         return PathFileExists((LPCTSTR) path.toCstChar()) == TRUE;
@@ -56,6 +85,9 @@ namespace APro
 
     bool FileSystem::IsDirectory(const String& path)
     {
+        if(FileStatCache::Get().isEnabled())
+            return FileStatCache::Get().stat(path).directory;
+
 #if APRO_PLATFORM == APRO_WINDOWS
 
         return PathIsDirectory((LPCTSTR) path.toCstChar()) == TRUE;
@@ -76,13 +108,18 @@ namespace APro
 
     bool FileSystem::IsFile(const String& path)
     {
-        return !FileSystem::IsDirectory(path);
+        if(FileStatCache::Get().isEnabled())
+        {
+            FileStat st = FileStatCache::Get().stat(path);
+            return st.exists && !st.directory;
+        }
+
+        return FileSystem::Exists(path) && !FileSystem::IsDirectory(path);
     }
 
-    bool FileSystem::HasExtension(const String& path)
+    bool FileSystem::HasExtension(const StringView& path)
     {
-        String filename = FileSystem::ExtractFilename(path);
-        return filename.findFirst('.') == path.size();
+        return FileSystem::ExtractFilenameView(path).match('.');
     }
 
     char FileSystem::GetSeparator()
@@ -93,14 +130,29 @@ namespace APro
             return '/';
     }
 
-    String FileSystem::ExtractFilename(const String& path)
+    String FileSystem::ExtractFilename(const StringView& path)
     {
-        return path.extract(path.findLast(FileSystem::GetSeparator()), path.size());
+        return String(FileSystem::ExtractFilenameView(path));
     }
 
-    String FileSystem::ExtractExtension(const String& path)
+    String FileSystem::ExtractExtension(const StringView& path)
     {
-        return path.extract(path.findLast('.'), path.size());
+        return String(FileSystem::ExtractExtensionView(path));
+    }
+
+    StringView FileSystem::ExtractFilenameView(const StringView& path)
+    {
+        size_t separator = path.findLast(FileSystem::GetSeparator());
+        if(separator == path.size())
+            return path;
+
+        return path.extract(separator + 1, path.size());
+    }
+
+    StringView FileSystem::ExtractExtensionView(const StringView& path)
+    {
+        StringView filename = FileSystem::ExtractFilenameView(path);
+        return filename.extract(filename.findLast('.'), filename.size());
     }
 
     bool FileSystem::CreateFile(const String& path, bool overwrite)
@@ -117,6 +169,7 @@ namespace APro
         if(fp)
         {
             fclose(fp);
+            Uncache(path);
             return true;
         }
 
@@ -130,16 +183,16 @@ namespace APro
 
 #if APRO_PLATFORM == APRO_WINDOWS
 
-        return CreateDirectory((LPCTSTR) path.toCstChar()) == TRUE;
+        bool ret = CreateDirectory((LPCTSTR) path.toCstChar()) == TRUE;
 
 #else
 
-        if(mkdir(path.toCstChar(), S_IRWXG | S_IRWXO | S_IRWXU) == 0)
-            return true;
-
-        return false;
+        bool ret = mkdir(path.toCstChar(), S_IRWXG | S_IRWXO | S_IRWXU) == 0;
 
 #endif
+
+        Uncache(path);
+        return ret;
     }
 
     bool FileSystem::RemoveFile(const String& path)
@@ -149,13 +202,16 @@ namespace APro
 
 #if APRO_PLATFORM == APRO_WINDOWS
 
-        return DeleteFile((LPCTSTR) path.toCstChar()) == TRUE;
+        bool ret = DeleteFile((LPCTSTR) path.toCstChar()) == TRUE;
 
 #else
 
-        return remove(path.toCstChar()) == 0;
+        bool ret = remove(path.toCstChar()) == 0;
 
 #endif
+
+        Uncache(path);
+        return ret;
     }
 
     bool FileSystem::RemoveDirectory(const String& path, bool recursive)
@@ -184,56 +240,267 @@ namespace APro
 
 #if APRO_PLATFORM == APRO_WINDOWS
 
-            return RemoveDirectory((LPCTSTR) path.toCstChar()) == TRUE;
+            bool ret = RemoveDirectory((LPCTSTR) path.toCstChar()) == TRUE;
 
 #else
 
-            return rmdir(path.toCstChar());
+            bool ret = rmdir(path.toCstChar()) == 0;
 
 #endif
 
-
+            Uncache(path);
+            return ret;
         }
 
         return false;
     }
 
+#if APRO_PLATFORM != APRO_WINDOWS
+
+    /// Returns true if errno tells a kernel copy is not possible
+    /// between those files, so another way must be tried.
+    static bool IsCopyUnsupported(int err)
+    {
+        return err == ENOSYS || err == EXDEV || err == EINVAL || err == EOPNOTSUPP || err == ENOTSUP;
+    }
+
+    /// Copies the contents of file source, of given size, to file
+    /// dest. Both cursors are at the beginning.
+    static bool CopyContents(int source, int dest, Offset size)
+    {
+        Offset copied = 0;
+
+#if APRO_PLATFORM == APRO_LINUX
+
+#   ifdef FICLONE
+        // Both files share their blocks until one is modified.
+        if(ioctl(dest, FICLONE, source) == 0)
+            return true;
+#   endif
+
+#   ifdef SYS_copy_file_range
+        while(copied < size)
+        {
+            ssize_t n = syscall(SYS_copy_file_range, source, nullptr, dest, nullptr, (size_t) (size - copied), 0);
+            if(n < 0 && errno == EINTR)
+                continue;
+            if(n < 0 && copied == 0 && IsCopyUnsupported(errno))
+                break;
+            if(n < 0)
+                return false;
+            if(n == 0)
+                break;
+
+            copied += (Offset) n;
+        }
+#   endif
+
+        // sendfile() sends at most 2GB by call.
+        while(copied < size)
+        {
+            size_t chunk = size - copied < 0x40000000 ? (size_t) (size - copied) : 0x40000000;
+            ssize_t n = sendfile(dest, source, nullptr, chunk);
+            if(n < 0 && errno == EINTR)
+                continue;
+            if(n < 0 && IsCopyUnsupported(errno))
+                break;
+            if(n < 0)
+                return false;
+            if(n == 0)
+                break;
+
+            copied += (Offset) n;
+        }
+
+#endif // APRO_PLATFORM
+
+        // Remaining bytes, or files whose size is not known in
+        // advance, go through a large buffer.
+        const size_t buffer_size = 1024 * 1024;
+        Byte* buffer = (Byte*) AProAllocate(buffer_size);
+        bool ret = true;
+
+        for(;;)
+        {
+            ssize_t n = read(source, buffer, buffer_size);
+            if(n < 0 && errno == EINTR)
+                continue;
+            if(n <= 0)
+            {
+                ret = n == 0;
+                break;
+            }
+
+            ssize_t written = 0;
+            while(written < n)
+            {
+                ssize_t w = write(dest, buffer + written, (size_t) (n - written));
+                if(w < 0 && errno == EINTR)
+                    continue;
+                if(w <= 0)
+                    break;
+                written += w;
+            }
+
+            if(written < n)
+            {
+                ret = false;
+                break;
+            }
+        }
+
+        AProDeallocate(buffer);
+        return ret;
+    }
+
+#endif // APRO_PLATFORM
+
     bool FileSystem::CopyFile(const String& from, const String& to, bool failIfExists)
     {
 #if APRO_PLATFORM == APRO_WINDOWS
 
-        return CopyFile((LPCTSTR) from.toCstChar(), (LPCTSTR) to.toCstChar(), (BOOL) failIfExists) == TRUE;
+        bool ret = CopyFile((LPCTSTR) from.toCstChar(), (LPCTSTR) to.toCstChar(), (BOOL) failIfExists) == TRUE;
+        Uncache(to);
+        return ret;
 
 #else
 
         if(failIfExists && FileSystem::Exists(to))
             return false;
 
-        char buf[BUFSIZ];
-        size_t size;
-
-        int source = open(from.toCstChar(), O_RDONLY, 0);
-        int dest   = open(to.toCstChar(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        int source = open(from.toCstChar(), O_RDONLY | O_CLOEXEC);
+        if(source == -1)
+        {
+            aprodebug("Can't open file '") << from << "' : " << strerror(errno) << ".";
+            return false;
+        }
 
-        if(source == -1 || dest == -1)
+        struct stat st;
+        if(fstat(source, &st) != 0)
         {
             close(source);
-            close(dest);
             return false;
         }
 
-        while((size = read(source, buf, BUFSIZ)) > 0)
+        int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC | (failIfExists ? O_EXCL : 0);
+        int dest  = open(to.toCstChar(), flags, st.st_mode & 0777);
+        if(dest == -1)
         {
-            write(dest, buf, BUFSIZ);
+            aprodebug("Can't create file '") << to << "' : " << strerror(errno) << ".";
+            close(source);
+            return false;
         }
 
+        bool ret = CopyContents(source, dest, (Offset) st.st_size);
+        if(!ret)
+            aprodebug("Can't copy file '") << from << "' to '" << to << "' : " << strerror(errno) << ".";
+
         close(source);
-        close(dest);
-        return true;
+        if(close(dest) != 0)
+            ret = false;
+
+        // No half-copied file is left.
+        if(!ret)
+            unlink(to.toCstChar());
+
+        Uncache(to);
+        return ret;
 
 #endif // APRO_PLATFORM
     }
 
+#ifdef _COMPILE_WITH_PTHREAD_
+
+    /// Copies files of a CopyFiles() call, taking the next file to
+    /// copy from a shared index.
+    class CopyFilesThread : public Thread
+    {
+    public:
+
+        CopyFilesThread(const Array<String>* from, const Array<String>* to, bool failIfExists,
+                        ThreadMutexI* mutex, size_t* next)
+            : Thread(String("CopyFiles Worker")), copied(0), m_from(from), m_to(to),
+              m_fail_if_exists(failIfExists), m_mutex(mutex), m_next(next)
+        {
+
+        }
+
+        void exec()
+        {
+            for(;;)
+            {
+                m_mutex->lock();
+                size_t i = (*m_next)++;
+                m_mutex->unlock();
+
+                if(i >= m_from->size())
+                    break;
+
+                if(FileSystem::CopyFile(m_from->at(i), m_to->at(i), m_fail_if_exists))
+                    copied++;
+            }
+        }
+
+        size_t copied;///< Number of files copied by this thread.
+
+    private:
+
+        const Array<String>* m_from;
+        const Array<String>* m_to;
+        bool                 m_fail_if_exists;
+        ThreadMutexI*        m_mutex;
+        size_t*              m_next;
+    };
+
+#endif // _COMPILE_WITH_PTHREAD_
+
+    size_t FileSystem::CopyFiles(const Array<String>& from, const Array<String>& to, bool failIfExists, size_t threads)
+    {
+        if(from.size() != to.size())
+        {
+            aprodebug("CopyFiles() needs as many destinations as sources.");
+            return 0;
+        }
+
+        size_t copied = 0;
+
+#ifdef _COMPILE_WITH_PTHREAD_
+        if(threads > from.size())
+            threads = from.size();
+
+        if(threads > 1)
+        {
+            ThreadMutexI mutex;
+            size_t next = 0;
+
+            Array<CopyFilesThread*> workers;
+            workers.reserve(threads);
+            for(size_t i = 0; i < threads; ++i)
+            {
+                workers.append(AProNew(CopyFilesThread, &from, &to, failIfExists, &mutex, &next));
+                workers[i]->start();
+            }
+
+            for(size_t i = 0; i < workers.size(); ++i)
+            {
+                workers[i]->join();
+                copied += workers[i]->copied;
+                AProDelete(workers[i]);
+            }
+
+            return copied;
+        }
+#endif // _COMPILE_WITH_PTHREAD_
+
+        for(size_t i = 0; i < from.size(); ++i)
+        {
+            if(FileSystem::CopyFile(from[i], to[i], failIfExists))
+                copied++;
+        }
+
+        return copied;
+    }
+
     String FileSystem::GetCurrentWorkingDirectory()
     {
 #if APRO_PLATFORM == APRO_WINDOWS
@@ -253,6 +520,10 @@ namespace APro
 
     bool FileSystem::SetCurrentWorkingDirectory(const String& path)
     {
+        // Cached relative paths now name other files.
+        if(FileStatCache::Get().isEnabled())
+            FileStatCache::Get().invalidateAll();
+
 #if APRO_PLATFORM == APRO_WINDOWS
 
         return SetCurrentDirectory((LPCTSTR) path.toCstChar()) == TRUE;
@@ -295,6 +566,9 @@ namespace APro
 
     String FileSystem::GetAbsolutePath(const String& relative)
     {
+        if(FileStatCache::Get().isEnabled())
+            return FileStatCache::Get().getAbsolutePath(relative);
+
 #if APRO_PLATFORM == APRO_WINDOWS
 
         TCHAR  buffer[BUFSIZ] = TEXT("");
@@ -0,0 +1,305 @@
+/////////////////////////////////////////////////////////////
+/** @file LZCodec.cpp
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the LZCodec functions.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "LZCodec.h"
+
+#include <cstring>
+
+namespace APro
+{
+    namespace LZCodec
+    {
+        static const size_t MinMatch     = 4; ///< Shortest copy.
+        static const size_t LastLiterals = 5; ///< The last bytes of a block are literals.
+        static const size_t MatchLimit   = 12;///< The last copy starts before it.
+        static const int    HashLog      = 14;///< Size of the hash table, as a power of 2.
+        static const int    SkipTrigger  = 6; ///< Misses before the search speeds up, as a power of 2.
+
+        static inline uint32_t Read32(const Byte* p)
+        {
+            uint32_t v;
+            memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        static inline uint64_t Read64(const Byte* p)
+        {
+            uint64_t v;
+            memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        static inline uint32_t Hash(const Byte* p)
+        {
+            return (Read32(p) * 2654435761U) >> (32 - HashLog);
+        }
+
+        /// Writes the part of a length which does not fit in the
+        /// token.
+        static inline Byte* WriteLength(Byte* op, size_t length)
+        {
+            while(length >= 255)
+            {
+                *op++ = 255;
+                length -= 255;
+            }
+            *op++ = (Byte) length;
+            return op;
+        }
+
+        /// Reads the part of a length which does not fit in the
+        /// token. Returns false if the block ends first.
+        static inline bool ReadLength(const Byte*& ip, const Byte* iend, size_t& length)
+        {
+            Byte b;
+            do
+            {
+                if(ip >= iend)
+                    return false;
+                b = *ip++;
+                length += b;
+            } while(b == 255);
+            return true;
+        }
+
+        /// Writes a sequence : literals from anchor, then a copy of
+        /// mlength bytes at given offset (none if mlength is 0).
+        /// Returns null if it does not fit before oend.
+        static inline Byte* WriteSequence(Byte* op, Byte* oend, const Byte* anchor, size_t literals,
+                                          size_t offset, size_t mlength)
+        {
+            size_t needed = 1 + literals + literals / 255 + 1 + (mlength ? 2 + (mlength - MinMatch) / 255 + 1 : 0);
+            if((size_t) (oend - op) < needed)
+                return nullptr;
+
+            Byte* token = op++;
+            *token = (Byte) ((literals >= 15 ? 15 : literals) << 4);
+            if(literals >= 15)
+                op = WriteLength(op, literals - 15);
+
+            if(literals)
+                memcpy(op, anchor, literals);
+            op += literals;
+
+            if(mlength)
+            {
+                *op++ = (Byte) (offset & 0xFF);
+                *op++ = (Byte) (offset >> 8);
+
+                size_t ml = mlength - MinMatch;
+                *token |= (Byte) (ml >= 15 ? 15 : ml);
+                if(ml >= 15)
+                    op = WriteLength(op, ml - 15);
+            }
+
+            return op;
+        }
+
+        size_t Compress(const Byte* src, size_t sz, Byte* dst, size_t capacity)
+        {
+            Byte*       op     = dst;
+            Byte*       oend   = dst + capacity;
+            const Byte* anchor = src;
+
+            if(sz > MatchLimit)
+            {
+                uint32_t table[1 << HashLog];
+                memset(table, 0, sizeof(table));
+
+                const Byte* ip      = src + 1;
+                const Byte* iend    = src + sz;
+                const Byte* mflimit = iend - MatchLimit;
+                const Byte* mlimit  = iend - LastLiterals;
+
+                for(;;)
+                {
+                    // Each miss moves further : incompressible data
+                    // is skipped quickly.
+                    const Byte* ref;
+                    unsigned    attempts = 1 << SkipTrigger;
+                    for(;;)
+                    {
+                        if(ip > mflimit)
+                            goto last_literals;
+
+                        uint32_t h = Hash(ip);
+                        ref = src + table[h];
+                        table[h] = (uint32_t) (ip - src);
+
+                        if(ref < ip && (size_t) (ip - ref) <= MaxOffset && Read32(ref) == Read32(ip))
+                            break;
+
+                        ip += attempts++ >> SkipTrigger;
+                    }
+
+                    while(ip > anchor && ref > src && ip[-1] == ref[-1])
+                    {
+                        ip--;
+                        ref--;
+                    }
+
+                    // Eight bytes are compared at once.
+                    size_t mlength = MinMatch;
+                    while(ip + mlength + sizeof(uint64_t) <= mlimit)
+                    {
+                        uint64_t diff = Read64(ip + mlength) ^ Read64(ref + mlength);
+                        if(diff)
+                            break;
+                        mlength += sizeof(uint64_t);
+                    }
+                    while(ip + mlength < mlimit && ip[mlength] == ref[mlength])
+                        mlength++;
+
+                    op = WriteSequence(op, oend, anchor, (size_t) (ip - anchor), (size_t) (ip - ref), mlength);
+                    if(!op)
+                        return 0;
+
+                    ip    += mlength;
+                    anchor = ip;
+
+                    if(ip > mflimit)
+                        break;
+
+                    table[Hash(ip - 2)] = (uint32_t) (ip - 2 - src);
+                }
+            }
+
+        last_literals:
+
+            op = WriteSequence(op, oend, anchor, (size_t) (src + sz - anchor), 0, 0);
+            return op ? (size_t) (op - dst) : 0;
+        }
+
+        bool Decompress(const Byte* src, size_t sz, Byte* dst, size_t capacity, size_t& written)
+        {
+            const Byte* ip   = src;
+            const Byte* iend = src + sz;
+            Byte*       op   = dst;
+            Byte*       oend = dst + capacity;
+
+            written = 0;
+
+            while(ip < iend)
+            {
+                Byte   token    = *ip++;
+                size_t literals = token >> 4;
+                size_t offset, mlength;
+
+                // Short sequence far from the ends : fixed size copies
+                // without any check but the offset.
+                if(literals < 15 && iend - ip >= 32 && oend - op >= 64)
+                {
+                    memcpy(op, ip, 16);
+                    op += literals;
+                    ip += literals;
+
+                    offset  = (size_t) ip[0] | ((size_t) ip[1] << 8);
+                    ip     += 2;
+                    mlength = token & 15;
+
+                    if(mlength < 15 && offset >= 8 && offset <= (size_t) (op - dst))
+                    {
+                        const Byte* match = op - offset;
+                        memcpy(op, match, 8);
+                        memcpy(op + 8, match + 8, 8);
+                        memcpy(op + 16, match + 16, 2);
+                        op += mlength + MinMatch;
+                        continue;
+                    }
+                }
+                else
+                {
+                    if(literals == 15 && !ReadLength(ip, iend, literals))
+                        return false;
+                    if((size_t) (iend - ip) < literals || (size_t) (oend - op) < literals)
+                        return false;
+
+                    if(literals)
+                        memcpy(op, ip, literals);
+                    ip += literals;
+                    op += literals;
+
+                    // The last sequence has no copy.
+                    if(ip == iend)
+                        break;
+
+                    if(iend - ip < 2)
+                        return false;
+                    offset  = (size_t) ip[0] | ((size_t) ip[1] << 8);
+                    ip     += 2;
+                    mlength = token & 15;
+                }
+
+                if(!offset || offset > (size_t) (op - dst))
+                    return false;
+                if(mlength == 15 && !ReadLength(ip, iend, mlength))
+                    return false;
+                mlength += MinMatch;
+                if((size_t) (oend - op) < mlength)
+                    return false;
+
+                const Byte* match = op - offset;
+                Byte*       mend  = op + mlength;
+
+                if(offset >= 16 && oend - mend >= 16)
+                {
+                    for(; op < mend; op += 16, match += 16)
+                        memcpy(op, match, 16);
+                }
+                else if(offset >= 8 && oend - mend >= 8)
+                {
+                    for(; op < mend; op += 8, match += 8)
+                        memcpy(op, match, 8);
+                }
+                else if(oend - mend >= 8)
+                {
+                    // The copy overlaps itself : the first 8 bytes
+                    // repeat the pattern, then whole copies of the
+                    // pattern at least 8 bytes long follow.
+                    for(int i = 0; i < 8; ++i)
+                        op[i] = match[i];
+                    op += 8;
+
+                    size_t period = offset * ((8 + offset - 1) / offset);
+                    for(match = op - period; op < mend; op += 8, match += 8)
+                        memcpy(op, match, 8);
+                }
+                else
+                {
+                    while(op < mend)
+                        *op++ = *match++;
+                }
+
+                op = mend;
+            }
+
+            written = (size_t) (op - dst);
+            return true;
+        }
+    }
+}
@@ -126,6 +126,7 @@ namespace APro
         abstract_object_factory = nullptr;
         id_generator 			= nullptr;
         rendererfactory 		= nullptr;
+        checksumfactory 		= nullptr;
     }
 
     Main& Main::init(int argc, const char** argv)
@@ -164,6 +165,7 @@ namespace APro
         FACTORY_CREATE(ImplementationFactory, impFactory)
         FACTORY_CREATE(AbstractObjectFactory, abstract_object_factory)
         FACTORY_CREATE(RenderingAPIFactory,   rendererfactory)
+        FACTORY_CREATE(CheckSumFactory,       checksumfactory)
 
         // -- Event Uniter -------------------------------------------------------------
 
@@ -220,6 +222,7 @@ namespace APro
         FACTORY_CLEAN(ImplementationFactory, impFactory)
         FACTORY_CLEAN(AbstractObjectFactory, abstract_object_factory)
         FACTORY_CLEAN(RenderingAPIFactory,   rendererfactory)
+        FACTORY_CLEAN(CheckSumFactory,       checksumfactory)
 
         SINGLETON_CLEAN(PointerCollector, 	 sharedpointer_collector)
         SINGLETON_CLEAN(IdGenerator, 		 id_generator)
@@ -0,0 +1,314 @@
+/////////////////////////////////////////////////////////////
+/** @file MemoryStream.cpp
+ *  @ingroup Utils
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the MemoryStream class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "MemoryStream.h"
+#include "Console.h"
+#include "NumberFormat.h"
+#include "StringSearch.h"
+
+#include <cctype>
+#include <cstring>
+
+namespace APro
+{
+    MemoryStream::MemoryStream(size_t capacity)
+        : m_data(nullptr), m_size(0), m_capacity(0), m_pos(0), m_owned(true), m_readonly(false)
+    {
+        if(capacity)
+            reserve(capacity);
+    }
+
+    MemoryStream::MemoryStream(const Byte* data, size_t sz)
+        : m_data(const_cast<Byte*>(data)), m_size(sz), m_capacity(sz), m_pos(0), m_owned(false), m_readonly(true)
+    {
+
+    }
+
+    MemoryStream::MemoryStream(const StringView& text)
+        : m_data((Byte*) text.data()), m_size(text.size()), m_capacity(text.size()), m_pos(0), m_owned(false), m_readonly(true)
+    {
+
+    }
+
+    MemoryStream::MemoryStream(Byte* data, size_t capacity, size_t sz)
+        : m_data(data), m_size(sz < capacity ? sz : capacity), m_capacity(capacity), m_pos(0), m_owned(false), m_readonly(false)
+    {
+
+    }
+
+    MemoryStream::~MemoryStream()
+    {
+        if(m_owned && m_data)
+            AProDeallocate(m_data);
+    }
+
+    bool MemoryStream::reserve(size_t sz)
+    {
+        if(sz <= m_capacity)
+            return true;
+        if(!m_owned)
+            return false;
+
+        Byte* data = (Byte*) AProAllocate(sz);
+        if(m_size)
+            memcpy(data, m_data, m_size);
+        if(m_data)
+            AProDeallocate(m_data);
+
+        m_data     = data;
+        m_capacity = sz;
+        return true;
+    }
+
+    void MemoryStream::clear()
+    {
+        if(m_readonly)
+            return;
+
+        m_size = 0;
+        m_pos  = 0;
+    }
+
+    void MemoryStream::readSpan(String& str, const bool* accepted)
+    {
+        const Byte* data = m_data + m_pos;
+        size_t available = m_size - m_pos;
+
+        size_t sz = 0;
+        while(sz < available && accepted[data[sz]])
+            sz++;
+
+        str.append((const char*) data, sz);
+        m_pos += sz < available ? sz + 1 : sz;
+    }
+
+    bool MemoryStream::readChar(char& to)
+    {
+        if(m_pos >= m_size)
+            return false;
+
+        to = (char) m_data[m_pos++];
+        return true;
+    }
+
+    int MemoryStream::skipBlanck(char& c)
+    {
+        if(m_pos >= m_size)
+            return -1;
+
+        int ret = 0;
+        while(m_pos < m_size && isblank(m_data[m_pos]))
+        {
+            m_pos++;
+            ret++;
+        }
+
+        // Only blanck characters until the end : the last one is
+        // returned.
+        if(m_pos == m_size)
+        {
+            c = (char) m_data[m_size - 1];
+            return ret - 1;
+        }
+
+        c = (char) m_data[m_pos++];
+        return ret;
+    }
+
+    bool MemoryStream::readWord(String& str)
+    {
+        char c;
+        if(skipBlanck(c) < 0)
+            return false;
+
+        if(!StringSearch::AlphaTable[(unsigned char) c])
+            return true;
+
+        str.append(c);
+        readSpan(str, StringSearch::AlphaTable);
+        return true;
+    }
+
+    bool MemoryStream::readLine(String& str)
+    {
+        if(m_pos >= m_size)
+            return false;
+
+        const Byte* data = m_data + m_pos;
+        size_t available = m_size - m_pos;
+
+        const Byte* eol = (const Byte*) memchr(data, '\n', available);
+        size_t sz = eol ? (size_t) (eol - data) : available;
+        m_pos += eol ? sz + 1 : sz;
+
+        // Windows line ending.
+        if(sz && data[sz - 1] == '\r')
+            sz--;
+
+        str.append((const char*) data, sz);
+        return true;
+    }
+
+    bool MemoryStream::readUntill(String& str, ByteArray clist)
+    {
+        if(m_pos >= m_size)
+            return false;
+
+        bool accepted[256];
+        for(int i = 0; i < 256; ++i)
+            accepted[i] = true;
+        for(ByteArray::const_iterator it = clist.begin(); it != clist.end(); ++it)
+            accepted[*it] = false;
+
+        readSpan(str, accepted);
+        return true;
+    }
+
+    bool MemoryStream::readReal(Real& r)
+    {
+        char c;
+        if(skipBlanck(c) < 0)
+            return false;
+
+        // The number is parsed in place, and the character following
+        // it is skipped as FileStream does.
+        const char* begin = (const char*) m_data + m_pos - 1;
+        size_t sz = 0;
+        while(isdigit(c) || c == '+' || c == '-' || c == '.' || c == 'e' || c == 'E')
+        {
+            sz++;
+            if(!readChar(c))
+                break;
+        }
+
+        Real value = 0;
+        if(!NumberFormat::Parse(begin, sz, value))
+            return false;
+
+        r = value;
+        return true;
+    }
+
+    bool MemoryStream::readInt(int& i)
+    {
+        char c;
+        if(skipBlanck(c) < 0)
+            return false;
+
+        const char* begin = (const char*) m_data + m_pos - 1;
+        size_t sz = 0;
+        while(isdigit(c) || (sz == 0 && (c == '-' || c == '+')))
+        {
+            sz++;
+            if(!readChar(c))
+                break;
+        }
+
+        if(sz > NumberFormat::MaxIntegerSize)
+        {
+            aprodebug("Integer too long in memory stream.");
+            return false;
+        }
+
+        int32_t value = 0;
+        if(!NumberFormat::Parse(begin, sz, value))
+            return false;
+
+        i = value;
+        return true;
+    }
+
+    size_t MemoryStream::readBytes(Byte* bytes, size_t sz)
+    {
+        size_t available = m_pos < m_size ? m_size - m_pos : 0;
+        if(sz > available)
+            sz = available;
+        if(!sz)
+            return 0;
+
+        memcpy(bytes, m_data + m_pos, sz);
+        m_pos += sz;
+        return sz;
+    }
+
+    Byte* MemoryStream::writeInPlace(size_t sz)
+    {
+        if(m_readonly)
+            return nullptr;
+
+        size_t end = m_pos + sz;
+        if(end > m_capacity && !reserve(end > m_capacity * 2 ? end : m_capacity * 2))
+            return nullptr;
+
+        Byte* bytes = m_data + m_pos;
+        m_pos = end;
+        if(end > m_size)
+            m_size = end;
+        return bytes;
+    }
+
+    bool MemoryStream::writeBytes(const Byte* bytes, size_t sz)
+    {
+        if(m_readonly)
+            return false;
+        if(!sz)
+            return true;
+
+        Byte* to = writeInPlace(sz);
+        if(!to)
+            return false;
+
+        memcpy(to, bytes, sz);
+        return true;
+    }
+
+    bool MemoryStream::write(const String& str)
+    {
+        return writeBytes((const Byte*) str.toCstChar(), str.size());
+    }
+
+    bool MemoryStream::write(const Real& str)
+    {
+        char buffer[NumberFormat::MaxRealSize];
+        size_t sz = NumberFormat::Format(buffer, str);
+        return writeBytes((const Byte*) buffer, sz);
+    }
+
+    bool MemoryStream::write(const int& str)
+    {
+        char buffer[NumberFormat::MaxIntegerSize];
+        size_t sz = NumberFormat::Format(buffer, (int32_t) str);
+        return writeBytes((const Byte*) buffer, sz);
+    }
+
+    void MemoryStream::seek(size_t pos, CursorPosition cp)
+    {
+        size_t base = cp == CP_CUR ? m_pos : (cp == CP_END ? m_size : 0);
+        m_pos = base + pos < m_size ? base + pos : m_size;
+    }
+}
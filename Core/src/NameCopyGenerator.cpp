@@ -23,11 +23,10 @@ namespace APro
         //                          ...
         //                          MyResource (2147483647)
 
-        int _cpy = 0;
         if(!isNameUsed(name))
             return name;
 
-        _cpy++;
+        int _cpy = getFirstCopy(name);
         String _cpyname;
         do
         {
@@ -35,9 +34,11 @@ namespace APro
             _cpyname.append(" (");
             _cpyname.append(String::FromInt(_cpy));
             _cpyname.append(")");
+            _cpy++;
 
-        } while (isNameUsed(name));
+        } while (isNameUsed(_cpyname));
 
+        onCopyGenerated(name, _cpy - 1);
         return _cpyname;
     }
 }
@@ -0,0 +1,813 @@
+/////////////////////////////////////////////////////////////
+/** @file NumberFormat.cpp
+ *  @ingroup Global
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the numbers formatting and parsing functions.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "NumberFormat.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <limits>
+
+namespace APro
+{
+    namespace
+    {
+        // Two characters per number from 00 to 99, so integers are
+        // written two digits at a time.
+        const char Digits[] =
+            "0001020304050607080910111213141516171819"
+            "2021222324252627282930313233343536373839"
+            "4041424344454647484950515253545556575859"
+            "6061626364656667686970717273747576777879"
+            "8081828384858687888990919293949596979899";
+
+        // Powers of ten exactly representable as double (resp. float).
+        const double DoublePow10[] =
+        {
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+
+        const float FloatPow10[] =
+        {
+            1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+        };
+
+        template<typename Unsigned>
+        size_t FormatDigits(char* buffer, Unsigned value)
+        {
+            char  temp[NumberFormat::MaxIntegerSize];
+            char* end = temp + NumberFormat::MaxIntegerSize;
+            char* cur = end;
+
+            while(value >= 100)
+            {
+                unsigned int index = (unsigned int) (value % 100) * 2;
+                value /= 100;
+                cur -= 2;
+                cur[0] = Digits[index];
+                cur[1] = Digits[index + 1];
+            }
+
+            if(value >= 10)
+            {
+                unsigned int index = (unsigned int) value * 2;
+                cur -= 2;
+                cur[0] = Digits[index];
+                cur[1] = Digits[index + 1];
+            }
+            else
+            {
+                *--cur = (char) ('0' + value);
+            }
+
+            size_t sz = (size_t) (end - cur);
+            memcpy(buffer, cur, sz);
+            return sz;
+        }
+
+        inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+        /** Returns the number of white space characters at the
+         *  beginning of data, as skipped by strtol(). */
+        inline size_t SkipSpaces(const char* data, size_t sz)
+        {
+            size_t i = 0;
+            while(i < sz && (data[i] == ' ' || (data[i] >= '\t' && data[i] <= '\r')))
+                ++i;
+            return i;
+        }
+
+        /** Reads the digits beginning at index i, failing on overflow
+         *  of limit. Returns the index after the last digit, or 0. */
+        size_t ParseDigits(const char* data, size_t sz, size_t i, uint64_t limit, uint64_t& result)
+        {
+            size_t begin = i;
+            uint64_t value = 0;
+
+            for(; i < sz && IsDigit(data[i]); ++i)
+            {
+                uint64_t digit = (uint64_t) (data[i] - '0');
+                if(value > (limit - digit) / 10)
+                    return 0;
+                value = value * 10 + digit;
+            }
+
+            if(i == begin)
+                return 0;
+
+            result = value;
+            return i;
+        }
+
+        template<typename Signed>
+        size_t ParseSigned(const char* data, size_t sz, Signed& result)
+        {
+            size_t i = 0;
+            bool negative = false;
+            if(sz > 0 && (data[0] == '-' || data[0] == '+'))
+            {
+                negative = data[0] == '-';
+                i = 1;
+            }
+
+            uint64_t limit = (uint64_t) std::numeric_limits<Signed>::max() + (negative ? 1 : 0);
+            uint64_t value = 0;
+
+            i = ParseDigits(data, sz, i, limit, value);
+            if(i == 0)
+                return 0;
+
+            result = negative ? (Signed) (0 - value) : (Signed) value;
+            return i;
+        }
+
+        template<typename Unsigned>
+        size_t ParseUnsigned(const char* data, size_t sz, Unsigned& result)
+        {
+            size_t i = (sz > 0 && data[0] == '+') ? 1 : 0;
+            uint64_t value = 0;
+
+            i = ParseDigits(data, sz, i, (uint64_t) std::numeric_limits<Unsigned>::max(), value);
+            if(i == 0)
+                return 0;
+
+            result = (Unsigned) value;
+            return i;
+        }
+
+        /** A decimal number, as written in the text : value is
+         *  mantissa * 10^exponent. */
+        struct Decimal
+        {
+            uint64_t mantissa;
+            int      exponent;
+            bool     negative;
+            bool     truncated;///< True if more than 19 significant digits were given.
+            size_t   size;     ///< Number of characters used.
+        };
+
+        bool ScanDecimal(const char* data, size_t sz, Decimal& dec)
+        {
+            dec.mantissa  = 0;
+            dec.exponent  = 0;
+            dec.negative  = false;
+            dec.truncated = false;
+
+            size_t i = 0;
+            if(sz > 0 && (data[0] == '-' || data[0] == '+'))
+            {
+                dec.negative = data[0] == '-';
+                i = 1;
+            }
+
+            int  significants = 0;
+            bool hasDigits    = false;
+
+            for(; i < sz && IsDigit(data[i]); ++i)
+            {
+                hasDigits = true;
+                if(significants < 19)
+                {
+                    dec.mantissa = dec.mantissa * 10 + (uint64_t) (data[i] - '0');
+                    if(dec.mantissa) significants++;
+                }
+                else
+                {
+                    dec.exponent++;
+                    dec.truncated = dec.truncated || data[i] != '0';
+                }
+            }
+
+            if(i < sz && data[i] == '.')
+            {
+                for(++i; i < sz && IsDigit(data[i]); ++i)
+                {
+                    hasDigits = true;
+                    if(significants < 19)
+                    {
+                        dec.mantissa = dec.mantissa * 10 + (uint64_t) (data[i] - '0');
+                        dec.exponent--;
+                        if(dec.mantissa) significants++;
+                    }
+                    else
+                    {
+                        dec.truncated = dec.truncated || data[i] != '0';
+                    }
+                }
+            }
+
+            if(!hasDigits)
+                return false;
+
+            // The exponent is used only if it has at least one digit.
+            if(i < sz && (data[i] == 'e' || data[i] == 'E'))
+            {
+                size_t j = i + 1;
+                bool negexp = false;
+                if(j < sz && (data[j] == '-' || data[j] == '+'))
+                {
+                    negexp = data[j] == '-';
+                    j++;
+                }
+
+                if(j < sz && IsDigit(data[j]))
+                {
+                    int exp = 0;
+                    for(; j < sz && IsDigit(data[j]); ++j)
+                    {
+                        if(exp < 100000)
+                            exp = exp * 10 + (data[j] - '0');
+                    }
+
+                    dec.exponent += negexp ? -exp : exp;
+                    i = j;
+                }
+            }
+
+            dec.size = i;
+            return true;
+        }
+
+        /** Slow path : the C library conversion, on a null-terminated
+         *  copy of the number. */
+        template<typename T>
+        T ParseSlow(const char* data, const Decimal& dec, T (*convert)(const char*, char**))
+        {
+            char temp[128];
+            if(dec.size < sizeof(temp))
+            {
+                memcpy(temp, data, dec.size);
+                temp[dec.size] = '\0';
+            }
+            else
+            {
+                // Huge number of digits : only the significant ones are kept.
+                size_t sz = 0;
+                if(dec.negative) temp[sz++] = '-';
+                sz += FormatDigits(temp + sz, dec.mantissa);
+                temp[sz++] = 'e';
+                sz += NumberFormat::Format(temp + sz, (int32_t) dec.exponent);
+                temp[sz] = '\0';
+            }
+
+            return convert(temp, nullptr);
+        }
+
+        template<typename T>
+        size_t FormatSpecial(char* buffer, T value)
+        {
+            const char* str = nullptr;
+
+            if(std::isnan(value))
+                str = "nan";
+            else if(std::isinf(value))
+                str = value < 0 ? "-inf" : "inf";
+            else if(value == 0)
+                str = std::signbit(value) ? "-0" : "0";
+            else
+                return 0;
+
+            size_t sz = strlen(str);
+            memcpy(buffer, str, sz);
+            return sz;
+        }
+
+        /*
+           Shortest representation of reals : the Grisu2 algorithm of
+           Florian Loitsch ("Printing Floating-Point Numbers Quickly
+           and Accurately with Integers", 2010). The digits are
+           generated with 64 bits integers only, and always read back
+           to the same value. They are the shortest ones for nearly
+           every value ; for the others, one more digit is written.
+        */
+
+        /** A number f * 2^e, with a 64 bits f. */
+        struct DiyFp
+        {
+            uint64_t f;
+            int      e;
+
+            DiyFp(uint64_t _f, int _e) : f(_f), e(_e) {}
+        };
+
+        /** Returns x - y. Both must have the same exponent, and x >= y. */
+        inline DiyFp Sub(const DiyFp& x, const DiyFp& y)
+        {
+            return DiyFp(x.f - y.f, x.e);
+        }
+
+        /** Returns x * y, rounded : the upper 64 bits of the 128 bits
+         *  product. */
+        inline DiyFp Mul(const DiyFp& x, const DiyFp& y)
+        {
+            uint64_t xlo = x.f & 0xFFFFFFFFu, xhi = x.f >> 32;
+            uint64_t ylo = y.f & 0xFFFFFFFFu, yhi = y.f >> 32;
+
+            uint64_t p0 = xlo * ylo;
+            uint64_t p1 = xlo * yhi;
+            uint64_t p2 = xhi * ylo;
+            uint64_t p3 = xhi * yhi;
+
+            uint64_t mid = (p0 >> 32) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu);
+            mid += (uint64_t) 1 << 31;// Rounds, ties up.
+
+            return DiyFp(p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32), x.e + y.e + 64);
+        }
+
+        inline DiyFp Normalize(DiyFp x)
+        {
+            while((x.f >> 63) == 0)
+            {
+                x.f <<= 1;
+                x.e--;
+            }
+
+            return x;
+        }
+
+        /** The value and its boundaries : every real between minus and
+         *  plus reads back to the value. */
+        struct Boundaries
+        {
+            DiyFp w;
+            DiyFp minus;
+            DiyFp plus;
+        };
+
+        /** Computes the boundaries of a positive finite value, from its
+         *  bits. Precision is the size of the mantissa, including the
+         *  hidden bit (53 for a double, 24 for a float). */
+        Boundaries ComputeBoundaries(uint64_t bits, int precision, int maxExponent)
+        {
+            const int      bias      = maxExponent - 1 + (precision - 1);
+            const uint64_t hiddenBit = (uint64_t) 1 << (precision - 1);
+
+            uint64_t exp  = bits >> (precision - 1);
+            uint64_t frac = bits & (hiddenBit - 1);
+
+            DiyFp v = exp == 0 ? DiyFp(frac, 1 - bias) : DiyFp(frac + hiddenBit, (int) exp - bias);
+
+            // The previous value is closer when value is a power of two.
+            bool lowerCloser = frac == 0 && exp > 1;
+
+            DiyFp plus  = Normalize(DiyFp(2 * v.f + 1, v.e - 1));
+            DiyFp minus = lowerCloser ? DiyFp(4 * v.f - 1, v.e - 2) : DiyFp(2 * v.f - 1, v.e - 1);
+            minus = DiyFp(minus.f << (minus.e - plus.e), plus.e);
+
+            Boundaries b = { Normalize(v), minus, plus };
+            return b;
+        }
+
+        /** 10^k, as f * 2^e rounded to 64 bits, for k from -300 to 324
+         *  by steps of 8. */
+        struct CachedPower
+        {
+            uint64_t f;
+            int      e;
+            int      k;
+        };
+
+        const CachedPower CachedPowers[] =
+        {
+            { 0xAB70FE17C79AC6CAULL, -1060, -300 },
+            { 0xFF77B1FCBEBCDC4FULL, -1034, -292 },
+            { 0xBE5691EF416BD60CULL, -1007, -284 },
+            { 0x8DD01FAD907FFC3CULL,  -980, -276 },
+            { 0xD3515C2831559A83ULL,  -954, -268 },
+            { 0x9D71AC8FADA6C9B5ULL,  -927, -260 },
+            { 0xEA9C227723EE8BCBULL,  -901, -252 },
+            { 0xAECC49914078536DULL,  -874, -244 },
+            { 0x823C12795DB6CE57ULL,  -847, -236 },
+            { 0xC21094364DFB5637ULL,  -821, -228 },
+            { 0x9096EA6F3848984FULL,  -794, -220 },
+            { 0xD77485CB25823AC7ULL,  -768, -212 },
+            { 0xA086CFCD97BF97F4ULL,  -741, -204 },
+            { 0xEF340A98172AACE5ULL,  -715, -196 },
+            { 0xB23867FB2A35B28EULL,  -688, -188 },
+            { 0x84C8D4DFD2C63F3BULL,  -661, -180 },
+            { 0xC5DD44271AD3CDBAULL,  -635, -172 },
+            { 0x936B9FCEBB25C996ULL,  -608, -164 },
+            { 0xDBAC6C247D62A584ULL,  -582, -156 },
+            { 0xA3AB66580D5FDAF6ULL,  -555, -148 },
+            { 0xF3E2F893DEC3F126ULL,  -529, -140 },
+            { 0xB5B5ADA8AAFF80B8ULL,  -502, -132 },
+            { 0x87625F056C7C4A8BULL,  -475, -124 },
+            { 0xC9BCFF6034C13053ULL,  -449, -116 },
+            { 0x964E858C91BA2655ULL,  -422, -108 },
+            { 0xDFF9772470297EBDULL,  -396, -100 },
+            { 0xA6DFBD9FB8E5B88FULL,  -369,  -92 },
+            { 0xF8A95FCF88747D94ULL,  -343,  -84 },
+            { 0xB94470938FA89BCFULL,  -316,  -76 },
+            { 0x8A08F0F8BF0F156BULL,  -289,  -68 },
+            { 0xCDB02555653131B6ULL,  -263,  -60 },
+            { 0x993FE2C6D07B7FACULL,  -236,  -52 },
+            { 0xE45C10C42A2B3B06ULL,  -210,  -44 },
+            { 0xAA242499697392D3ULL,  -183,  -36 },
+            { 0xFD87B5F28300CA0EULL,  -157,  -28 },
+            { 0xBCE5086492111AEBULL,  -130,  -20 },
+            { 0x8CBCCC096F5088CCULL,  -103,  -12 },
+            { 0xD1B71758E219652CULL,   -77,   -4 },
+            { 0x9C40000000000000ULL,   -50,    4 },
+            { 0xE8D4A51000000000ULL,   -24,   12 },
+            { 0xAD78EBC5AC620000ULL,     3,   20 },
+            { 0x813F3978F8940984ULL,    30,   28 },
+            { 0xC097CE7BC90715B3ULL,    56,   36 },
+            { 0x8F7E32CE7BEA5C70ULL,    83,   44 },
+            { 0xD5D238A4ABE98068ULL,   109,   52 },
+            { 0x9F4F2726179A2245ULL,   136,   60 },
+            { 0xED63A231D4C4FB27ULL,   162,   68 },
+            { 0xB0DE65388CC8ADA8ULL,   189,   76 },
+            { 0x83C7088E1AAB65DBULL,   216,   84 },
+            { 0xC45D1DF942711D9AULL,   242,   92 },
+            { 0x924D692CA61BE758ULL,   269,  100 },
+            { 0xDA01EE641A708DEAULL,   295,  108 },
+            { 0xA26DA3999AEF774AULL,   322,  116 },
+            { 0xF209787BB47D6B85ULL,   348,  124 },
+            { 0xB454E4A179DD1877ULL,   375,  132 },
+            { 0x865B86925B9BC5C2ULL,   402,  140 },
+            { 0xC83553C5C8965D3DULL,   428,  148 },
+            { 0x952AB45CFA97A0B3ULL,   455,  156 },
+            { 0xDE469FBD99A05FE3ULL,   481,  164 },
+            { 0xA59BC234DB398C25ULL,   508,  172 },
+            { 0xF6C69A72A3989F5CULL,   534,  180 },
+            { 0xB7DCBF5354E9BECEULL,   561,  188 },
+            { 0x88FCF317F22241E2ULL,   588,  196 },
+            { 0xCC20CE9BD35C78A5ULL,   614,  204 },
+            { 0x98165AF37B2153DFULL,   641,  212 },
+            { 0xE2A0B5DC971F303AULL,   667,  220 },
+            { 0xA8D9D1535CE3B396ULL,   694,  228 },
+            { 0xFB9B7CD9A4A7443CULL,   720,  236 },
+            { 0xBB764C4CA7A44410ULL,   747,  244 },
+            { 0x8BAB8EEFB6409C1AULL,   774,  252 },
+            { 0xD01FEF10A657842CULL,   800,  260 },
+            { 0x9B10A4E5E9913129ULL,   827,  268 },
+            { 0xE7109BFBA19C0C9DULL,   853,  276 },
+            { 0xAC2820D9623BF429ULL,   880,  284 },
+            { 0x80444B5E7AA7CF85ULL,   907,  292 },
+            { 0xBF21E44003ACDD2DULL,   933,  300 },
+            { 0x8E679C2F5E44FF8FULL,   960,  308 },
+            { 0xD433179D9C8CB841ULL,   986,  316 },
+            { 0x9E19DB92B4E31BA9ULL,  1013,  324 }
+        };
+
+        // Exponents range of the scaled values : digits are generated
+        // from a 32 bits integral part.
+        const int MinScaledExponent = -60;
+        const int MaxScaledExponent = -32;
+
+        /** Returns the cached power of ten c such that the exponent of
+         *  c * 2^e is between MinScaledExponent and MaxScaledExponent. */
+        inline const CachedPower& GetCachedPower(int e)
+        {
+            // k = ceil((MinScaledExponent - e - 1) * log10(2)).
+            int f = MinScaledExponent - e - 1;
+            int k = (f * 78913) / (1 << 18) + (f > 0 ? 1 : 0);
+
+            return CachedPowers[(300 + k + 7) / 8];
+        }
+
+        /** Returns the number of digits of n, and the power of ten of
+         *  its first digit. */
+        inline int CountDigits(uint32_t n, uint32_t& pow10)
+        {
+            int count = 1;
+            pow10 = 1;
+            while(count < 10 && n >= pow10 * 10)
+            {
+                pow10 *= 10;
+                count++;
+            }
+
+            return count;
+        }
+
+        /** Moves the last digit down while the number stays in the
+         *  interval and gets closer to the value. */
+        inline void RoundLastDigit(char* digits, int count, uint64_t dist, uint64_t delta, uint64_t rest, uint64_t tenK)
+        {
+            while(rest < dist && delta - rest >= tenK && (rest + tenK < dist || dist - rest > rest + tenK - dist))
+            {
+                digits[count - 1]--;
+                rest += tenK;
+            }
+        }
+
+        /** Generates the shortest digits in [low, high], the closest to
+         *  w. The number is digits * 10^exponent. */
+        void GenerateDigits(char* digits, int& count, int& exponent, const DiyFp& low, const DiyFp& w, const DiyFp& high)
+        {
+            uint64_t delta = Sub(high, low).f;
+            uint64_t dist  = Sub(high, w).f;
+
+            const int      shift = -high.e;
+            const uint64_t one   = (uint64_t) 1 << shift;
+
+            uint32_t integral   = (uint32_t) (high.f >> shift);
+            uint64_t fractional = high.f & (one - 1);
+
+            uint32_t pow10;
+            int      n = CountDigits(integral, pow10);
+
+            while(n > 0)
+            {
+                digits[count++] = (char) ('0' + integral / pow10);
+                integral %= pow10;
+                n--;
+
+                uint64_t rest = ((uint64_t) integral << shift) + fractional;
+                if(rest <= delta)
+                {
+                    exponent += n;
+                    RoundLastDigit(digits, count, dist, delta, rest, (uint64_t) pow10 << shift);
+                    return;
+                }
+
+                pow10 /= 10;
+            }
+
+            int m = 0;
+            for(;;)
+            {
+                fractional *= 10;
+                digits[count++] = (char) ('0' + (fractional >> shift));
+                fractional &= one - 1;
+                m++;
+
+                delta *= 10;
+                dist  *= 10;
+                if(fractional <= delta)
+                    break;
+            }
+
+            exponent -= m;
+            RoundLastDigit(digits, count, dist, delta, fractional, one);
+        }
+
+        /** Writes digits * 10^exponent as printf("%g") would with a
+         *  precision of max(count, minPrecision) : in fixed notation
+         *  when its first digit is between 10^-4 and 10^precision. */
+        size_t FormatDecimal(char* buffer, bool negative, const char* digits, int count, int exponent, int minPrecision)
+        {
+            char* cur = buffer;
+            if(negative)
+                *cur++ = '-';
+
+            int first     = exponent + count - 1;// Exponent of the first digit.
+            int precision = count > minPrecision ? count : minPrecision;
+
+            if(first >= -4 && first < precision)
+            {
+                if(first < 0)
+                {
+                    // 0.000ddd
+                    *cur++ = '0';
+                    *cur++ = '.';
+                    for(int i = first + 1; i < 0; ++i)
+                        *cur++ = '0';
+                    memcpy(cur, digits, (size_t) count);
+                    cur += count;
+                }
+                else if(exponent >= 0)
+                {
+                    // ddd000
+                    memcpy(cur, digits, (size_t) count);
+                    cur += count;
+                    for(int i = 0; i < exponent; ++i)
+                        *cur++ = '0';
+                }
+                else
+                {
+                    // ddd.ddd
+                    memcpy(cur, digits, (size_t) (first + 1));
+                    cur += first + 1;
+                    *cur++ = '.';
+                    memcpy(cur, digits + first + 1, (size_t) (count - first - 1));
+                    cur += count - first - 1;
+                }
+            }
+            else
+            {
+                // d.ddde+xx
+                *cur++ = digits[0];
+                if(count > 1)
+                {
+                    *cur++ = '.';
+                    memcpy(cur, digits + 1, (size_t) (count - 1));
+                    cur += count - 1;
+                }
+
+                *cur++ = 'e';
+                *cur++ = first < 0 ? '-' : '+';
+
+                unsigned int e = (unsigned int) (first < 0 ? -first : first);
+                if(e < 10)
+                    *cur++ = '0';
+                cur += FormatDigits(cur, e);
+            }
+
+            return (size_t) (cur - buffer);
+        }
+
+        /** Writes the shortest representation of a positive finite
+         *  value, given by its bits. */
+        size_t FormatShortest(char* buffer, bool negative, uint64_t bits, int precision, int maxExponent, int minPrecision)
+        {
+            Boundaries b = ComputeBoundaries(bits, precision, maxExponent);
+
+            const CachedPower& cached = GetCachedPower(b.plus.e);
+            DiyFp c(cached.f, cached.e);
+
+            DiyFp w     = Mul(b.w, c);
+            DiyFp minus = Mul(b.minus, c);
+            DiyFp plus  = Mul(b.plus, c);
+
+            // The products may be one unit off : the interval is
+            // shrunk so that every number in it is safe.
+            DiyFp low(minus.f + 1, minus.e);
+            DiyFp high(plus.f - 1, plus.e);
+
+            char digits[20];
+            int  count    = 0;
+            int  exponent = -cached.k;
+            GenerateDigits(digits, count, exponent, low, w, high);
+
+            return FormatDecimal(buffer, negative, digits, count, exponent, minPrecision);
+        }
+
+        inline float ConvertFloat(const char* str, char** end) { return strtof(str, end); }
+        inline double ConvertDouble(const char* str, char** end) { return strtod(str, end); }
+    }
+
+    namespace NumberFormat
+    {
+        size_t Format(char* buffer, uint32_t value)
+        {
+            return FormatDigits(buffer, value);
+        }
+
+        size_t Format(char* buffer, int32_t value)
+        {
+            if(value < 0)
+            {
+                buffer[0] = '-';
+                return 1 + FormatDigits(buffer + 1, 0u - (uint32_t) value);
+            }
+
+            return FormatDigits(buffer, (uint32_t) value);
+        }
+
+        size_t Format(char* buffer, uint64_t value)
+        {
+            return FormatDigits(buffer, value);
+        }
+
+        size_t Format(char* buffer, int64_t value)
+        {
+            if(value < 0)
+            {
+                buffer[0] = '-';
+                return 1 + FormatDigits(buffer + 1, (uint64_t) 0 - (uint64_t) value);
+            }
+
+            return FormatDigits(buffer, (uint64_t) value);
+        }
+
+        size_t Format(char* buffer, double value)
+        {
+            size_t sz = FormatSpecial(buffer, value);
+            if(sz)
+                return sz;
+
+            // Integral values are the most common ones and are written
+            // directly, without any decimals.
+            if(std::fabs(value) < 9007199254740992.0 && (double) (int64_t) value == value)
+                return Format(buffer, (int64_t) value);
+
+            uint64_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            return FormatShortest(buffer, value < 0, bits & 0x7FFFFFFFFFFFFFFFULL, 53, 1024, 15);
+        }
+
+        size_t Format(char* buffer, float value)
+        {
+            size_t sz = FormatSpecial(buffer, value);
+            if(sz)
+                return sz;
+
+            if(std::fabs(value) < 16777216.0f && (float) (int32_t) value == value)
+                return Format(buffer, (int32_t) value);
+
+            uint32_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            return FormatShortest(buffer, value < 0, bits & 0x7FFFFFFFu, 24, 128, 6);
+        }
+
+        size_t Parse(const char* data, size_t sz, int32_t& result)
+        {
+            size_t spaces = SkipSpaces(data, sz);
+            size_t read   = ParseSigned(data + spaces, sz - spaces, result);
+            return read ? spaces + read : 0;
+        }
+
+        size_t Parse(const char* data, size_t sz, uint32_t& result)
+        {
+            size_t spaces = SkipSpaces(data, sz);
+            size_t read   = ParseUnsigned(data + spaces, sz - spaces, result);
+            return read ? spaces + read : 0;
+        }
+
+        size_t Parse(const char* data, size_t sz, int64_t& result)
+        {
+            size_t spaces = SkipSpaces(data, sz);
+            size_t read   = ParseSigned(data + spaces, sz - spaces, result);
+            return read ? spaces + read : 0;
+        }
+
+        size_t Parse(const char* data, size_t sz, uint64_t& result)
+        {
+            size_t spaces = SkipSpaces(data, sz);
+            size_t read   = ParseUnsigned(data + spaces, sz - spaces, result);
+            return read ? spaces + read : 0;
+        }
+
+        size_t Parse(const char* data, size_t sz, double& result)
+        {
+            size_t spaces = SkipSpaces(data, sz);
+            data += spaces;
+            sz   -= spaces;
+
+            Decimal dec;
+            if(!ScanDecimal(data, sz, dec))
+                return 0;
+
+            // When both the mantissa and the power of ten are exact
+            // doubles, one operation gives the correctly rounded value.
+            if(!dec.truncated && dec.mantissa <= (1ull << 53) && dec.exponent >= -22 && dec.exponent <= 22)
+            {
+                double value = (double) dec.mantissa;
+                if(dec.exponent < 0)
+                    value /= DoublePow10[-dec.exponent];
+                else
+                    value *= DoublePow10[dec.exponent];
+
+                result = dec.negative ? -value : value;
+                return spaces + dec.size;
+            }
+
+            result = ParseSlow(data, dec, &ConvertDouble);
+            return spaces + dec.size;
+        }
+
+        size_t Parse(const char* data, size_t sz, float& result)
+        {
+            size_t spaces = SkipSpaces(data, sz);
+            data += spaces;
+            sz   -= spaces;
+
+            Decimal dec;
+            if(!ScanDecimal(data, sz, dec))
+                return 0;
+
+            if(!dec.truncated && dec.mantissa <= (1ull << 24) && dec.exponent >= -10 && dec.exponent <= 10)
+            {
+                float value = (float) dec.mantissa;
+                if(dec.exponent < 0)
+                    value /= FloatPow10[-dec.exponent];
+                else
+                    value *= FloatPow10[dec.exponent];
+
+                result = dec.negative ? -value : value;
+                return spaces + dec.size;
+            }
+
+            result = ParseSlow(data, dec, &ConvertFloat);
+            return spaces + dec.size;
+        }
+    }
+}
@@ -35,6 +35,11 @@ namespace APro
 
     String Path::getLastElement() const
     {
-        return extract(findLast(FileSystem::GetSeparator()), size());
+        return String(getLastElementView());
+    }
+
+    StringView Path::getLastElementView() const
+    {
+        return FileSystem::ExtractFilenameView(*this);
     }
 }
@@ -13,6 +13,7 @@
 /////////////////////////////////////////////////////////////
 #include "PluginManager.h"
 #include "FileSystem.h"
+#include "DirectoryScanner.h"
 #include "Console.h"
 
 namespace APro
@@ -61,7 +62,8 @@ namespace APro
 
     PluginHandlePtr PluginManager::addPluginHandle(const String& name, const String& filename, bool load_now)
     {
-        if(name.isEmpty())
+        // Without name, the name is read from the library.
+        if(name.isEmpty() && filename.isEmpty())
             return nullptr;
 
         PluginHandlePtr ph = getPluginHandle(name);
@@ -225,20 +227,19 @@ namespace APro
     {
         if(FileSystem::IsDirectory(path))
         {
-            Directory dir(path);
-            dir.skipDirectory(true);
-            dir.skipDot(true);
+            DirectoryScanner scanner;
+            scanner.skipDirectories(true);
+            scanner.addExtension(DYNLIB_EXTENSION);
 
-            int files_in_dir = dir.countEntries();
-            if(files_in_dir > 0)
+            Array<DirectoryScanner::Entry> files = scanner.scan(Path(path));
+            if(!files.isEmpty())
             {
-                aprodebug("Trying to load '") << files_in_dir << "' files.";
+                aprodebug("Trying to load '") << (unsigned long) files.size() << "' files.";
 
                 int ret = 0;
-                Directory::Entry ent;
-                while(dir >> ent)
+                for(size_t i = 0; i < files.size(); ++i)
                 {
-                    if(!addPluginHandle(String(), ent.name, true).isNull())
+                    if(!addPluginHandle(String(), files[i].path, true).isNull())
                         ret++;
                 }
 
@@ -39,4 +39,9 @@ namespace APro
     {
         return m_filename;
     }
+
+    size_t Resource::getMemorySize() const
+    {
+        return sizeof(Resource) + m_filename.size();
+    }
 }
@@ -0,0 +1,160 @@
+/////////////////////////////////////////////////////////////
+/** @file ResourceFuture.cpp
+ *  @ingroup Core
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the ResourceRequest and ResourceFuture classes.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "ResourceFuture.h"
+
+namespace APro
+{
+    ResourceRequest::ResourceRequest()
+        : loader(nullptr), resource(nullptr), priority(0), next(nullptr), done(false), calling(false), refs(1)
+    {
+
+    }
+
+    void ResourceRequest::retain()
+    {
+        mutex.lock();
+        refs++;
+        mutex.unlock();
+    }
+
+    void ResourceRequest::release()
+    {
+        mutex.lock();
+        bool last = --refs == 0;
+        mutex.unlock();
+
+        if(last)
+        {
+            ResourceRequest* _this = this;
+            AProDelete(_this);
+        }
+    }
+
+    void ResourceRequest::addCallback(const ResourceCallback& callback)
+    {
+        mutex.lock();
+        bool now = calling || done;
+        if(!now)
+            callbacks.append(callback);
+        mutex.unlock();
+
+        if(now)
+            callback(*this);
+    }
+
+    void ResourceRequest::complete(const ResourcePtr& result)
+    {
+        mutex.lock();
+        resource = result;
+        calling  = true;
+        mutex.unlock();
+
+        // Called before waiting threads wake up : an object waiting
+        // for the request can be destroyed once it is woken up.
+        for(size_t i = 0; i < callbacks.size(); ++i)
+            callbacks[i](*this);
+
+        mutex.lock();
+        done = true;
+        condition.signalAll();
+        mutex.unlock();
+    }
+
+    ResourceFuture::ResourceFuture()
+        : m_request(nullptr)
+    {
+
+    }
+
+    ResourceFuture::ResourceFuture(ResourceRequest* request)
+        : m_request(request)
+    {
+
+    }
+
+    ResourceFuture::ResourceFuture(const ResourceFuture& rhs)
+        : m_request(rhs.m_request)
+    {
+        if(m_request)
+            m_request->retain();
+    }
+
+    ResourceFuture& ResourceFuture::operator = (const ResourceFuture& rhs)
+    {
+        if(rhs.m_request)
+            rhs.m_request->retain();
+        if(m_request)
+            m_request->release();
+
+        m_request = rhs.m_request;
+        return *this;
+    }
+
+    ResourceFuture::~ResourceFuture()
+    {
+        if(m_request)
+            m_request->release();
+    }
+
+    const String& ResourceFuture::getName() const
+    {
+        static const String Empty;
+        return m_request ? m_request->name : Empty;
+    }
+
+    bool ResourceFuture::isReady() const
+    {
+        if(!m_request)
+            return false;
+
+        m_request->mutex.lock();
+        bool ret = m_request->done;
+        m_request->mutex.unlock();
+        return ret;
+    }
+
+    const ResourcePtr& ResourceFuture::wait() const
+    {
+        if(!m_request)
+            return ResourcePtr::Null;
+
+        m_request->mutex.lock();
+        while(!m_request->done)
+            m_request->condition.wait(&m_request->mutex);
+        m_request->mutex.unlock();
+
+        return m_request->resource;
+    }
+
+    void ResourceFuture::onReady(const ResourceCallback& callback) const
+    {
+        if(m_request)
+            m_request->addCallback(callback);
+    }
+}
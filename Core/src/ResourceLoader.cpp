@@ -13,6 +13,8 @@
 ////////////////////////////////////////////////////////////
 #include "ResourceLoader.h"
 #include "Variant.h"
+#include "File.h"
+#include "Console.h"
 
 namespace APro
 {
@@ -48,4 +50,32 @@ namespace APro
     {
         return description;
     }
+
+    bool ResourceLoader::isThreadSafe() const
+    {
+        return false;
+    }
+
+    void ResourceLoader::getDependencies(const String&, Array<String>&) const
+    {
+
+    }
+
+    ResourcePtr ResourceLoader::loadResourceFromStream(const String& filename, MemoryStream&)
+    {
+        aprodebug("Loader '") << name << "' can't load '" << filename << "' from memory.";
+        return nullptr;
+    }
+
+    bool ResourceLoader::canLoadFromStream() const
+    {
+        return false;
+    }
+
+    FileMapping ResourceLoader::mapFile(const String& filename, FileMapping::Advice advice) const
+    {
+        // The mapping stays valid when the file is closed.
+        File file(filename, "rb");
+        return file.map(advice);
+    }
 }
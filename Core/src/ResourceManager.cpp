@@ -30,14 +30,178 @@
 ////////////////////////////////////////////////////////////
 #include "ResourceManager.h"
 #include "Console.h"
+#include "StringBuilder.h"
 #include "FileSystem.h"
+#include "Thread.h"
+
+#include <algorithm>
 
 namespace APro
 {
+    ////////////////////////////////////////////////////////////
+    /** @class ResourceLoadingThread
+     *  @ingroup Core
+     *  @brief Loads the requests queued by
+     *  ResourceManager::loadResourceAsync().
+    **/
+    ////////////////////////////////////////////////////////////
+    class ResourceLoadingThread : public Thread
+    {
+    public:
+
+        ResourceLoadingThread(ResourceManager* manager)
+            : Thread(String("Resource Loader")), m_manager(manager)
+        {
+
+        }
+
+        void exec()
+        {
+            ResourceRequest* request;
+            while((request = m_manager->_takeRequest()) != nullptr)
+                m_manager->_executeRequest(request);
+        }
+
+    private:
+
+        ResourceManager* m_manager;
+    };
+
+    ////////////////////////////////////////////////////////////
+    /** @class ResourceGraphLoad
+     *  @ingroup Core
+     *  @brief Loads a dependency graph built by
+     *  ResourceManager::_addGraphNode().
+     *
+     *  A node is queued once every node it depends on is done, so
+     *  independent branches load in parallel in the loading threads.
+     *  The object destroys itself once every node is done. Node 0 is
+     *  the resource given to the future, which is ready only once
+     *  every node is done.
+    **/
+    ////////////////////////////////////////////////////////////
+    class ResourceGraphLoad : public NonCopyable
+    {
+    public:
+
+        struct Node
+        {
+            String            name;       ///< Entry receiving the resource.
+            String            filename;   ///< File to load.
+            ResourceLoaderPtr loader;     ///< Loader to use, or null for the default one.
+            Array<size_t>     dependents; ///< Nodes waiting for this one.
+            size_t            waiting;    ///< Number of nodes this one still waits for.
+            bool              force;      ///< Loaded even if the entry is already loaded.
+        };
+
+        ResourceManager*         manager;  ///< Manager loading the nodes.
+        Array<Node>              nodes;    ///< Nodes of the graph.
+        QuickMap<String, size_t> indices;  ///< Index of each node, by name.
+        QuickMap<String, bool>   visiting; ///< Nodes being added, to detect cycles.
+        ResourceRequest*         root;     ///< Request completed with node 0, once every node is done.
+        ResourcePtr              resource; ///< Resource of node 0.
+        int                      priority; ///< Priority of every request.
+        size_t                   remaining;///< Nodes not done yet, plus one while starting.
+        ThreadMutexI             mutex;    ///< Protects waiting and remaining.
+
+    public:
+
+        ResourceGraphLoad(ResourceManager* _manager, int _priority)
+            : manager(_manager), root(AProNew(ResourceRequest)), resource(nullptr), priority(_priority), remaining(0)
+        {
+            root->refs = 2;// The graph, and the future.
+        }
+
+        ResourceFuture start()
+        {
+            ResourceFuture future(root);
+            root->name     = nodes[0].name;
+            root->filename = nodes[0].filename;
+
+            remaining = nodes.size() + 1;
+
+            Array<size_t> leaves;
+            for(size_t i = 0; i < nodes.size(); ++i)
+                if(nodes[i].waiting == 0)
+                    leaves.append(i);
+
+            for(size_t i = 0; i < leaves.size(); ++i)
+                submit(leaves[i]);
+
+            finish();
+            return future;
+        }
+
+    private:
+
+        void submit(size_t i)
+        {
+            const Node& node = nodes[i];
+            ResourceFuture future = manager->_queueRequest(node.name, node.filename, node.loader, priority, node.force);
+            if(!future.isValid())
+            {
+                done(i, ResourcePtr::Null);
+                return;
+            }
+
+            future.onReady([this, i] (const ResourceRequest& request) {
+                done(i, request.resource);
+            });
+        }
+
+        void done(size_t i, const ResourcePtr& resource)
+        {
+            // A failed dependency does not stop its dependents : their
+            // loader decides what to do without it.
+            Array<size_t> ready;
+            mutex.lock();
+            for(size_t d = 0; d < nodes[i].dependents.size(); ++d)
+            {
+                Node& dependent = nodes[nodes[i].dependents[d]];
+                if(--dependent.waiting == 0)
+                    ready.append(nodes[i].dependents[d]);
+            }
+            mutex.unlock();
+
+            if(i == 0)
+            {
+                mutex.lock();
+                this->resource = resource;
+                mutex.unlock();
+            }
+
+            for(size_t r = 0; r < ready.size(); ++r)
+                submit(ready[r]);
+
+            finish();
+        }
+
+        void finish()
+        {
+            mutex.lock();
+            bool last = --remaining == 0;
+            mutex.unlock();
+
+            if(last)
+            {
+                // Dependents of node 0 are loaded too : a reload is
+                // complete.
+                root->complete(resource);
+                root->release();
+
+                ResourceGraphLoad* _this = this;
+                AProDelete(_this);
+            }
+        }
+    };
+
     APRO_IMPLEMENT_MANUALSINGLETON(ResourceManager)
 
     ResourceManager::ResourceManager()
-        : m_loaders(Manager<ResourceLoader>::objects), m_writers(Manager<ResourceWriter>::objects)
+        : m_loaders(Manager<ResourceLoader>::objects), m_writers(Manager<ResourceWriter>::objects),
+          m_overwrite_loading(false), m_async_first(nullptr), m_async_last(nullptr),
+          m_async_running(false), m_async_stopping(false),
+          m_memory_budget(0), m_memory_usage(0), m_clock_hand(0)
     {
         m_default_loaders[""] = nullptr;
         m_default_writers[""] = nullptr;
@@ -49,131 +213,107 @@ namespace APro
         // do not need to destroy them.
         // Resource unloading is done there to be sure because some resources
         // take much space in memory.
+        // Loading threads are stopped first, as they publish in the
+        // entries.
 
+        stopLoadingThreads();
         unloadAllResource();
+
+        for(size_t i = 0; i < m_packs.size(); ++i)
+            AProDelete(m_packs[i]);
     }
 
-    ResourcePtr& ResourceManager::getResource(const String& name)
+    ResourcePtr ResourceManager::getResource(const String& name)
     {
-        if(!name.isEmpty())
-        {
-            APRO_THREADSAFE_AUTOLOCK;
-
-            ResourceEntryPtr entry = nullptr;
-            List<ResourceEntry>::const_iterator e = m_resource_entries.end();
-            for(List<ResourceEntry>::iterator it = m_resource_entries.begin(); it != e; it++)
-                if((*it).getName() == name)
-                    entry = &(*it);
-
-            if(entry)
-                return entry->getResource();
-            else
-            {
-                aprodebug("Can't find Resource Entry '") << name << "'.";
-            }
-        }
+        ResourceEntryPtr entry = getResourceEntry(name);
+        if(entry)
+            return entry->getResource();
 
-        return nullptr;
+        return ResourcePtr::Null;
     }
 
-    const ResourcePtr& ResourceManager::getResource(const String& name) const
+    ResourcePtr ResourceManager::getResource(const String& name) const
     {
-        if(!name.isEmpty())
-        {
-            APRO_THREADSAFE_AUTOLOCK;
-
-            const ResourceEntryPtr entry = nullptr;
-            List<ResourceEntry>::const_iterator e = m_resource_entries.end();
-            for(List<ResourceEntry>::const_iterator it = m_resource_entries.begin(); it != e; it++)
-                if((*it).getName() == name)
-                    entry = &(*it);
-
-            if(entry)
-                return entry->getResource();
-            else
-            {
-                aprodebug("Can't find Resource Entry '") << name << "'.";
-            }
-        }
+        const ResourceEntryPtr entry = getResourceEntry(name);
+        if(entry)
+            return entry->getResource();
 
-        return nullptr;
+        return ResourcePtr::Null;
     }
 
     ResourceEntryPtr ResourceManager::getResourceEntry(const String& name)
     {
         if(!name.isEmpty())
         {
-            APRO_THREADSAFE_AUTOLOCK;
-
-            ResourceEntryPtr entry = nullptr;
-            List<ResourceEntry>::const_iterator e = m_resource_entries.end();
-            for(List<ResourceEntry>::iterator it = m_resource_entries.begin(); it != e; it++)
-                if((*it).getName() == name)
-                    entry = &(*it);
-
+            ResourceEntryPtr entry = _findEntry(name);
             if(entry)
                 return entry;
-            else
-            {
-                aprodebug("Can't find Resource Entry '") << name << "'.";
-            }
+
+            aprodebug("Can't find Resource Entry '") << name << "'.";
         }
 
         return nullptr;
     }
 
     const ResourceEntryPtr ResourceManager::getResourceEntry(const String& name) const
+    {
+        return const_cast<ResourceManager*>(this)->getResourceEntry(name);
+    }
+
+    ResourceEntryPtr ResourceManager::createResourceEntry(const String& name)
     {
         if(!name.isEmpty())
         {
             APRO_THREADSAFE_AUTOLOCK;
 
-            const ResourceEntryPtr entry = nullptr;
-            List<ResourceEntry>::const_iterator e = m_resource_entries.end();
-            for(List<ResourceEntry>::const_iterator it = m_resource_entries.begin(); it != e; it++)
-                if((*it).getName() == name)
-                    entry = &(*it);
-
-            if(entry)
-                return entry;
-            else
+            // We use this function also to retrieve resource or create it if it doesn't exists.
+            ResourceEntryPtr entry = _findEntry(name);
+            if(!entry)
             {
-                aprodebug("Can't find Resource Entry '") << name << "'.";
+                entry = AProNew(ResourceEntry, name, this);
+                m_resource_entries.append(entry);
+                m_resource_index.put(name, entry);
             }
+
+            return entry;
         }
 
         return nullptr;
     }
 
-    ResourceEntryPtr ResourceManager::createResourceEntry(const String& name)
+    ResourcePtr ResourceManager::getResource(const Atom& name)
     {
-        if(!name.isEmpty())
-        {
-            APRO_THREADSAFE_AUTOLOCK;
+        ResourceEntryPtr entry = getResourceEntry(name);
+        if(entry)
+            return entry->getResource();
 
-            ResourceEntryPtr entry = nullptr;
-            List<ResourceEntry>::const_iterator e = m_resource_entries.end();
-            for(List<ResourceEntry>::iterator it = m_resource_entries.begin(); it != e; it++)
-                if((*it).getName() == name)
-                    entry = &(*it);
+        return ResourcePtr::Null;
+    }
 
+    ResourceEntryPtr ResourceManager::getResourceEntry(const Atom& name)
+    {
+        if(!name.isEmpty())
+        {
+            ResourceEntryPtr entry = _findEntry(name.toString());
             if(entry)
-            {
-//              No need as we use this function also to retrieve resource or create it if it doesn't exists.
-//              aprodebug("Entry '") << name << "' already exists. Can't create it.";
-                return entry;
-            }
-            else
-            {
-                entry = AProNew(ResourceEntry, name);
-                m_resource_entries.push_back(entry);
                 return entry;
-            }
+
+            aprodebug("Can't find Resource Entry '") << name.toString() << "'.";
         }
 
         return nullptr;
     }
 
+    ResourceEntryPtr ResourceManager::getResourceEntry(const Atom& name) const
+    {
+        return const_cast<ResourceManager*>(this)->getResourceEntry(name);
+    }
+
+    ResourceEntryPtr ResourceManager::loadResource(const Atom& name, const String& filename)
+    {
+        return loadResource(name.toString(), filename);
+    }
+
     ResourceEntryPtr ResourceManager::loadResource(const String& name, const String& filename)
     {
         if(name.isEmpty())
@@ -198,12 +338,12 @@ namespace APro
         }
         else if (filename.isEmpty())
         {
-            aprodebug("Try to load entry '") << entry->getName() << "' without file."
+            aprodebug("Try to load entry '") << entry->getName() << "' without file.";
             return false;
         }
         else
         {
-            if(!entry->getResource().isNull())
+            if(entry->isLoaded())
             {
                 if(m_overwrite_loading)
                 {
@@ -215,16 +355,17 @@ namespace APro
                     aprodebug("Resource '") << entry->getName() << "' already exists so generating a copy name.";
 
                     ResourceNCG ncg(this);
-                    return loadResource(ncg(entry->getName()), filename, loaderName);
+                    return loadResource(ncg(entry->getName()), filename) != nullptr;
                 }
             }
 
-            ResourceLoaderPtr loader = _findCorrectLoader(FileSystem::getExtension(filename));
+            ResourceLoaderPtr loader = _findCorrectLoader(FileSystem::ExtractExtension(filename));
             if(!loader.isNull())
             {
-                ResourcePtr resource = _loadResourceFrom(filename, loader);
-                entry->m_resource_data = resource;
-                return !resource.isNull();
+                // Queued then waited for : a loading of the same entry
+                // already queued or running is shared, not done twice.
+                ResourceFuture future = _queueRequest(entry->getName(), filename, loader, 0, true);
+                return !_waitRequest(future).isNull();
             }
         }
 
@@ -255,12 +396,12 @@ namespace APro
         }
         else if (filename.isEmpty())
         {
-            aprodebug("Try to load entry '") << entry->getName() << "' without file."
+            aprodebug("Try to load entry '") << entry->getName() << "' without file.";
             return false;
         }
         else
         {
-            if(!entry->getResource().isNull())
+            if(entry->isLoaded())
             {
                 if(m_overwrite_loading)
                 {
@@ -285,72 +426,552 @@ namespace APro
 
             if(!loader.isNull())
             {
-                ResourcePtr resource = _loadResourceFrom(filename, loader);
-                entry->m_resource_data = resource;
-                return !resource.isNull();
+                ResourceFuture future = _queueRequest(entry->getName(), filename, loader, 0, true);
+                return !_waitRequest(future).isNull();
             }
         }
 
         return false;
     }
 
-    void ResourceManager::unloadResource(const String& name)
+    void ResourceManager::unloadResource(const String& name)
+    {
+        if(!name.isEmpty())
+        {
+            ResourceEntryPtr entry = getResourceEntry(name);
+            if(!entry)
+                return;
+
+            // Destructors should correctly be called in this
+            // instruction, so we have nothing else to do.
+            _setEntryResource(entry, ResourcePtr::Null, String(), ResourceLoaderPtr::Null);
+        }
+    }
+
+    void ResourceManager::unloadAllResource()
+    {
+        APRO_THREADSAFE_AUTOLOCK
+
+        for(size_t i = 0; i < m_resource_entries.size(); ++i)
+        {
+            m_resource_entries[i]->m_resource_data.nullize();
+            AProDelete(m_resource_entries[i]);
+        }
+
+        Array<ResourceEntry*>().swap(m_resource_entries);
+        m_resource_index.clear();
+        m_copy_counters.clear();
+        m_dependencies.clear();
+        m_dependents.clear();
+        m_memory_usage = 0;
+        m_clock_hand   = 0;
+    }
+
+    String ResourceManager::printResources() const
+    {
+        StringBuilder result;
+        result << "[ResourceManager] Resource's List :\n"
+               << "-----------------------------------\n";
+
+        // Begin AutoLock
+        {
+            APRO_THREADSAFE_AUTOLOCK
+
+            for(size_t i = 0; i < m_resource_entries.size(); ++i)
+                result << " - " << m_resource_entries[i]->getName() << "\n";
+        }
+        // End AutoLock
+
+        result << "-----------------------------------\n";
+        return result.toString();
+    }
+
+    void ResourceManager::overwriteOnLoading(bool _overwrite)
+    {
+        m_overwrite_loading = _overwrite;
+    }
+
+    bool ResourceManager::resourceEntryExists(const String& name) const
+    {
+        return _findEntry(name) != nullptr;
+    }
+
+    bool ResourceManager::resourceEntryExists(const Atom& name) const
+    {
+        return _findEntry(name.toString()) != nullptr;
+    }
+
+    void ResourceManager::setMemoryBudget(size_t budget)
+    {
+        APRO_THREADSAFE_AUTOLOCK
+
+        m_memory_budget = budget;
+        if(m_memory_budget && m_memory_usage > m_memory_budget)
+            _evict(m_memory_budget, nullptr);
+    }
+
+    size_t ResourceManager::getMemoryBudget() const
+    {
+        return m_memory_budget;
+    }
+
+    size_t ResourceManager::getMemoryUsage() const
+    {
+        APRO_THREADSAFE_AUTOLOCK
+        return m_memory_usage;
+    }
+
+    size_t ResourceManager::evictResources(size_t target)
+    {
+        APRO_THREADSAFE_AUTOLOCK
+        return _evict(target, nullptr);
+    }
+
+    ResourceFuture ResourceManager::loadResourceAsync(const String& name, const String& filename)
+    {
+        return loadResourceAsync(name, filename, ResourceLoaderPtr::Null, 0);
+    }
+
+    ResourceFuture ResourceManager::loadResourceAsync(const String& name, const String& filename, const ResourceLoaderPtr& loader, int priority)
+    {
+        return _queueRequest(name, filename, loader, priority, m_overwrite_loading);
+    }
+
+    ResourceFuture ResourceManager::_queueRequest(const String& name, const String& filename, const ResourceLoaderPtr& loader, int priority, bool force)
+    {
+        if(name.isEmpty() || filename.isEmpty())
+        {
+            aprodebug("Try to load file '") << filename << "' asynchronously without name or file.";
+            return ResourceFuture();
+        }
+
+        // Does nothing if they already run.
+        startLoadingThreads();
+
+        m_async_mutex.lock();
+        if(m_async_pending.contains(name))
+        {
+            // Already queued or loading : the future shares it.
+            ResourceRequest* pending = m_async_pending.get(name);
+            pending->retain();
+            m_async_mutex.unlock();
+            return ResourceFuture(pending);
+        }
+
+        ResourceRequest* request = AProNew(ResourceRequest);
+        request->name     = name;
+        request->filename = filename;
+        request->loader   = loader;
+        request->priority = priority;
+
+        if(!force)
+        {
+            // A stub is queued : it is loaded in the threads, not here.
+            // The resource is read without loading it, so an entry
+            // evicted meanwhile is queued too.
+            ResourceEntryPtr entry    = _findEntry(name);
+            ResourcePtr      resource = entry && entry->getState() == ResourceEntry::S_Ready ? _getEntryResource(entry) : ResourcePtr::Null;
+            if(!resource.isNull())
+            {
+                m_async_mutex.unlock();
+                request->complete(resource);
+                return ResourceFuture(request);
+            }
+        }
+
+        request->refs = 2;// The manager, and the future.
+        m_async_pending.put(name, request);
+
+        ResourceFuture future(request);
+
+        if(!m_async_running || m_async_stopping)
+        {
+            // No thread to serve it : loaded now.
+            m_async_mutex.unlock();
+            _executeRequest(request);
+            return future;
+        }
+
+        if(!m_async_last || m_async_last->priority >= priority)
+        {
+            if(m_async_last)
+                m_async_last->next = request;
+            else
+                m_async_first = request;
+            m_async_last = request;
+        }
+        else
+        {
+            // Goes before the first request of a lower priority.
+            ResourceRequest* prev = nullptr;
+            ResourceRequest* it   = m_async_first;
+            while(it->priority >= priority)
+            {
+                prev = it;
+                it   = it->next;
+            }
+
+            request->next = it;
+            if(prev)
+                prev->next = request;
+            else
+                m_async_first = request;
+        }
+
+        m_async_not_empty.signal();
+        m_async_mutex.unlock();
+        return future;
+    }
+
+    ResourcePtr ResourceManager::_waitRequest(const ResourceFuture& future)
+    {
+        ResourceRequest* request = future.m_request;
+        if(!request)
+            return ResourcePtr::Null;
+
+        // Loaded here rather than waiting behind the other requests.
+        m_async_mutex.lock();
+        bool queued = _unqueueRequest(request);
+        m_async_mutex.unlock();
+
+        if(queued)
+            _executeRequest(request);
+
+        return future.wait();
+    }
+
+    ResourcePreloaderPtr ResourceManager::preload(const ResourceManifest& manifest)
+    {
+        return ResourcePreloaderPtr(AProNew(ResourcePreloader, this, manifest));
+    }
+
+    ResourceEntryPtr ResourceManager::registerResource(const String& name, const String& filename, const String& loaderName)
+    {
+        if(name.isEmpty() || filename.isEmpty())
+        {
+            aprodebug("Try to register file '") << filename << "' without name or file.";
+            return nullptr;
+        }
+
+        ResourceLoaderPtr loader = loaderName.isEmpty() ? _findCorrectLoader(FileSystem::ExtractExtension(filename)) : getLoader(loaderName);
+        if(loader.isNull())
+        {
+            aprodebug("Can't find a loader for file '") << filename << "'.";
+            return nullptr;
+        }
+
+        APRO_THREADSAFE_AUTOLOCK
+
+        ResourceEntryPtr entry = createResourceEntry(name);
+        ResourceEntry::State state = entry->getState();
+        if(!m_overwrite_loading && (state == ResourceEntry::S_Ready || state == ResourceEntry::S_Stub))
+        {
+            aprodebug("Resource '") << name << "' already exists : not registered again.";
+            return entry;
+        }
+
+        m_memory_usage -= entry->m_memory_size;
+
+        entry->m_resource_data.nullize();
+        entry->m_filename    = filename;
+        entry->m_loader      = loader;
+        entry->m_memory_size = 0;
+        entry->m_referenced  = false;
+        entry->m_evicted     = false;
+        entry->m_state       = ResourceEntry::S_Stub;
+
+        return entry;
+    }
+
+    size_t ResourceManager::registerResources(const ResourceManifest& manifest)
+    {
+        size_t count = 0;
+        for(size_t i = 0; i < manifest.size(); ++i)
+        {
+            const ResourceManifest::Item& item = manifest.at(i);
+            if(registerResource(item.name, item.filename, item.loader))
+                count++;
+        }
+
+        return count;
+    }
+
+    ResourceFuture ResourceManager::prefetch(const String& name, int priority)
+    {
+        String            filename;
+        ResourceLoaderPtr loader;
+
+        {
+            APRO_THREADSAFE_AUTOLOCK
+
+            ResourceEntryPtr entry = _findEntry(name);
+            if(!entry || entry->m_filename.isEmpty())
+            {
+                aprodebug("Can't prefetch resource '") << name << "' : it is not registered.";
+                return ResourceFuture();
+            }
+
+            filename = entry->m_filename;
+            loader   = entry->m_loader;
+        }
+
+        // A ready entry gives a ready future.
+        return _queueRequest(name, filename, loader, priority, false);
+    }
+
+    ResourceManager::ResourceEntry::State ResourceManager::getResourceState(const String& name) const
+    {
+        // The state is read without the lock : only the lookup takes
+        // it.
+        ResourceEntryPtr entry = _findEntry(name);
+        return entry ? entry->getState() : ResourceEntry::S_Empty;
+    }
+
+    ResourceFuture ResourceManager::loadResourceTree(const String& name, const String& filename, int priority)
+    {
+        if(name.isEmpty() || filename.isEmpty())
+        {
+            aprodebug("Try to load file '") << filename << "' with its dependencies without name or file.";
+            return ResourceFuture();
+        }
+
+        QuickMap<String, bool> forced;
+        if(m_overwrite_loading)
+            forced.put(name, true);
+
+        ResourceGraphLoad* graph = AProNew(ResourceGraphLoad, this, priority);
+        _addGraphNode(*graph, name, filename, ResourceLoaderPtr::Null, forced);
+        return graph->start();
+    }
+
+    ResourceFuture ResourceManager::reloadResource(const String& name)
+    {
+        String            filename;
+        ResourceLoaderPtr loader;
+        QuickMap<String, bool> affected;
+        Array<String>          order;
+
+        {
+            APRO_THREADSAFE_AUTOLOCK
+
+            ResourceEntryPtr entry = _findEntry(name);
+            if(entry)
+            {
+                filename = entry->m_filename;
+                loader   = entry->m_loader;
+            }
+
+            if(filename.isEmpty())
+            {
+                aprodebug("Can't reload resource '") << name << "' : it was not loaded from a file.";
+                return ResourceFuture();
+            }
+
+            // Every resource depending on it, even indirectly.
+            affected.put(name, true);
+            order.append(name);
+            for(size_t i = 0; i < order.size(); ++i)
+            {
+                const Array<String>* dependents = m_dependents.find(order[i]);
+                if(!dependents)
+                    continue;
+
+                for(size_t j = 0; j < dependents->size(); ++j)
+                {
+                    if(!affected.contains(dependents->at(j)))
+                    {
+                        affected.put(dependents->at(j), true);
+                        order.append(dependents->at(j));
+                    }
+                }
+            }
+        }
+
+        ResourceGraphLoad* graph = AProNew(ResourceGraphLoad, this, 0);
+        _addGraphNode(*graph, name, filename, loader, affected);
+
+        for(size_t i = 1; i < order.size(); ++i)
+        {
+            String            dependentFile;
+            ResourceLoaderPtr dependentLoader;
+
+            {
+                APRO_THREADSAFE_AUTOLOCK
+
+                ResourceEntryPtr entry = _findEntry(order[i]);
+                if(entry)
+                {
+                    dependentFile   = entry->m_filename;
+                    dependentLoader = entry->m_loader;
+                }
+            }
+
+            if(!dependentFile.isEmpty())
+                _addGraphNode(*graph, order[i], dependentFile, dependentLoader, affected);
+        }
+
+        return graph->start();
+    }
+
+    size_t ResourceManager::reloadFile(const String& filename)
+    {
+        Array<String> names;
+
+        {
+            APRO_THREADSAFE_AUTOLOCK
+
+            for(size_t i = 0; i < m_resource_entries.size(); ++i)
+                if(m_resource_entries[i]->m_filename == filename)
+                    names.append(m_resource_entries[i]->getName());
+        }
+
+        for(size_t i = 0; i < names.size(); ++i)
+            reloadResource(names[i]);
+
+        return names.size();
+    }
+
+    Array<String> ResourceManager::getDependencies(const String& name) const
+    {
+        APRO_THREADSAFE_AUTOLOCK
+
+        const Array<String>* dependencies = m_dependencies.find(name);
+        return dependencies ? *dependencies : Array<String>();
+    }
+
+    Array<String> ResourceManager::getDependents(const String& name) const
+    {
+        APRO_THREADSAFE_AUTOLOCK
+
+        const Array<String>* dependents = m_dependents.find(name);
+        return dependents ? *dependents : Array<String>();
+    }
+
+    bool ResourceManager::startLoadingThreads(size_t threads)
+    {
+#ifdef _COMPILE_WITH_PTHREAD_
+        m_async_mutex.lock();
+        if(m_async_running)
+        {
+            m_async_mutex.unlock();
+            return false;
+        }
+
+        m_async_threads.reserve(threads ? threads : 1);
+        for(size_t i = 0; i < (threads ? threads : 1); ++i)
+            m_async_threads.append(AProNew(ResourceLoadingThread, this));
+
+        for(size_t i = 0; i < m_async_threads.size(); ++i)
+            m_async_threads[i]->start();
+
+        m_async_running = true;
+        m_async_mutex.unlock();
+        return true;
+#else
+        return false;
+#endif // _COMPILE_WITH_PTHREAD_
+    }
+
+    void ResourceManager::stopLoadingThreads()
     {
-        if(!name.isEmpty())
+        m_async_mutex.lock();
+        if(!m_async_running || m_async_stopping)
         {
-            ResourceEntryPtr entry = getResourceEntry(name);
-
-            APRO_THREADSAFE_AUTOLOCK
-            entry->m_resource_data.nullize();
-            // Destructors should correctly be called in this
-            // instruction, so we have nothing else to do.
+            m_async_mutex.unlock();
+            return;
         }
-    }
 
-    void ResourceManager::unloadAllResource()
-    {
-        APRO_THREADSAFE_AUTOLOCK
+        m_async_stopping = true;
+        m_async_not_empty.signalAll();
+        m_async_mutex.unlock();
 
-        ResourceEntryPtr entry = &(m_resource_entries.at(0));
-        uint32_t idx = 0;
-        while(m_resource_entries.size() > idx)
+        for(size_t i = 0; i < m_async_threads.size(); ++i)
         {
-            entry->m_resource_data.nullize();
-            idx++;
-            
-            entry = &(m_resource_entries.at(idx));
-        }
-        m_resource_entries.clear();
+            m_async_threads[i]->join();
+            AProDelete(m_async_threads[i]);
+        }
+        Array<Thread*>().swap(m_async_threads);
+
+        m_async_mutex.lock();
+        m_async_running  = false;
+        m_async_stopping = false;
+        m_async_mutex.unlock();
     }
 
-    String ResourceManager::printResources() const
+    ResourceRequest* ResourceManager::_takeRequest()
     {
-        String result;
-        result << "[ResourceManager] Resource's List :\n"
-               << "-----------------------------------\n";
+        m_async_mutex.lock();
+        while(!m_async_first && !m_async_stopping)
+            m_async_not_empty.wait(&m_async_mutex);
 
-        // Begin AutoLock
+        ResourceRequest* request = m_async_first;
+        if(request)
         {
-            APRO_THREADSAFE_AUTOLOCK
-
-            List<ResourceEntry>::const_iterator e = m_resource_entries.end();
-            for(List<ResourceEntry>::iterator it = m_resource_entries.begin(); it != e; it++)
-                result << " - " << (*it).getName() << "\n";
+            m_async_first = request->next;
+            if(!m_async_first)
+                m_async_last = nullptr;
+            request->next = nullptr;
         }
-        // End AutoLock
 
-        result << "-----------------------------------\n";
-        return result;
+        m_async_mutex.unlock();
+        return request;
     }
 
-    void ResourceManager::overwriteOnLoading(bool _overwrite)
+    bool ResourceManager::_unqueueRequest(ResourceRequest* request)
     {
-        m_overwrite_loading = _overwrite;
+        ResourceRequest* prev = nullptr;
+        ResourceRequest* it   = m_async_first;
+        while(it && it != request)
+        {
+            prev = it;
+            it   = it->next;
+        }
+
+        if(!it)
+            return false;
+
+        if(prev)
+            prev->next = request->next;
+        else
+            m_async_first = request->next;
+
+        if(m_async_last == request)
+            m_async_last = prev;
+
+        request->next = nullptr;
+        return true;
     }
 
-    bool ResourceManager::resourceEntryExists(const String& name) const
+    void ResourceManager::_executeRequest(ResourceRequest* request)
     {
-        return getResourceEntry(name) != nullptr;
+        ResourceLoaderPtr loader = request->loader;
+        if(loader.isNull())
+            loader = _findCorrectLoader(FileSystem::ExtractExtension(request->filename));
+
+        ResourcePtr resource = nullptr;
+        if(!loader.isNull())
+            resource = _loadResourceFrom(request->filename, loader);
+        else
+            aprodebug("Can't find a loader for file '") << request->filename << "'.";
+
+        // The entry receives the resource only once it is fully
+        // loaded, so other threads never see a partial resource.
+        {
+            APRO_THREADSAFE_AUTOLOCK
+
+            ResourceEntryPtr entry = createResourceEntry(request->name);
+            if(entry)
+                _setEntryResource(entry, resource, request->filename, loader);
+        }
+
+        // Removed before completion : a later call finds the entry
+        // already loaded.
+        m_async_mutex.lock();
+        m_async_pending.remove(request->name);
+        m_async_mutex.unlock();
+
+        request->complete(resource);
+        request->release();
     }
 
     ResourceLoaderPtr ResourceManager::getLoader(const String& name)
@@ -359,14 +980,10 @@ namespace APro
         {
             APRO_THREADSAFE_AUTOLOCK
 
-            List<AutoPointer<ResourceLoader> >::const_iterator e = m_loaders.end();
-            for(List<AutoPointer<ResourceLoader> >::iterator it = m_loaders.begin(); it != e; it++)
-            {
-                if((*it)->getName() == name)
-                    return (*it);
-            }
+            const IndexedLoader* loader = m_loader_index.find(name);
+            if(loader)
+                return loader->object;
 
-            // We reach this point only if loader is not found.
             aprodebug("Can't find loader '") << name << "'.";
         }
 
@@ -379,14 +996,10 @@ namespace APro
         {
             APRO_THREADSAFE_AUTOLOCK
 
-            List<AutoPointer<ResourceLoader> >::const_iterator e = m_loaders.end();
-            for(List<AutoPointer<ResourceLoader> >::const_iterator it = m_loaders.begin(); it != e; it++)
-            {
-                if((*it)->getName() == name)
-                    return (*it);
-            }
+            const IndexedLoader* loader = m_loader_index.find(name);
+            if(loader)
+                return loader->object;
 
-            // We reach this point only if loader is not found.
             aprodebug("Can't find loader '") << name << "'.";
         }
 
@@ -400,7 +1013,11 @@ namespace APro
             if(getLoader(loader->getName()).isNull())
             {
                 APRO_THREADSAFE_AUTOLOCK
+                IndexedLoader indexed;
+                indexed.object   = loader;
+                indexed.position = m_loaders.size();
                 m_loaders.push_back(loader);
+                m_loader_index.put(loader->getName(), indexed);
                 return true;
             }
             else
@@ -419,14 +1036,14 @@ namespace APro
 
         APRO_THREADSAFE_AUTOLOCK
 
-        int i = m_loaders.find(loader);
-        if(i < 0)
+        const IndexedLoader* indexed = m_loader_index.find(loader->getName());
+        if(!indexed || indexed->object.getPointer() != loader.getPointer())
         {
             aprodebug("Can't find loader '") << loader->getName() << "'.";
             return false;
         }
 
-        m_loaders.erase(m_loaders.begin() + i);
+        _eraseLoader(indexed->position);
         return true;
     }
 
@@ -434,11 +1051,12 @@ namespace APro
     {
         if(!loader_name.isEmpty())
         {
+            APRO_THREADSAFE_AUTOLOCK
+
             int index = _getLoaderIndex(loader_name);
             if(index >= 0)
             {
-                APRO_THREADSAFE_AUTOLOCK
-                m_loaders.erase(m_loaders.begin() + index);
+                _eraseLoader((size_t) index);
                 return true;
             }
             else
@@ -462,7 +1080,7 @@ namespace APro
 
             List<AutoPointer<ResourceLoader> >::const_iterator e = m_loaders.end();
             for(List<AutoPointer<ResourceLoader> >::iterator it = m_loaders.begin(); it != e; it++)
-                result << " - " << (*it).getName() << "\n";
+                result << " - " << (*it)->getName() << "\n";
         }
         // End AutoLock
 
@@ -486,7 +1104,7 @@ namespace APro
     {
         APRO_THREADSAFE_AUTOLOCK
         if(m_default_loaders.keyExists(ext))
-            return m_default_loaders[ext];
+            return getLoader(m_default_loaders[ext]);
         else
             return ResourceLoaderPtr::Null;
     }
@@ -497,14 +1115,10 @@ namespace APro
         {
             APRO_THREADSAFE_AUTOLOCK
 
-            List<AutoPointer<ResourceWriter> >::const_iterator e = m_writers.end();
-            for(List<AutoPointer<ResourceWriter> >::iterator it = m_writers.begin(); it != e; it++)
-            {
-                if((*it)->getName() == name)
-                    return (*it);
-            }
+            const IndexedWriter* writer = m_writer_index.find(name);
+            if(writer)
+                return writer->object;
 
-            // We reach this point only if writer is not found.
             aprodebug("Can't find writer '") << name << "'.";
         }
 
@@ -517,14 +1131,10 @@ namespace APro
         {
             APRO_THREADSAFE_AUTOLOCK
 
-            List<AutoPointer<ResourceWriter> >::const_iterator e = m_writers.end();
-            for(List<AutoPointer<ResourceWriter> >::const_iterator it = m_writers.begin(); it != e; it++)
-            {
-                if((*it)->getName() == name)
-                    return (*it);
-            }
+            const IndexedWriter* writer = m_writer_index.find(name);
+            if(writer)
+                return writer->object;
 
-            // We reach this point only if writer is not found.
             aprodebug("Can't find writer '") << name << "'.";
         }
 
@@ -538,7 +1148,11 @@ namespace APro
             if(getWriter(writer->getName()).isNull())
             {
                 APRO_THREADSAFE_AUTOLOCK
+                IndexedWriter indexed;
+                indexed.object   = writer;
+                indexed.position = m_writers.size();
                 m_writers.push_back(writer);
+                m_writer_index.put(writer->getName(), indexed);
                 return true;
             }
             else
@@ -550,21 +1164,21 @@ namespace APro
         return false;
     }
 
-    bool ResourceManager::removeWriter(const ResourceLoaderPtr& writer)
+    bool ResourceManager::removeWriter(const ResourceWriterPtr& writer)
     {
         if(writer.isNull())
             return false;
 
         APRO_THREADSAFE_AUTOLOCK
 
-        int i = m_writers.find(writer);
-        if(i < 0)
+        const IndexedWriter* indexed = m_writer_index.find(writer->getName());
+        if(!indexed || indexed->object.getPointer() != writer.getPointer())
         {
             aprodebug("Can't find writer '") << writer->getName() << "'.";
             return false;
         }
 
-        m_writers.erase(m_writers.begin() + i);
+        _eraseWriter(indexed->position);
         return true;
     }
 
@@ -572,11 +1186,12 @@ namespace APro
     {
         if(!writer_name.isEmpty())
         {
+            APRO_THREADSAFE_AUTOLOCK
+
             int index = _getWriterIndex(writer_name);
             if(index >= 0)
             {
-                APRO_THREADSAFE_AUTOLOCK
-                m_writers.erase(m_writers.begin() + index);
+                _eraseWriter((size_t) index);
                 return true;
             }
             else
@@ -600,7 +1215,7 @@ namespace APro
 
             List<AutoPointer<ResourceWriter> >::const_iterator e = m_writers.end();
             for(List<AutoPointer<ResourceWriter> >::iterator it = m_writers.begin(); it != e; it++)
-                result << " - " << (*it).getName() << "\n";
+                result << " - " << (*it)->getName() << "\n";
         }
         // End AutoLock
 
@@ -613,21 +1228,25 @@ namespace APro
         if(!resource_name.isEmpty())
         {
             ResourceEntryPtr res = getResourceEntry(resource_name);
-            if(!res || res->getResource().isNull())
+            ResourcePtr resource = res ? res->getResource() : ResourcePtr::Null;
+            if(resource.isNull())
             {
                 aprodebug("Can't write empty resource '") << resource_name << "'.";
                 return false;
             }
 
             ResourceWriterPtr writer = getWriter(writer_name);
-            if(writer.isNull() || !writer->isCompatible(res->getResource()))
+            if(writer.isNull() || !writer->isCompatible(resource))
             {
                 aprodebug("Can't write with writer '") << writer_name << "'.";
                 return false;
             }
 
-            return writer->write(res->getResource(), filename);
+            writer->write(resource, filename);
+            return true;
         }
+
+        return false;
     }
 
     void ResourceManager::setDefaultWriter(const String& ext, const String& writer)
@@ -646,11 +1265,86 @@ namespace APro
     {
         APRO_THREADSAFE_AUTOLOCK
         if(m_default_writers.keyExists(ext))
-            return m_default_writers[ext];
+            return getWriter(m_default_writers[ext]);
         else
             return ResourceWriterPtr::Null;
     }
 
+    bool ResourceManager::mountPack(const String& filename)
+    {
+        if(isPackMounted(filename))
+        {
+            aprodebug("Pack '") << filename << "' is already mounted.";
+            return false;
+        }
+
+        ResourcePack* pack = AProNew(ResourcePack);
+        if(!pack->open(filename))
+        {
+            AProDelete(pack);
+            return false;
+        }
+
+        APRO_THREADSAFE_AUTOLOCK
+        m_packs.append(pack);
+        return true;
+    }
+
+    bool ResourceManager::unmountPack(const String& filename)
+    {
+        APRO_THREADSAFE_AUTOLOCK
+
+        ResourcePack* found = nullptr;
+        Array<ResourcePack*> packs;
+        for(size_t i = 0; i < m_packs.size(); ++i)
+        {
+            if(!found && m_packs[i]->getFilename() == filename)
+                found = m_packs[i];
+            else
+                packs.append(m_packs[i]);
+        }
+
+        if(!found)
+        {
+            aprodebug("Pack '") << filename << "' is not mounted.";
+            return false;
+        }
+
+        m_packs.swap(packs);
+        AProDelete(found);
+        return true;
+    }
+
+    bool ResourceManager::isPackMounted(const String& filename) const
+    {
+        APRO_THREADSAFE_AUTOLOCK
+
+        for(size_t i = 0; i < m_packs.size(); ++i)
+            if(m_packs[i]->getFilename() == filename)
+                return true;
+        return false;
+    }
+
+    MemoryStream* ResourceManager::openPackedFile(const String& filename) const
+    {
+        APRO_THREADSAFE_AUTOLOCK
+
+        if(m_packs.isEmpty())
+            return nullptr;
+
+        String name = ResourcePack::NormalizeName(StringView(filename.toCstChar(), filename.size()));
+        StringView view(name.toCstChar(), name.size());
+
+        // Last mounted packs hide the first ones.
+        for(size_t i = m_packs.size(); i > 0; --i)
+        {
+            if(m_packs[i - 1]->contains(view))
+                return m_packs[i - 1]->openStream(view);
+        }
+
+        return nullptr;
+    }
+
     ResourceLoaderPtr ResourceManager::_findCorrectLoader(const String& extension)
     {
         if(!extension.isEmpty())
@@ -668,7 +1362,30 @@ namespace APro
 
     ResourcePtr ResourceManager::_loadResourceFrom(const String& filename, ResourceLoaderPtr& loader)
     {
-        return loader->loadResource(filename);
+        // Opened first : openPackedFile() takes the manager lock, which
+        // must never be waited for with the loader locked.
+        MemoryStream* stream = loader->canLoadFromStream() ? openPackedFile(filename) : nullptr;
+
+        // Loading threads may use the same loader at once.
+        bool serialized = !loader->isThreadSafe();
+        if(serialized)
+            loader->getLoadingMutex().lock();
+
+        ResourcePtr resource = nullptr;
+        if(stream)
+        {
+            resource = loader->loadResourceFromStream(filename, *stream);
+            AProDelete(stream);
+        }
+        else
+        {
+            resource = loader->loadResource(filename);
+        }
+
+        if(serialized)
+            loader->getLoadingMutex().unlock();
+
+        return resource;
     }
 
     int ResourceManager::_getLoaderIndex(const String& name) const
@@ -677,13 +1394,9 @@ namespace APro
         {
             APRO_THREADSAFE_AUTOLOCK
 
-            int i = 0;
-            List<AutoPointer<ResourceLoader> >::const_iterator e = m_loaders.end();
-            for(List<AutoPointer<ResourceLoader> >::const_iterator it = m_loaders.begin(); it != e; it++, ++i)
-            {
-                if((*it)->getName() == name)
-                    return i;
-            }
+            const IndexedLoader* loader = m_loader_index.find(name);
+            if(loader)
+                return (int) loader->position;
 
             // We reach this point only if loader is not found.
 //          aprodebug("Can't find loader '") << name << "'.";
@@ -698,13 +1411,9 @@ namespace APro
         {
             APRO_THREADSAFE_AUTOLOCK
 
-            int i = 0;
-            List<AutoPointer<ResourceWriter> >::const_iterator e = m_writers.end();
-            for(List<AutoPointer<ResourceWriter> >::const_iterator it = m_writers.begin(); it != e; it++, ++i)
-            {
-                if((*it)->getName() == name)
-                    return i;
-            }
+            const IndexedWriter* writer = m_writer_index.find(name);
+            if(writer)
+                return (int) writer->position;
 
             // We reach this point only if writer is not found.
 //          aprodebug("Can't find writer '") << name << "'.";
@@ -713,12 +1422,309 @@ namespace APro
         return -1;
     }
 
+    void ResourceManager::_eraseLoader(size_t position)
+    {
+        List<AutoPointer<ResourceLoader> >::iterator it = m_loaders.begin() + position;
+        m_loader_index.remove((*it)->getName());
+        m_loaders.erase(it);
+
+        // The following loaders move down by one.
+        List<AutoPointer<ResourceLoader> >::const_iterator e = m_loaders.end();
+        for(it = m_loaders.begin() + position; it != e; it++)
+        {
+            IndexedLoader* indexed = m_loader_index.find((*it)->getName());
+            if(indexed)
+                indexed->position--;
+        }
+    }
+
+    void ResourceManager::_eraseWriter(size_t position)
+    {
+        List<AutoPointer<ResourceWriter> >::iterator it = m_writers.begin() + position;
+        m_writer_index.remove((*it)->getName());
+        m_writers.erase(it);
+
+        // The following writers move down by one.
+        List<AutoPointer<ResourceWriter> >::const_iterator e = m_writers.end();
+        for(it = m_writers.begin() + position; it != e; it++)
+        {
+            IndexedWriter* indexed = m_writer_index.find((*it)->getName());
+            if(indexed)
+                indexed->position--;
+        }
+    }
+
+    ResourceEntryPtr ResourceManager::_findEntry(const String& name) const
+    {
+        APRO_THREADSAFE_AUTOLOCK
+
+        ResourceEntry* const* entry = m_resource_index.find(name);
+        return entry ? *entry : nullptr;
+    }
+
+    size_t ResourceManager::_addGraphNode(ResourceGraphLoad& graph, const String& name, const String& filename, const ResourceLoaderPtr& loader,
+                                          const QuickMap<String, bool>& forced)
+    {
+        const size_t* known = graph.indices.find(name);
+        if(known)
+            return *known;
+
+        size_t index = graph.nodes.size();
+
+        ResourceGraphLoad::Node node;
+        node.name     = name;
+        node.filename = filename;
+        node.loader   = loader;
+        node.waiting  = 0;
+        node.force    = forced.contains(name);
+        graph.nodes.append(node);
+        graph.indices.put(name, index);
+        graph.visiting.put(name, true);
+
+        // The loader reads the file without the lock : it may take
+        // some time.
+        ResourceLoaderPtr fileLoader = loader;
+        if(fileLoader.isNull())
+            fileLoader = _findCorrectLoader(FileSystem::ExtractExtension(filename));
+
+        Array<String> files;
+        if(!fileLoader.isNull())
+        {
+            // The loading threads may use the same loader at once.
+            bool serialized = !fileLoader->isThreadSafe();
+            if(serialized)
+                fileLoader->getLoadingMutex().lock();
+
+            fileLoader->getDependencies(filename, files);
+
+            if(serialized)
+                fileLoader->getLoadingMutex().unlock();
+        }
+
+        for(size_t i = 0; i < files.size(); ++i)
+        {
+            const String& dependency = files[i];
+
+            if(graph.visiting.contains(dependency))
+            {
+                aprodebug("Cyclic dependency between '") << name << "' and '" << dependency << "' : ignored.";
+                continue;
+            }
+
+            String            dependencyFile   = dependency;
+            ResourceLoaderPtr dependencyLoader = ResourceLoaderPtr::Null;
+            bool              loaded           = false;
+
+            {
+                APRO_THREADSAFE_AUTOLOCK
+
+                ResourceEntryPtr entry = _findEntry(dependency);
+                if(entry)
+                {
+                    if(!entry->m_filename.isEmpty())
+                    {
+                        dependencyFile   = entry->m_filename;
+                        dependencyLoader = entry->m_loader;
+                    }
+
+                    loaded = entry->isLoaded();
+                }
+            }
+
+            // Loaded dependencies are shared as they are.
+            if(loaded && !forced.contains(dependency) && !graph.indices.contains(dependency))
+                continue;
+
+            size_t dependencyIndex = _addGraphNode(graph, dependency, dependencyFile, dependencyLoader, forced);
+            graph.nodes[dependencyIndex].dependents.append(index);
+            graph.nodes[index].waiting++;
+        }
+
+        graph.visiting.remove(name);
+        _setDependencies(name, files);
+        return index;
+    }
+
+    void ResourceManager::_setDependencies(const String& name, const Array<String>& dependencies)
+    {
+        APRO_THREADSAFE_AUTOLOCK
+
+        const Array<String>* old = m_dependencies.find(name);
+        if(old)
+        {
+            for(size_t i = 0; i < old->size(); ++i)
+            {
+                Array<String>* dependents = m_dependents.find(old->at(i));
+                if(!dependents)
+                    continue;
+
+                for(size_t j = 0; j < dependents->size(); ++j)
+                {
+                    if(dependents->at(j) == name)
+                    {
+                        dependents->erase(dependents->begin() + j);
+                        break;
+                    }
+                }
+            }
+        }
+
+        for(size_t i = 0; i < dependencies.size(); ++i)
+        {
+            if(!m_dependents.contains(dependencies[i]))
+                m_dependents.put(dependencies[i], Array<String>());
+
+            m_dependents.find(dependencies[i])->append(name);
+        }
+
+        m_dependencies.put(name, dependencies);
+    }
+
+    void ResourceManager::_setEntryResource(ResourceEntryPtr entry, const ResourcePtr& resource, const String& filename, const ResourceLoaderPtr& loader)
+    {
+        APRO_THREADSAFE_AUTOLOCK
+
+        m_memory_usage -= entry->m_memory_size;
+
+        entry->m_resource_data = resource;
+        entry->m_filename      = filename;
+        entry->m_loader        = loader;
+        entry->m_memory_size   = resource.isNull() ? 0 : resource->getMemorySize();
+        entry->m_referenced    = true;
+        entry->m_evicted       = false;
+
+        if(!resource.isNull())
+            entry->m_state = ResourceEntry::S_Ready;
+        else
+            entry->m_state = filename.isEmpty() ? ResourceEntry::S_Empty : ResourceEntry::S_Failed;
+
+        m_memory_usage += entry->m_memory_size;
+
+        if(m_memory_budget && m_memory_usage > m_memory_budget)
+            _evict(m_memory_budget, entry);
+    }
+
+    ResourcePtr ResourceManager::_useEntry(ResourceEntryPtr entry)
+    {
+        String            filename;
+        ResourceLoaderPtr loader;
+
+        {
+            APRO_THREADSAFE_AUTOLOCK
+
+            entry->m_referenced = true;
+            if(entry->getState() != ResourceEntry::S_Stub)
+                return entry->m_resource_data;
+
+            filename = entry->m_filename;
+            loader   = entry->m_loader;
+        }
+
+        // Loaded without the lock, as a request : a prefetch of the
+        // entry is shared instead of loading it twice, and is loaded
+        // now if no loading thread took it yet.
+        ResourceFuture future   = _queueRequest(entry->getName(), filename, loader, 0, false);
+        ResourcePtr    resource = _waitRequest(future);
+        if(resource.isNull())
+            aprodebug("Can't load resource '") << entry->getName() << "' from file '" << filename << "'.";
+
+        return resource;
+    }
+
+    ResourcePtr ResourceManager::_getEntryResource(const ResourceEntry* entry) const
+    {
+        APRO_THREADSAFE_AUTOLOCK
+        return entry->m_resource_data;
+    }
+
+    size_t ResourceManager::_evict(size_t target, const ResourceEntry* keep)
+    {
+        size_t freed = 0;
+        size_t count = m_resource_entries.size();
+
+        // Two turns of the clock : the first one may only clear the
+        // referenced bits.
+        for(size_t step = 0; step < 2 * count && m_memory_usage > target; ++step)
+        {
+            if(m_clock_hand >= count)
+                m_clock_hand = 0;
+
+            ResourceEntry* entry = m_resource_entries[m_clock_hand++];
+            if(entry == keep || entry->m_resource_data.isNull() || entry->m_loader.isNull())
+                continue;
+
+            // Someone else holds the resource : evicting it would
+            // free nothing.
+            if(entry->m_resource_data.getPointerUses() > 1)
+                continue;
+
+            if(entry->m_referenced)
+            {
+                entry->m_referenced = false;
+                continue;
+            }
+
+            freed                += entry->m_memory_size;
+            m_memory_usage       -= entry->m_memory_size;
+            entry->m_memory_size  = 0;
+            entry->m_evicted      = true;
+            entry->m_state        = ResourceEntry::S_Stub;
+            entry->m_resource_data.nullize();
+        }
+
+        if(m_memory_usage > target)
+            aprodebug("Resources use ") << (uint32_t) m_memory_usage << " bytes, but every resource is in use.";
+
+        return freed;
+    }
+
+    ResourcePtr ResourceManager::ResourceEntry::getResource()
+    {
+        if(m_manager)
+            return m_manager->_useEntry(this);
+
+        return m_resource_data;
+    }
+
+    ResourcePtr ResourceManager::ResourceEntry::getResource() const
+    {
+        if(m_manager)
+            return m_manager->_getEntryResource(this);
+
+        return m_resource_data;
+    }
+
     bool ResourceManager::ResourceNCG::isNameUsed(const String& name) const
     {
         if(rm)
-            return rm->getResource(_cpyname) != nullptr;
+            return rm->_findEntry(name) != nullptr;
         else
             return false;
     }
 
+    int ResourceManager::ResourceNCG::getFirstCopy(const String& name)
+    {
+        if(rm)
+        {
+            // The counters are the manager's : they are read under its lock.
+            THREADMUTEXAUTOLOCK(rm->getMutexTyped());
+
+            // Numbers up to the last one generated are already taken.
+            const int* last = rm->m_copy_counters.find(name);
+            if(last)
+                return *last + 1;
+        }
+
+        return 1;
+    }
+
+    void ResourceManager::ResourceNCG::onCopyGenerated(const String& name, int copy)
+    {
+        if(rm)
+        {
+            THREADMUTEXAUTOLOCK(rm->getMutexTyped());
+            rm->m_copy_counters.put(name, copy);
+        }
+    }
+
 }
@@ -0,0 +1,144 @@
+/////////////////////////////////////////////////////////////
+/** @file ResourceManifest.cpp
+ *  @ingroup Core
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the ResourceManifest class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "ResourceManifest.h"
+#include "File.h"
+#include "FileStream.h"
+#include "BinaryStream.h"
+#include "Console.h"
+
+namespace APro
+{
+    void ResourceManifest::add(const String& name, const String& filename, const String& loader, int priority)
+    {
+        Item item;
+        item.name     = name;
+        item.filename = filename;
+        item.loader   = loader;
+        item.priority = priority;
+        m_items.append(item);
+    }
+
+    bool ResourceManifest::add(const Dictionnary& item)
+    {
+        if(!item.keyExists("name") || !item["name"].isCompatible<String>() ||
+           !item.keyExists("file") || !item["file"].isCompatible<String>())
+        {
+            aprodebug("Manifest item has no name or file.");
+            return false;
+        }
+
+        String loader;
+        if(item.keyExists("loader") && item["loader"].isCompatible<String>())
+            loader = item["loader"].cast<String>();
+
+        int priority = 0;
+        if(item.keyExists("priority") && item["priority"].isCompatible<int>())
+            priority = item["priority"].cast<int>();
+
+        add(item["name"].cast<String>(), item["file"].cast<String>(), loader, priority);
+        return true;
+    }
+
+    void ResourceManifest::clear()
+    {
+        Array<Item>().swap(m_items);
+    }
+
+    bool ResourceManifest::loadFile(const String& filename)
+    {
+        File file(filename, "rb");
+        if(!file.isOpened())
+        {
+            aprodebug("Can't open manifest '") << filename << "'.";
+            return false;
+        }
+
+        FileStream        fstream(file);
+        BinaryInputStream stream(fstream);
+
+        uint32_t version;
+        if(!stream.readHeader(Tag, version))
+        {
+            aprodebug("'") << filename << "' is not a manifest.";
+            return false;
+        }
+
+        if(version > Version)
+        {
+            aprodebug("Manifest '") << filename << "' has unknown version " << (int) version << ".";
+            return false;
+        }
+
+        uint64_t count;
+        if(!stream.readVarUInt(count))
+            return false;
+
+        for(uint64_t i = 0; i < count; ++i)
+        {
+            Dictionnary item;
+            stream >> item;
+            if(!stream)
+            {
+                aprodebug("Manifest '") << filename << "' is truncated.";
+                return false;
+            }
+
+            add(item);
+        }
+
+        return true;
+    }
+
+    bool ResourceManifest::saveFile(const String& filename) const
+    {
+        File file(filename, "wb");
+        if(!file.isOpened())
+        {
+            aprodebug("Can't create manifest '") << filename << "'.";
+            return false;
+        }
+
+        FileStream         fstream(file);
+        BinaryOutputStream stream(fstream);
+
+        stream.writeHeader(Tag, Version);
+        stream.writeVarUInt(m_items.size());
+        for(size_t i = 0; i < m_items.size() && stream; ++i)
+        {
+            Dictionnary item;
+            item["name"]     = m_items[i].name;
+            item["file"]     = m_items[i].filename;
+            item["loader"]   = m_items[i].loader;
+            item["priority"] = m_items[i].priority;
+            stream << item;
+        }
+
+        return stream && fstream.flush();
+    }
+}
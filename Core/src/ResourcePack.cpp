@@ -0,0 +1,506 @@
+/////////////////////////////////////////////////////////////
+/** @file ResourcePack.cpp
+ *  @ingroup Core
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the ResourcePack and ResourcePackWriter classes.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "ResourcePack.h"
+#include "File.h"
+#include "FileSystem.h"
+#include "DirectoryScanner.h"
+#include "LZCodec.h"
+#include "CheckSumCRC32C.h"
+#include "Console.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace APro
+{
+    /// Returns true if the entry a goes before b in the table of
+    /// contents.
+    static bool EntryLess(const ResourcePack::Entry& a, const StringView& aname,
+                          const ResourcePack::Entry& b, const StringView& bname)
+    {
+        if(a.hash != b.hash)
+            return a.hash < b.hash;
+
+        int cmp = memcmp(aname.data(), bname.data(), std::min(aname.size(), bname.size()));
+        return cmp < 0 || (cmp == 0 && aname.size() < bname.size());
+    }
+
+    ResourcePack::ResourcePack()
+        : m_entries(nullptr), m_count(0), m_names(nullptr), m_verify(true)
+    {
+
+    }
+
+    ResourcePack::ResourcePack(const String& filename)
+        : m_entries(nullptr), m_count(0), m_names(nullptr), m_verify(true)
+    {
+        open(filename);
+    }
+
+    ResourcePack::~ResourcePack()
+    {
+        close();
+    }
+
+    bool ResourcePack::open(const String& filename)
+    {
+        close();
+
+        File file(filename, "rb");
+        if(!file.isOpened())
+        {
+            aprodebug("Can't open pack '") << filename << "'.";
+            return false;
+        }
+
+        // Entries are read in any order : no read-ahead.
+        FileMapping mapping = file.map(FileMapping::Random);
+        if(!mapping.isValid() || mapping.size() < sizeof(Header))
+        {
+            aprodebug("Can't map pack '") << filename << "'.";
+            return false;
+        }
+
+        const Header* header = (const Header*) mapping.data();
+        size_t        size   = mapping.size();
+
+        if(header->magic != Magic || header->version != Version)
+        {
+            aprodebug("File '") << filename << "' is not a pack, or has another version.";
+            return false;
+        }
+
+        if(header->toc_offset % sizeof(uint64_t) != 0 ||
+           header->toc_offset > size || (size - header->toc_offset) / sizeof(Entry) < header->count ||
+           header->names_offset > size || size - header->names_offset < header->names_size)
+        {
+            aprodebug("Pack '") << filename << "' is truncated.";
+            return false;
+        }
+
+        const Entry* entries = (const Entry*) (mapping.data() + header->toc_offset);
+        const char*  names   = (const char*) (mapping.data() + header->names_offset);
+
+        uint32_t crc = Crc32C((const Byte*) entries, header->count * sizeof(Entry));
+        crc = Crc32C((const Byte*) names, (size_t) header->names_size, crc);
+        if(crc != header->toc_crc)
+        {
+            aprodebug("Table of contents of pack '") << filename << "' is corrupted.";
+            return false;
+        }
+
+        for(uint32_t i = 0; i < header->count; ++i)
+        {
+            const Entry& entry = entries[i];
+            if(entry.offset > size || size - entry.offset < entry.size ||
+               entry.name_offset > header->names_size || header->names_size - entry.name_offset < entry.name_size)
+            {
+                aprodebug("Entry ") << (unsigned int) i << " of pack '" << filename << "' is out of the pack.";
+                return false;
+            }
+        }
+
+        m_mapping  = std::move(mapping);
+        m_filename = filename;
+        m_entries  = entries;
+        m_count    = header->count;
+        m_names    = names;
+        return true;
+    }
+
+    void ResourcePack::close()
+    {
+        m_mapping.unmap();
+        m_filename = String();
+        m_entries  = nullptr;
+        m_count    = 0;
+        m_names    = nullptr;
+    }
+
+    StringView ResourcePack::getName(const Entry& entry) const
+    {
+        return StringView(m_names + entry.name_offset, entry.name_size);
+    }
+
+    const ResourcePack::Entry* ResourcePack::find(const StringView& name) const
+    {
+        if(!m_count)
+            return nullptr;
+
+        // First entry with given hash.
+        uint64_t hash = Hash(name);
+        size_t   low = 0, high = m_count;
+        while(low < high)
+        {
+            size_t middle = low + (high - low) / 2;
+            if(m_entries[middle].hash < hash)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+
+        for(; low < m_count && m_entries[low].hash == hash; ++low)
+        {
+            if(getName(m_entries[low]) == name)
+                return &m_entries[low];
+        }
+
+        return nullptr;
+    }
+
+    StringView ResourcePack::getStoredBytes(const Entry& entry) const
+    {
+        return StringView((const char*) m_mapping.data() + entry.offset, (size_t) entry.size);
+    }
+
+    MemoryStream* ResourcePack::openStream(const StringView& name) const
+    {
+        const Entry* entry = find(name);
+        if(!entry)
+            return nullptr;
+
+        MemoryStream* stream = nullptr;
+        if(entry->method == M_Stored)
+        {
+            StringView bytes = getStoredBytes(*entry);
+            stream = AProNew(MemoryStream, (const Byte*) bytes.data(), bytes.size());
+        }
+        else
+        {
+            stream = decompress(*entry);
+        }
+
+        if(!stream)
+            return nullptr;
+
+        if(m_verify && Crc32C(stream->data(), stream->size()) != entry->crc)
+        {
+            aprodebug("Entry '") << String(name.data(), name.size()) << "' of pack '" << m_filename << "' is corrupted.";
+            AProDelete(stream);
+            return nullptr;
+        }
+
+        return stream;
+    }
+
+    MemoryStream* ResourcePack::decompress(const Entry& entry) const
+    {
+        if(entry.method != M_LZ)
+        {
+            aprodebug("Entry '") << String(getName(entry).data(), entry.name_size) << "' of pack '" << m_filename
+                                 << "' uses unknown method " << (unsigned int) entry.method << ".";
+            return nullptr;
+        }
+
+        MemoryStream* stream = AProNew(MemoryStream, (size_t) entry.original_size);
+        Byte*         data   = stream->writeInPlace((size_t) entry.original_size);
+        StringView    bytes  = getStoredBytes(entry);
+
+        size_t written = 0;
+        if(!data || !LZCodec::Decompress((const Byte*) bytes.data(), bytes.size(), data, (size_t) entry.original_size, written) ||
+           written != entry.original_size)
+        {
+            aprodebug("Entry '") << String(getName(entry).data(), entry.name_size) << "' of pack '" << m_filename << "' is corrupted.";
+            AProDelete(stream);
+            return nullptr;
+        }
+
+        stream->seek(0);
+        return stream;
+    }
+
+    bool ResourcePack::verify(const Entry& entry) const
+    {
+        if(entry.method == M_Stored)
+        {
+            StringView bytes = getStoredBytes(entry);
+            return Crc32C((const Byte*) bytes.data(), bytes.size()) == entry.crc;
+        }
+
+        MemoryStream* stream = decompress(entry);
+        if(!stream)
+            return false;
+
+        bool ret = Crc32C(stream->data(), stream->size()) == entry.crc;
+        AProDelete(stream);
+        return ret;
+    }
+
+    uint64_t ResourcePack::Hash(const StringView& name)
+    {
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        for(size_t i = 0; i < name.size(); ++i)
+        {
+            hash ^= (uint8_t) name[i];
+            hash *= 0x100000001b3ULL;
+        }
+        return hash;
+    }
+
+    uint32_t ResourcePack::Crc32C(const Byte* data, size_t sz, uint32_t crc)
+    {
+        return CheckSumCRC32C::Compute(data, sz, crc);
+    }
+
+    String ResourcePack::NormalizeName(const StringView& path)
+    {
+        String ret;
+        size_t i = 0;
+        while(i < path.size())
+        {
+            char c = path[i] == '\\' ? '/' : path[i];
+            bool at_component = ret.isEmpty() || ret[ret.size() - 1] == '/';
+
+            if(c == '/')
+            {
+                // Leading '/' and '//' are dropped.
+                if(!at_component)
+                    ret.append('/');
+                i++;
+            }
+            else if(c == '.' && at_component && (i + 1 == path.size() || path[i + 1] == '/' || path[i + 1] == '\\'))
+            {
+                // './' is nothing.
+                i += 2;
+            }
+            else
+            {
+                ret.append(c);
+                i++;
+            }
+        }
+
+        if(!ret.isEmpty() && ret[ret.size() - 1] == '/')
+            ret = ret.extract(0, ret.size() - 1);
+        return ret;
+    }
+
+    ResourcePackWriter::ResourcePackWriter()
+        : m_names(1024), m_alignment(DefaultAlignment), m_method(ResourcePack::M_Stored)
+    {
+
+    }
+
+    void ResourcePackWriter::setAlignment(size_t alignment)
+    {
+        size_t power = 1;
+        while(power < alignment && power < MaxAlignment)
+            power <<= 1;
+        m_alignment = power;
+    }
+
+    bool ResourcePackWriter::addFile(const String& name, const String& path)
+    {
+        String entry_name = ResourcePack::NormalizeName(StringView(name.toCstChar(), name.size()));
+        if(entry_name.isEmpty() || m_names.contains(entry_name))
+        {
+            aprodebug("Can't add file '") << path << "' as '" << entry_name << "' : name is empty or already used.";
+            return false;
+        }
+
+        Source source;
+        source.name      = entry_name;
+        source.path      = path;
+        source.alignment = m_alignment;
+        source.method    = m_method;
+
+        m_names.put(entry_name, (int) m_sources.size());
+        m_sources.append(source);
+        return true;
+    }
+
+    size_t ResourcePackWriter::addDirectory(const String& directory)
+    {
+        DirectoryScanner scanner;
+        scanner.setRecursive(true);
+        scanner.skipDirectories(true);
+        Array<DirectoryScanner::Entry> entries = scanner.scan(Path(directory));
+
+        // Entries paths begin with the directory and a separator.
+        size_t prefix = directory.size();
+        if(!directory.isEmpty() && directory[directory.size() - 1] != FileSystem::GetSeparator())
+            prefix++;
+
+        size_t count = 0;
+        for(size_t i = 0; i < entries.size(); ++i)
+        {
+            if(entries[i].type != DirectoryScanner::ET_File)
+                continue;
+
+            const Path& path = entries[i].path;
+            if(addFile(path.extract(prefix, path.size()), path))
+                count++;
+        }
+
+        return count;
+    }
+
+    bool ResourcePackWriter::write(const String& filename) const
+    {
+        static const Byte Zeros[MaxAlignment] = { 0 };
+
+        File file(filename, "wb");
+        if(!file.isOpened())
+        {
+            aprodebug("Can't create pack '") << filename << "'.";
+            return false;
+        }
+
+        // Data is written in names order, so files of one directory
+        // are close in the pack.
+        Array<size_t> order;
+        order.reserve(m_sources.size());
+        for(size_t i = 0; i < m_sources.size(); ++i)
+            order.append(i);
+
+        const Array<Source>& sources = m_sources;
+        std::sort(order.pointer(), order.pointer() + order.size(), [&sources] (size_t a, size_t b) {
+            return strcmp(sources[a].name.toCstChar(), sources[b].name.toCstChar()) < 0;
+        });
+
+        ResourcePack::Header header;
+        memset(&header, 0, sizeof(header));
+        bool ok = file.write((const Byte*) &header, sizeof(header));
+
+        Array<ResourcePack::Entry> entries;
+        entries.reserve(m_sources.size());
+        String   names;
+        uint64_t offset = sizeof(header);
+
+        Byte*  compressed          = nullptr;
+        size_t compressed_capacity = 0;
+
+        for(size_t i = 0; ok && i < order.size(); ++i)
+        {
+            const Source& source = m_sources[order[i]];
+
+            File input(source.path, "rb");
+            FileMapping bytes = input.map(FileMapping::Sequential);
+            if(!bytes.isValid())
+            {
+                aprodebug("Can't read file '") << source.path << "'.";
+                ok = false;
+                break;
+            }
+
+            // Block positions are 32 bits : larger files are stored.
+            const Byte* stored      = bytes.data();
+            size_t      stored_size = bytes.size();
+            uint8_t     method      = ResourcePack::M_Stored;
+            if(source.method == ResourcePack::M_LZ && bytes.size() && bytes.size() < 0x80000000)
+            {
+                if(compressed_capacity < LZCodec::CompressBound(bytes.size()))
+                {
+                    if(compressed)
+                        AProDeallocate(compressed);
+                    compressed_capacity = LZCodec::CompressBound(bytes.size());
+                    compressed          = (Byte*) AProAllocate(compressed_capacity);
+                }
+
+                size_t sz = LZCodec::Compress(bytes.data(), bytes.size(), compressed, compressed_capacity);
+                if(sz && sz < bytes.size())
+                {
+                    stored      = compressed;
+                    stored_size = sz;
+                    method      = ResourcePack::M_LZ;
+                }
+            }
+
+            size_t padding = (size_t) ((source.alignment - offset % source.alignment) % source.alignment);
+            if(padding)
+            {
+                ok = file.write(Zeros, padding);
+                offset += padding;
+            }
+
+            ResourcePack::Entry entry;
+            memset(&entry, 0, sizeof(entry));
+            entry.hash          = ResourcePack::Hash(StringView(source.name.toCstChar(), source.name.size()));
+            entry.offset        = offset;
+            entry.size          = stored_size;
+            entry.original_size = bytes.size();
+            entry.name_offset   = (uint32_t) names.size();
+            entry.name_size     = (uint32_t) source.name.size();
+            entry.crc           = ResourcePack::Crc32C(bytes.data(), bytes.size());
+            entry.method        = method;
+
+            while((size_t(1) << entry.alignment) < source.alignment)
+                entry.alignment++;
+
+            if(stored_size)
+                ok = ok && file.write(stored, stored_size);
+
+            offset += entry.size;
+            names.append(source.name.toCstChar());
+            entries.append(entry);
+        }
+
+        if(ok)
+        {
+            header.names_offset = offset;
+            header.names_size   = names.size();
+            ok = !names.size() || file.write((const Byte*) names.toCstChar(), names.size());
+            offset += names.size();
+
+            size_t padding = (size_t) ((sizeof(uint64_t) - offset % sizeof(uint64_t)) % sizeof(uint64_t));
+            ok = ok && (!padding || file.write(Zeros, padding));
+            offset += padding;
+
+            std::sort(entries.pointer(), entries.pointer() + entries.size(),
+                      [&names] (const ResourcePack::Entry& a, const ResourcePack::Entry& b) {
+                return EntryLess(a, StringView(names.toCstChar() + a.name_offset, a.name_size),
+                                 b, StringView(names.toCstChar() + b.name_offset, b.name_size));
+            });
+
+            header.magic      = ResourcePack::Magic;
+            header.version    = ResourcePack::Version;
+            header.count      = (uint32_t) entries.size();
+            header.toc_offset = offset;
+            header.toc_crc    = ResourcePack::Crc32C((const Byte*) entries.pointer(), entries.size() * sizeof(ResourcePack::Entry));
+            header.toc_crc    = ResourcePack::Crc32C((const Byte*) names.toCstChar(), names.size(), header.toc_crc);
+
+            ok = ok && (entries.isEmpty() || file.write((const Byte*) entries.pointer(), entries.size() * sizeof(ResourcePack::Entry)));
+
+            file.seek(File::C_BEGIN, 0);
+            ok = ok && file.write((const Byte*) &header, sizeof(header));
+        }
+
+        if(compressed)
+            AProDeallocate(compressed);
+
+        ok = file.close() && ok;
+        if(!ok)
+        {
+            aprodebug("Can't write pack '") << filename << "'.";
+            FileSystem::RemoveFile(filename);
+        }
+
+        return ok;
+    }
+}
@@ -0,0 +1,202 @@
+/////////////////////////////////////////////////////////////
+/** @file ResourcePreloader.cpp
+ *  @ingroup Core
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the ResourcePreloader class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "ResourcePreloader.h"
+#include "ResourceManager.h"
+
+#include <algorithm>
+
+namespace APro
+{
+    APRO_REGISTER_EVENT_CONTENT(ResourcePreloadedEvent)
+    APRO_REGISTER_EVENT_NOCONTENT(ResourcePreloadFinishedEvent)
+
+    ResourcePreloader::ResourcePreloader(ResourceManager* manager, const ResourceManifest& manifest)
+        : m_manager(manager), m_manifest(manifest), m_started(false), m_total(manifest.size()), m_done(0), m_failed(0)
+    {
+        m_items.reserve(m_total);
+
+        documentEvent(ResourcePreloadedEvent::Hash,       "An item of the manifest is loaded, or failed to. Event fields give its name and the progress.");
+        documentEvent(ResourcePreloadFinishedEvent::Hash, "Every item of the manifest is loaded, or failed to.");
+    }
+
+    ResourcePreloader::~ResourcePreloader()
+    {
+        // Callbacks of the requests use this object.
+        wait();
+    }
+
+    void ResourcePreloader::start()
+    {
+        if(m_started)
+            return;
+
+        m_started = true;
+
+        // Submitted by priority too : the first requests may start
+        // before the others are queued.
+        Array<size_t> order;
+        order.reserve(m_manifest.size());
+        for(size_t i = 0; i < m_manifest.size(); ++i)
+            order.append(i);
+
+        const ResourceManifest& manifest = m_manifest;
+        std::stable_sort(order.pointer(), order.pointer() + order.size(), [&manifest] (size_t a, size_t b) {
+            return manifest.at(a).priority > manifest.at(b).priority;
+        });
+
+        for(size_t i = 0; i < order.size(); ++i)
+        {
+            const ResourceManifest::Item& item = manifest.at(order[i]);
+
+            ResourceLoaderPtr loader = ResourceLoaderPtr::Null;
+            if(!item.loader.isEmpty())
+                loader = m_manager->getLoader(item.loader);
+
+            ResourceFuture future = m_manager->loadResourceAsync(item.name, item.filename, loader, item.priority);
+            if(!future.isValid())
+            {
+                // Counted as failed.
+                ResourceRequest* failed = AProNew(ResourceRequest);
+                failed->name     = item.name;
+                failed->filename = item.filename;
+                failed->complete(ResourcePtr::Null);
+                future = ResourceFuture(failed);
+            }
+
+            _add(item.name, item.priority, future);
+        }
+
+        // No item will ever call _onLoaded().
+        if(m_total == 0)
+            sendEvent(createEvent(ResourcePreloadFinishedEvent::Hash));
+    }
+
+    size_t ResourcePreloader::getDone() const
+    {
+        m_mutex.lock();
+        size_t ret = m_done;
+        m_mutex.unlock();
+        return ret;
+    }
+
+    size_t ResourcePreloader::getFailed() const
+    {
+        m_mutex.lock();
+        size_t ret = m_failed;
+        m_mutex.unlock();
+        return ret;
+    }
+
+    Real ResourcePreloader::getProgress() const
+    {
+        return m_total ? (Real) getDone() / (Real) m_total : 1.0f;
+    }
+
+    bool ResourcePreloader::isFinished() const
+    {
+        return getDone() == m_total;
+    }
+
+    ResourceFuture ResourcePreloader::getFuture(const String& name) const
+    {
+        for(size_t i = 0; i < m_items.size(); ++i)
+            if(m_items[i].name == name)
+                return m_items[i].future;
+
+        return ResourceFuture();
+    }
+
+    void ResourcePreloader::wait() const
+    {
+        for(size_t i = 0; i < m_items.size(); ++i)
+            m_items[i].future.wait();
+    }
+
+    void ResourcePreloader::wait(int priority) const
+    {
+        for(size_t i = 0; i < m_items.size(); ++i)
+            if(m_items[i].priority >= priority)
+                m_items[i].future.wait();
+    }
+
+    void ResourcePreloader::wait(const Array<String>& names) const
+    {
+        for(size_t i = 0; i < names.size(); ++i)
+            getFuture(names[i]).wait();
+    }
+
+    void ResourcePreloader::_add(const String& name, int priority, const ResourceFuture& future)
+    {
+        Item item;
+        item.name     = name;
+        item.priority = priority;
+        item.future   = future;
+        m_items.append(item);
+
+        ResourcePreloader* _this = this;
+        future.onReady([_this] (const ResourceRequest& request) { _this->_onLoaded(request); });
+    }
+
+    void ResourcePreloader::_onLoaded(const ResourceRequest& request)
+    {
+        bool success = !request.resource.isNull();
+
+        m_mutex.lock();
+        size_t done = ++m_done;
+        if(!success)
+            m_failed++;
+        m_mutex.unlock();
+
+        if(!success)
+            aprodebug("Can't preload '") << request.name << "' from file '" << request.filename << "'.";
+
+        ResourcePreloadedEvent* e = (ResourcePreloadedEvent*) AProNew(ResourcePreloadedEvent);
+        e->m_emitter = this;
+        e->name      = request.name;
+        e->success   = success;
+        e->done      = done;
+        e->total     = m_total;
+        sendEvent(EventLocalPtr((Event*) e));
+
+        if(done == m_total)
+            sendEvent(createEvent(ResourcePreloadFinishedEvent::Hash));
+    }
+
+    EventLocalPtr ResourcePreloader::createEvent(const HashType& e_type) const
+    {
+        if(e_type == ResourcePreloadFinishedEvent::Hash)
+        {
+            EventLocalPtr ret((Event*) AProNew(ResourcePreloadFinishedEvent));
+            ret->m_emitter = this;
+            return ret;
+        }
+
+        return EventEmitter::createEvent(e_type);
+    }
+}
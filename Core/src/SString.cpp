@@ -31,6 +31,8 @@
 ////////////////////////////////////////////////////////////
 #include "ThreadMutex.h"
 #include "SString.h"
+#include "StringSearch.h"
+#include "NumberFormat.h"
 
 namespace APro
 {
@@ -48,9 +50,17 @@ namespace APro
     }
     
     String::String(const char* str, size_t sz)
-        : mstr(str, sz)
     {
-        assertFinal();
+        mstr.reserve(sz + 1);
+        mstr.append(str, sz);
+        mstr.append('\0');
+    }
+
+    String::String(const StringView& view)
+    {
+        mstr.reserve(view.size() + 1);
+        mstr.append(view.data(), view.size());
+        mstr.append('\0');
     }
 
     String::String(const String& str)
@@ -90,27 +100,42 @@ namespace APro
 
     void String::append(const char* c)
     {
+        if(c)
+            append(c, strlen(c));
+    }
 
+    void String::append(const char* c, size_t sz)
+    {
+        if(!c || !sz)
+            return;
 
-        size_t sz = strlen(c);
-        if(sz > 0)
-        {
-            for(unsigned int i = 0; i < sz; i++)
-                mstr.insert(mstr.lastIndex(), c[i]);
-        }
-        assertFinal();
+        if(mstr.isEmpty())
+            mstr.append('\0');
+
+        // Grows geometrically, so appending many small parts costs O(n).
+        size_t old_size = mstr.size();
+        size_t new_size = old_size + sz;
+        if(new_size > mstr.physicalSize())
+            mstr.reserve(new_size > mstr.physicalSize() * 2 ? new_size : mstr.physicalSize() * 2);
+
+        // The characters are copied over the null one, which is put
+        // back at the end.
+        mstr.resize(new_size, '\0');
+        Memory::Copy(mstr.pointer() + old_size - 1, c, sz);
+        mstr.at(new_size - 1) = '\0';
     }
 
     void String::append(const String & c)
     {
-
-
-        if(c.size() > 0)
+        if(&c == this)
         {
-            for(unsigned int i = 0; i < c.size(); i++)
-                append(c.at(i));
+            String copy(c);
+            append(copy.toCstChar(), copy.size());
+        }
+        else
+        {
+            append(c.toCstChar(), c.size());
         }
-        assertFinal();
     }
 
     void String::append(const Real& nb)
@@ -207,76 +232,42 @@ namespace APro
 
     size_t String::findFirst(char c, size_t from) const
     {
+        if(from >= size())
+            return size();
 
-
-        for(unsigned int i = from; i < size(); i++)
-            if(mstr.at(i) == c) return i;
-
-        return size();
+        return from + StringSearch::FindChar(toCstChar() + from, size() - from, c);
     }
 
-    size_t String::findFirst(const String & str, size_t from) const
+    size_t String::findFirst(const StringView& str, size_t from) const
     {
+        if(from >= size())
+            return size();
 
-
-        for(unsigned int i = from; i < size() && size() - i < str.size(); i++)
-        {
-            if(mstr.at(i) == str.at(0))
-            {
-                for(unsigned int j = 1; j < str.size(); j++)
-                {
-                    if(j == str.size() - 1 && mstr.at(j) == str.at(j))
-                        return i;
-                }
-            }
-        }
-
-        return size();
+        return from + StringSearch::Find(toCstChar() + from, size() - from, str.data(), str.size());
     }
 
     size_t String::findLast(char c) const
     {
-
-
-        for(int i = size() - 1; i >= 0; i--)
-            if(mstr.at(i) == c) return i;
-
-        return size();
+        return StringSearch::FindLastChar(toCstChar(), size(), c);
     }
 
-    size_t String::findLast(const String & str) const
+    size_t String::findLast(const StringView& str) const
     {
-
-
-        for(int i = size() - str.size(); i >= 0; i--)
-        {
-            if(mstr.at(i) == str.at(0))
-            {
-                for(unsigned int j = 1; j < str.size(); j++)
-                {
-                    if(j == str.size() - 1 && mstr.at(j) == str.at(j))
-                        return i;
-                }
-            }
-        }
-
-        return size();
+        return StringSearch::FindLast(toCstChar(), size(), str.data(), str.size());
     }
 
     String String::extract(size_t from, size_t to) const
     {
-
-
-        String result;
-
         if(from > to) Allocator<size_t>::swap(&from, &to, 1);
         if(to > size()) to = size();
-        if(from >= size()) return result;
+        if(from >= size()) return String();
 
-        for(size_t i = from; i < to; i++)
-            result.append(at(i));
+        return String(toCstChar() + from, to - from);
+    }
 
-        return result;
+    StringView String::view(size_t from, size_t to) const
+    {
+        return StringView(toCstChar(), size()).extract(from, to);
     }
 
     bool String::match(char c) const
@@ -285,7 +276,7 @@ namespace APro
         return findFirst(c) != size();
     }
 
-    bool String::match(const String& str) const
+    bool String::match(const StringView& str) const
     {
 
         return findFirst(str) != size();
@@ -411,39 +402,33 @@ namespace APro
 
     String String::toString(unsigned int num)
     {
-        char buffer[30];
-        sprintf(buffer, "%d", num);
-        return String(buffer);
+        char buffer[NumberFormat::MaxIntegerSize];
+        return String(buffer, NumberFormat::Format(buffer, (uint32_t) num));
     }
 
     String String::toString(int num)
     {
-        char buffer[30];
-        sprintf(buffer, "%d", num);
-        return String(buffer);
+        char buffer[NumberFormat::MaxIntegerSize];
+        return String(buffer, NumberFormat::Format(buffer, (int32_t) num));
     }
 
     String String::toString(double num)
     {
-        char buffer[30];
-        sprintf(buffer, "%f", num);
-        return String(buffer);
+        char buffer[NumberFormat::MaxRealSize];
+        return String(buffer, NumberFormat::Format(buffer, num));
     }
 
     String String::toString(Real r)
     {
-        char buffer[30];
-        sprintf(buffer, "%f", r);
-        return String(buffer);
+        char buffer[NumberFormat::MaxRealSize];
+        return String(buffer, NumberFormat::Format(buffer, r));
     }
 
     Real String::toReal() const
     {
-#ifdef _USE_DOUBLEREAL_
-        return strtod(toCstChar(), nullptr);
-#else
-        return strtof(toCstChar(), nullptr);
-#endif // _USE_DOUBLEREAL_
+        Real r = 0;
+        NumberFormat::Parse(toCstChar(), size(), r);
+        return r;
     }
 
     int String::toInt() const
@@ -477,32 +462,33 @@ namespace APro
 
     int String::replaceEvery(char from, char to)
     {
-
-        int nb = 0;
-        for(unsigned int i = 0; i < size(); ++i)
-        {
-            if(at(i) == from)
-            {
-                at(i) = to;
-                ++nb;
-            }
-        }
-
-        return nb;
+        return (int) StringSearch::ReplaceChar(mstr.pointer(), size(), from, to);
     }
 
     void String::replace(const String& str, const String& to)
     {
+        if(str.isEmpty() || str == to) return;
+
+        size_t pos = findFirst(str);
+        if(pos == size()) return;
 
-        if(str == to) return;
+        // Builds the result in one pass, so every occurence costs only
+        // one copy whatever the size of the String is.
+        Array<char> result;
+        result.reserve(size() + 1);
 
-        int pos = findFirst(str);
-        while(pos > -1)
+        size_t old = 0;
+        while(pos < size())
         {
-            erase(pos, pos + str.size() - 1);
-            insert(pos, to);
-            pos = findFirst(str);
+            result.append(toCstChar() + old, pos - old);
+            result.append(to.toCstChar(), to.size());
+            old = pos + str.size();
+            pos = findFirst(str, old);
         }
+
+        result.append(toCstChar() + old, size() - old);
+        result.append('\0');
+        mstr.swap(result);
     }
 
     String& String::operator = (const String & other)
@@ -522,53 +508,47 @@ namespace APro
 
     List<String> String::explode(char c) const
     {
-
-        String str(*this);
         List<String> ret;
 
         size_t old = 0;
-        size_t index = str.findFirst(c);
-        while(index < str.size())
+        size_t index = findFirst(c);
+        while(index < size())
         {
-            ret.append(str.extract(old, index));
+            ret.append(String(toCstChar() + old, index - old));
             old = index + 1;
-            index = str.findFirst(c, old);
+            index = findFirst(c, old);
         }
 
-        ret.append(str.extract(old, index + 1));
+        ret.append(String(toCstChar() + old, size() - old));
         return ret;
     }
 
-    List<String> String::explode(const String& str) const
+    List<String> String::explode(const StringView& str) const
     {
-
-        String strc(*this);
         List<String> ret;
 
         size_t old = 0;
-        size_t index = strc.findFirst(str);
-
-        while(index < strc.size())
+        size_t index = findFirst(str);
+        while(index < size())
         {
-            ret.append(strc.extract(old, index));
-            old = index + 1;
-            index = strc.findFirst(str, old);
+            ret.append(String(toCstChar() + old, index - old));
+            old = index + str.size();
+            index = findFirst(str, old);
         }
 
-        ret.append(strc.extract(old, index + 1));
+        ret.append(String(toCstChar() + old, size() - old));
         return ret;
     }
 
     List<String> String::explode(const char* str) const
     {
-
-        return explode(String(str));
+        return explode(StringView(str));
     }
 
     int String::toInt(const String& str)
     {
-        int x;
-        sscanf(str.toCstChar(), "%i", &x);
+        int32_t x = 0;
+        NumberFormat::Parse(str.toCstChar(), str.size(), x);
         return x;
     }
 
@@ -632,19 +612,14 @@ namespace APro
 
     double String::toDouble(const String& str)
     {
-        if(str.isEmpty()) return 0;
-        return atof(str.toCstChar());
+        double d = 0;
+        NumberFormat::Parse(str.toCstChar(), str.size(), d);
+        return d;
     }
 
     String String::fromDouble(double d)
     {
-        char buffer[100];
-        String ret;
-
-        sprintf(buffer, "%.9lf", d);
-        ret.append(buffer);
-
-        return ret;
+        return String::toString(d);
     }
 
     String String::toString(bool b)
@@ -657,9 +632,7 @@ namespace APro
 
     String String::FromInt(int i)
     {
-        char buffer[32];
-        sprintf(buffer, "%d", i);
-        return String(buffer);
+        return String::toString(i);
     }
 
     HashType String::hash() const
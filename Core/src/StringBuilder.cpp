@@ -0,0 +1,195 @@
+/////////////////////////////////////////////////////////////
+/** @file StringBuilder.cpp
+ *  @ingroup Global
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the StringBuilder class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "StringBuilder.h"
+#include "NumberFormat.h"
+
+#include <cstring>
+
+namespace APro
+{
+    StringBuilder::StringBuilder(size_t chunkSize)
+        : mFirst(nullptr), mLast(nullptr), mSize(0), mChunkSize(chunkSize ? chunkSize : ChunkSize)
+    {
+
+    }
+
+    StringBuilder::StringBuilder(StringBuilder&& rhs)
+        : mFirst(rhs.mFirst), mLast(rhs.mLast), mSize(rhs.mSize), mChunkSize(rhs.mChunkSize)
+    {
+        rhs.mFirst = nullptr;
+        rhs.mLast  = nullptr;
+        rhs.mSize  = 0;
+    }
+
+    StringBuilder::~StringBuilder()
+    {
+        clear();
+    }
+
+    void StringBuilder::clear()
+    {
+        Chunk* chunk = mFirst;
+        while(chunk)
+        {
+            Chunk* next = chunk->next;
+            AProDeallocate(chunk);
+            chunk = next;
+        }
+
+        mFirst = nullptr;
+        mLast  = nullptr;
+        mSize  = 0;
+    }
+
+    void StringBuilder::append(const char* str, size_t sz)
+    {
+        if(!str || !sz)
+            return;
+
+        mSize += sz;
+
+        // Fills the last chunk first, then puts the rest in one new
+        // chunk big enough.
+        if(mLast)
+        {
+            size_t available = mLast->capacity - mLast->size;
+            size_t part = available < sz ? available : sz;
+
+            memcpy(mLast->data() + mLast->size, str, part);
+            mLast->size += part;
+            str += part;
+            sz  -= part;
+        }
+
+        if(sz)
+        {
+            Chunk* chunk = newChunk(sz);
+            memcpy(chunk->data(), str, sz);
+            chunk->size = sz;
+        }
+    }
+
+    void StringBuilder::append(StringBuilder&& rhs)
+    {
+        if(&rhs == this || !rhs.mFirst)
+            return;
+
+        if(mLast)
+            mLast->next = rhs.mFirst;
+        else
+            mFirst = rhs.mFirst;
+
+        mLast  = rhs.mLast;
+        mSize += rhs.mSize;
+
+        rhs.mFirst = nullptr;
+        rhs.mLast  = nullptr;
+        rhs.mSize  = 0;
+    }
+
+    StringBuilder& StringBuilder::operator << (int i)
+    {
+        char buffer[NumberFormat::MaxIntegerSize];
+        append(buffer, NumberFormat::Format(buffer, (int32_t) i));
+        return *this;
+    }
+
+    StringBuilder& StringBuilder::operator << (unsigned int u)
+    {
+        char buffer[NumberFormat::MaxIntegerSize];
+        append(buffer, NumberFormat::Format(buffer, (uint32_t) u));
+        return *this;
+    }
+
+    StringBuilder& StringBuilder::operator << (long l)
+    {
+        char buffer[NumberFormat::MaxIntegerSize];
+        append(buffer, NumberFormat::Format(buffer, (int64_t) l));
+        return *this;
+    }
+
+    StringBuilder& StringBuilder::operator << (unsigned long ul)
+    {
+        char buffer[NumberFormat::MaxIntegerSize];
+        append(buffer, NumberFormat::Format(buffer, (uint64_t) ul));
+        return *this;
+    }
+
+    StringBuilder& StringBuilder::operator << (float r)
+    {
+        char buffer[NumberFormat::MaxRealSize];
+        append(buffer, NumberFormat::Format(buffer, r));
+        return *this;
+    }
+
+    StringBuilder& StringBuilder::operator << (double r)
+    {
+        char buffer[NumberFormat::MaxRealSize];
+        append(buffer, NumberFormat::Format(buffer, r));
+        return *this;
+    }
+
+    String StringBuilder::toString() const
+    {
+        Array<char> str;
+        str.reserve(mSize + 1);
+
+        for(const Chunk* chunk = mFirst; chunk; chunk = chunk->next)
+            str.append(chunk->data(), chunk->size);
+        str.append('\0');
+
+        String ret;
+        ret.mstr.swap(str);
+        return ret;
+    }
+
+    void StringBuilder::forEachChunk(const std::function<void (const StringView&)>& func) const
+    {
+        for(const Chunk* chunk = mFirst; chunk; chunk = chunk->next)
+            func(StringView(chunk->data(), chunk->size));
+    }
+
+    StringBuilder::Chunk* StringBuilder::newChunk(size_t sz)
+    {
+        size_t capacity = sz > mChunkSize ? sz : mChunkSize;
+
+        Chunk* chunk    = (Chunk*) AProAllocate(sizeof(Chunk) + capacity);
+        chunk->next     = nullptr;
+        chunk->size     = 0;
+        chunk->capacity = capacity;
+
+        if(mLast)
+            mLast->next = chunk;
+        else
+            mFirst = chunk;
+
+        mLast = chunk;
+        return chunk;
+    }
+}
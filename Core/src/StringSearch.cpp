@@ -0,0 +1,251 @@
+/////////////////////////////////////////////////////////////
+/** @file StringSearch.cpp
+ *  @ingroup Global
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the search primitives used by String.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "StringSearch.h"
+
+#include <cstring>
+
+#if defined(APRO_SIMD_AVX2)
+#   include <immintrin.h>
+#elif defined(APRO_SIMD_SSE2)
+#   include <emmintrin.h>
+#endif
+
+namespace APro
+{
+    namespace
+    {
+        // Every SIMD path uses the same few operations, so the
+        // algorithms are written once with those wrappers.
+#if defined(APRO_SIMD_AVX2)
+
+        typedef __m256i Block;
+        const size_t BlockSize = 32;
+
+        inline Block Splat(char c) { return _mm256_set1_epi8(c); }
+        inline Block Load(const char* p) { return _mm256_loadu_si256((const __m256i*) p); }
+        inline void  Store(char* p, Block b) { _mm256_storeu_si256((__m256i*) p, b); }
+
+        inline uint32_t MatchMask(Block b, Block c) { return (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(b, c)); }
+
+        inline Block Replace(Block b, Block from, Block to, uint32_t& mask)
+        {
+            Block eq = _mm256_cmpeq_epi8(b, from);
+            mask = (uint32_t) _mm256_movemask_epi8(eq);
+            return _mm256_blendv_epi8(b, to, eq);
+        }
+
+#elif defined(APRO_SIMD_SSE2)
+
+        typedef __m128i Block;
+        const size_t BlockSize = 16;
+
+        inline Block Splat(char c) { return _mm_set1_epi8(c); }
+        inline Block Load(const char* p) { return _mm_loadu_si128((const __m128i*) p); }
+        inline void  Store(char* p, Block b) { _mm_storeu_si128((__m128i*) p, b); }
+
+        inline uint32_t MatchMask(Block b, Block c) { return (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(b, c)); }
+
+        inline Block Replace(Block b, Block from, Block to, uint32_t& mask)
+        {
+            Block eq = _mm_cmpeq_epi8(b, from);
+            mask = (uint32_t) _mm_movemask_epi8(eq);
+            return _mm_or_si128(_mm_and_si128(eq, to), _mm_andnot_si128(eq, b));
+        }
+
+#endif
+
+        /** Index of the highest bit set in a non-null mask. */
+        inline uint32_t HighestBit(uint32_t mask) { return 31 - __builtin_clz(mask); }
+    }
+
+    namespace StringSearch
+    {
+        size_t FindChar(const char* data, size_t sz, char c)
+        {
+            // The C library memchr is already vectorized on every platform
+            // we support.
+            const void* found = memchr(data, c, sz);
+            return found ? (size_t) ((const char*) found - data) : sz;
+        }
+
+        size_t FindLastChar(const char* data, size_t sz, char c)
+        {
+            size_t end = sz;
+
+#if defined(APRO_SIMD_AVX2) || defined(APRO_SIMD_SSE2)
+            const Block cb = Splat(c);
+            while(end >= BlockSize)
+            {
+                uint32_t mask = MatchMask(Load(data + end - BlockSize), cb);
+                if(mask)
+                    return end - BlockSize + HighestBit(mask);
+                end -= BlockSize;
+            }
+#endif
+
+            while(end > 0)
+            {
+                --end;
+                if(data[end] == c)
+                    return end;
+            }
+
+            return sz;
+        }
+
+        size_t Find(const char* data, size_t sz, const char* pattern, size_t psz)
+        {
+            if(psz == 0 || psz > sz)
+                return sz;
+            if(psz == 1)
+                return FindChar(data, sz, pattern[0]);
+
+            size_t i = 0;
+
+#if defined(APRO_SIMD_AVX2) || defined(APRO_SIMD_SSE2)
+            // Candidates are positions where both the first and the last
+            // characters of the pattern match. Only those are verified.
+            const Block first = Splat(pattern[0]);
+            const Block last  = Splat(pattern[psz - 1]);
+
+            for(; i + psz - 1 + BlockSize <= sz; i += BlockSize)
+            {
+                uint32_t mask = MatchMask(Load(data + i), first) &
+                                MatchMask(Load(data + i + psz - 1), last);
+                while(mask)
+                {
+                    uint32_t bit = __builtin_ctz(mask);
+                    if(memcmp(data + i + bit + 1, pattern + 1, psz - 2) == 0)
+                        return i + bit;
+                    mask &= mask - 1;
+                }
+            }
+#endif
+
+            // Remaining positions (or every position without SIMD).
+            for(; i + psz <= sz; ++i)
+            {
+                const char* found = (const char*) memchr(data + i, pattern[0], sz - psz + 1 - i);
+                if(!found)
+                    break;
+
+                i = (size_t) (found - data);
+                if(memcmp(found + 1, pattern + 1, psz - 1) == 0)
+                    return i;
+            }
+
+            return sz;
+        }
+
+        size_t FindLast(const char* data, size_t sz, const char* pattern, size_t psz)
+        {
+            if(psz == 0 || psz > sz)
+                return sz;
+            if(psz == 1)
+                return FindLastChar(data, sz, pattern[0]);
+
+            // 'end' is one past the last candidate position to look at.
+            size_t end = sz - psz + 1;
+
+#if defined(APRO_SIMD_AVX2) || defined(APRO_SIMD_SSE2)
+            const Block first = Splat(pattern[0]);
+            const Block last  = Splat(pattern[psz - 1]);
+
+            while(end >= BlockSize)
+            {
+                size_t base = end - BlockSize;
+                uint32_t mask = MatchMask(Load(data + base), first) &
+                                MatchMask(Load(data + base + psz - 1), last);
+                while(mask)
+                {
+                    uint32_t bit = HighestBit(mask);
+                    if(memcmp(data + base + bit + 1, pattern + 1, psz - 2) == 0)
+                        return base + bit;
+                    mask &= ~(1u << bit);
+                }
+                end = base;
+            }
+#endif
+
+            while(end > 0)
+            {
+                --end;
+                if(data[end] == pattern[0] && memcmp(data + end + 1, pattern + 1, psz - 1) == 0)
+                    return end;
+            }
+
+            return sz;
+        }
+
+        size_t ReplaceChar(char* data, size_t sz, char from, char to)
+        {
+            size_t count = 0;
+            size_t i = 0;
+
+#if defined(APRO_SIMD_AVX2) || defined(APRO_SIMD_SSE2)
+            const Block fb = Splat(from);
+            const Block tb = Splat(to);
+
+            for(; i + BlockSize <= sz; i += BlockSize)
+            {
+                uint32_t mask;
+                Block result = Replace(Load(data + i), fb, tb, mask);
+                if(mask)
+                {
+                    Store(data + i, result);
+                    count += __builtin_popcount(mask);
+                }
+            }
+#endif
+
+            for(; i < sz; ++i)
+            {
+                if(data[i] == from)
+                {
+                    data[i] = to;
+                    ++count;
+                }
+            }
+
+            return count;
+        }
+
+        const bool AlphaTable[256] =
+        {
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,// @A-Z[\]^_
+            0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,// `a-z{|}~
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+            0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+        };
+    }
+}
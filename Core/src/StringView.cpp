@@ -0,0 +1,166 @@
+/////////////////////////////////////////////////////////////
+/** @file StringView.cpp
+ *  @ingroup Global
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Implements the StringView class.
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "StringView.h"
+#include "StringSearch.h"
+#include "NumberFormat.h"
+
+#include <cstring>
+#include <cctype>
+
+namespace APro
+{
+    StringView::StringView(const char* str)
+        : mData(str ? str : ""), mSize(str ? strlen(str) : 0)
+    {
+
+    }
+
+    size_t StringView::findFirst(char c, size_t from) const
+    {
+        if(from >= mSize)
+            return mSize;
+
+        return from + StringSearch::FindChar(mData + from, mSize - from, c);
+    }
+
+    size_t StringView::findFirst(const StringView& str, size_t from) const
+    {
+        if(from >= mSize)
+            return mSize;
+
+        return from + StringSearch::Find(mData + from, mSize - from, str.mData, str.mSize);
+    }
+
+    size_t StringView::findLast(char c) const
+    {
+        return StringSearch::FindLastChar(mData, mSize, c);
+    }
+
+    size_t StringView::findLast(const StringView& str) const
+    {
+        return StringSearch::FindLast(mData, mSize, str.mData, str.mSize);
+    }
+
+    bool StringView::startsWith(const StringView& str) const
+    {
+        return str.mSize <= mSize && memcmp(mData, str.mData, str.mSize) == 0;
+    }
+
+    bool StringView::endsWith(const StringView& str) const
+    {
+        return str.mSize <= mSize && memcmp(mData + mSize - str.mSize, str.mData, str.mSize) == 0;
+    }
+
+    StringView StringView::extract(size_t from, size_t to) const
+    {
+        if(from > to) { size_t tmp = from; from = to; to = tmp; }
+        if(to > mSize) to = mSize;
+        if(from >= mSize) return StringView(mData + mSize, 0);
+
+        return StringView(mData + from, to - from);
+    }
+
+    StringView StringView::trimmed() const
+    {
+        size_t first = 0;
+        size_t last  = mSize;
+
+        while(first < last && isspace((unsigned char) mData[first]))
+            first++;
+        while(last > first && isspace((unsigned char) mData[last - 1]))
+            last--;
+
+        return StringView(mData + first, last - first);
+    }
+
+    List<StringView> StringView::explode(char c) const
+    {
+        List<StringView> ret;
+
+        size_t old = 0;
+        size_t index = findFirst(c);
+        while(index < mSize)
+        {
+            ret.append(StringView(mData + old, index - old));
+            old = index + 1;
+            index = findFirst(c, old);
+        }
+
+        ret.append(StringView(mData + old, mSize - old));
+        return ret;
+    }
+
+    List<StringView> StringView::explode(const StringView& str) const
+    {
+        List<StringView> ret;
+
+        size_t old = 0;
+        size_t index = findFirst(str);
+        while(index < mSize)
+        {
+            ret.append(StringView(mData + old, index - old));
+            old = index + str.mSize;
+            index = findFirst(str, old);
+        }
+
+        ret.append(StringView(mData + old, mSize - old));
+        return ret;
+    }
+
+    int StringView::toInt() const
+    {
+        int32_t i = 0;
+        NumberFormat::Parse(mData, mSize, i);
+        return i;
+    }
+
+    Real StringView::toReal() const
+    {
+        Real r = 0;
+        NumberFormat::Parse(mData, mSize, r);
+        return r;
+    }
+
+    HashType StringView::hash() const
+    {
+        // Must stay the same as String::hash().
+        HashType h = 0;
+        for(size_t i = 0; i < mSize; ++i)
+        {
+            h = 65599 * h + mData[i];
+        }
+
+        return h ^ (h << 16);
+    }
+
+    bool operator == (const StringView& lhs, const StringView& rhs)
+    {
+        return lhs.size() == rhs.size() && memcmp(lhs.data(), rhs.data(), lhs.size()) == 0;
+    }
+}
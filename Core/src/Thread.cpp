@@ -43,6 +43,7 @@ namespace APro
     Thread::Thread()
     {
         m_name = String("Unknown");
+        m_atom = Atom(m_name);
         m_thread = nullptr;
 
         m_started.value = false;
@@ -60,6 +61,7 @@ namespace APro
     Thread::Thread(const String& name)
     {
         m_name = name;
+        m_atom = Atom(name);
         m_thread = nullptr;
 
         m_started.value = false;
@@ -87,6 +89,11 @@ namespace APro
         return m_name;
     }
 
+    const Atom& Thread::getAtom() const
+    {
+        return m_atom;
+    }
+
     void Thread::setCallback(pfunc ptr, void* userdata)
     {
         m_callback = ptr;
@@ -108,6 +108,33 @@ namespace APro
         }
     }
 
+    ThreadPtr ThreadManager::createThread(const Atom& name)
+    {
+        ThreadPtr thread = getThread(name);
+        if(thread.isNull())
+            thread = createThread(name.toString());
+
+        return thread;
+    }
+
+    ThreadPtr ThreadManager::getThread(const Atom& name)
+    {
+        APRO_THREADSAFE_AUTOLOCK
+        ThreadArray::const_iterator e = threads.end();
+        for(ThreadArray::iterator it = threads.begin(); it != e; it++)
+        {
+            if((*it)->getAtom() == name)
+                return *it;
+        }
+
+        return ThreadPtr();
+    }
+
+    void ThreadManager::destroyThread(const Atom& name)
+    {
+        destroyThread(name.toString());
+    }
+
     ThreadMutexPtr ThreadManager::createMutex()
     {
         Id id = IdGenerator::Get().pick();
@@ -39,6 +39,15 @@ namespace APro
     {
         type     = tp;
         content  = cont;
+        viewed   = false;
+        position = pos;
+    }
+    
+    Token::Token (int tp, const StringView& cont, const TokPosition& pos)
+    {
+        type     = tp;
+        view     = cont;
+        viewed   = true;
         position = pos;
     }
     
@@ -46,6 +55,8 @@ namespace APro
     {
         type     = tok.type;
         content  = tok.content;
+        view     = tok.view;
+        viewed   = tok.viewed;
         position = tok.position;
     }
 
@@ -53,10 +64,14 @@ namespace APro
     {
         type     = stdmove(tok.type);
         content  = stdmove(tok.content);
+        view     = tok.view;
+        viewed   = tok.viewed;
         position = stdmove(tok.position);
         
         tok.type     = -1;
         tok.content.clear();
+        tok.view     = StringView();
+        tok.viewed   = false;
         tok.position = TokPosition (0,0);
     }
     
@@ -66,9 +81,20 @@ namespace APro
         
         swap(type,     rhs.type);
         swap(content,  rhs.content);
+        swap(view,     rhs.view);
+        swap(viewed,   rhs.viewed);
         swap(position, rhs.position);
     }
     
+    void Token::buildContent() const
+    {
+        if(viewed)
+        {
+            content = String(view);
+            viewed  = false;
+        }
+    }
+    
     Token& Token::operator = (Token tok)
     {
         swap (*this, tok);
@@ -79,6 +105,7 @@ namespace APro
     TokenScanner::TokenScanner (const String& str)
     {
         input            = str;
+        inputView        = input;
         inputLenght      = str.size();
         currentCharacter = -1;
         currentToken     = -1;
@@ -87,6 +114,17 @@ namespace APro
         syntaxErrorCallback = nullptr;
     }
     
+    TokenScanner::TokenScanner (const StringView& view)
+    {
+        inputView        = view;
+        inputLenght      = (int) view.size();
+        currentCharacter = -1;
+        currentToken     = -1;
+        column           = 0;
+        line             = 1;
+        syntaxerrorCallback = nullptr;
+    }
+    
     TokenScanner::~TokenScanner ()
     {
         
@@ -105,7 +143,7 @@ namespace APro
     
     char TokenScanner::getCurrentCharacter () const
     {
-        return input.at(currentCharacter);
+        return inputView.at(currentCharacter);
     }
     
     void TokenScanner::backupCharacter ()
@@ -117,7 +155,7 @@ namespace APro
     char TokenScanner::peekCharacter () const
     {
         if(hasNextCharacter())
-            return input.at(currentCharacter + 1);
+            return inputView.at(currentCharacter + 1);
         return 0;
     }
     
@@ -141,6 +179,11 @@ namespace APro
         }
     }
     
+    StringView TokenScanner::getInputView(int first, int last) const
+    {
+        return inputView.extract((size_t) first, (size_t) last);
+    }
+    
     void TokenScanner::setSyntaxErrorCallback (TokenScanner::OnSyntaxErrorCallback cbck)
     {
         syntaxErrorCallback = cbck;
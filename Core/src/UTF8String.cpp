@@ -16,6 +16,17 @@
 #include "Maths.h"
 
 #include "SString.h"
+#include "Console.h"
+
+#include <cstring>
+
+#if defined(APRO_SIMD_AVX2)
+#   include <immintrin.h>
+#elif defined(APRO_SIMD_SSSE3)
+#   include <tmmintrin.h>
+#elif defined(APRO_SIMD_SSE2)
+#   include <emmintrin.h>
+#endif
 
 namespace APro
 {
@@ -35,7 +46,7 @@ namespace APro
             return UTF8Char::TInvalid;
     }
     
-    UTF8Char::SequenceType UTF8CHar::Sequence (UTF8Char::Octet cp, UTF8Char::Octet prev)
+    UTF8Char::SequenceType UTF8Char::Sequence (UTF8Char::Octet cp, UTF8Char::Octet prev)
     {
         if(cp >= 0x00 && cp <= 0x7F)
             return UTF8Char::STAscii;
@@ -52,29 +63,17 @@ namespace APro
         // before other bytes.)
         else if(cp >= 0x80 && cp <= 0xBF)
         {
-            else if(prev == 0xE0)
-                if(cp >= 0xA0 && cp <= 0xBF)
-                    return UTF8Char::STOctet2E0;
-                else
-                    return UTF8Char::OE2BAD;
+            if(prev == 0xE0)
+                return (cp >= 0xA0 && cp <= 0xBF) ? UTF8Char::STOctet2E0 : UTF8Char::OE2BAD;
             
             else if(prev == 0xED)
-                if(cp >= 0x80 && cp <= 0x9F)
-                    return UTF8Char::STOctet2ED;
-                else
-                    return UTF8Char::OE2BAD;
+                return (cp >= 0x80 && cp <= 0x9F) ? UTF8Char::STOctet2ED : UTF8Char::OE2BAD;
             
             else if(prev == 0xF0)
-                if(cp >= 0x90 && cp <= 0xBF)
-                    return UTF8Char::STOctet2F0;
-                else
-                    return UTF8Char::OE2BAD;
+                return (cp >= 0x90 && cp <= 0xBF) ? UTF8Char::STOctet2F0 : UTF8Char::OE2BAD;
             
             else if(prev == 0xF4)
-                if(cp >= 0x80 && cp <= 0x8F)
-                    return UTF8Char::STOctet2F4;
-                else
-                    return UTF8Char::OE2BAD;
+                return (cp >= 0x80 && cp <= 0x8F) ? UTF8Char::STOctet2F4 : UTF8Char::OE2BAD;
             
             else
                 return UTF8Char::STOctetXNormal;
@@ -88,6 +87,12 @@ namespace APro
             return UTF8Char::STInvalid;
     }
     
+    bool UTF8Char::IsSequenceContinuing(SequenceType st)
+    {
+        return st == STOctetXNormal || st == STOctet2E0 || st == STOctet2ED ||
+               st == STOctet2F0     || st == STOctet2F4;
+    }
+    
     UTF8Char::CodePoint UTF8Char::ExtractUTF8CodePoint(UTF8Char::Octet o1,
                                                        UTF8Char::Octet o2,
                                                        UTF8Char::Octet o3,
@@ -130,12 +135,11 @@ namespace APro
     
     size_t UTF8Char::GetCodePointSegmentSize(CodePoint cp)
     {
-        unsigned long int nbbits = (unsigned long int) Maths::ceil(Maths::Log2((Real) cp));
-        if(nbbits >= 0 && nbbits < 8)
+        if(cp < 0x80)
             return 1;
-        if(nbbits >= 8 && nbbits < 12)
+        if(cp < 0x800)
             return 2;
-        if(nbbits >= 12 && nbbits < 17)
+        if(cp < 0x10000)
             return 3;
         return 4;
     }
@@ -154,188 +158,673 @@ namespace APro
     
     bool UTF8Char::IsSpace(const CodePoint& cp)
     {
-        return cp != 0x0020 && cp != 0x0009 &&
-               cp != 0x000D && cp != 0x000A;
+        return cp == 0x0020 || cp == 0x0009 ||
+               cp == 0x000D || cp == 0x000A;
     }
     
     int UTF8Char::toChar(char* ret , const CodePoint& cp)
     {
-        size_t nsegmentsize = GetCodePointSegmentSize(cp);
-        const char* cpc = (const char*) &cp;
-        
-        //////////////////////////////////////////////////////////////////
-        // The methods to set bits is simple :
-        // We only align bits in the correct pattern
-        // We begin by the end, bits 2 3 and 4 always begin by 10xxxxxx.
-        // We set the 6 first bits, and the 2 last to next byte.
-        //
-        // 10000000
-        // 00XXXXXX // codepoint byte 4.
-        //
-        // 11000000
-        // 000000XX ( XX000000 >> 6 // codepoint byte 4. )
-        // 000XXX00 ( 00000XXX << 2 // codepoint byte 3. )
-        //////////////////////////////////////////////////////////////////
-        
-        if(nsegmentsize == 1)
+        // Bits of the CodePoint are placed from the last octet to the
+        // first one : continuing octets are always 10xxxxxx.
+        
+        if(cp < 0x80)
         {
             // [1 - 7] bits.
-            // The most easy, just place the correct bits in the first char.
-            ret[0]  = 0x00;
-            ret[0] |= cpc[4] & 0b01111111;
-            
+            ret[0] = (char) cp;
             return 1;
         }
         
-        if(nsegmentsize == 2)
+        if(cp < 0x800)
         {
-            // [8 - 11] bits.
-            // ret will be 110xxxxx on first char, (0xC2 is 110 00000)
-            //             10xxxxxx on second char.
-            
-            ret[1]  = 0b10000000;
-            ret[1] |= cpc[4] & 0b00111111;// We set the 6 bits.
-            
-            ret[0]  = 0b11000000;
-            ret[0] |= (cpc[4] & 0b11000000) >> 6;
-            ret[0] |= (cpc[3] & 0b00000111) << 2;
-            
+            // [8 - 11] bits : 110xxxxx 10xxxxxx
+            ret[0] = (char) (0xC0 | (cp >> 6));
+            ret[1] = (char) (0x80 | (cp & 0x3F));
             return 2;
         }
         
-        if(nsegmentsize == 3)
+        if(cp < 0x10000)
         {
-            // [12 - 16] bits.
+            // [12 - 16] bits : 1110xxxx 10xxxxxx 10xxxxxx
+            // Surrogates can't be encoded.
+            if(cp >= 0xD800 && cp <= 0xDFFF)
+                return 0;
             
-            ret[2]  = 0b10000000;
-            ret[2] |= cpc[4] & 0b00111111;// We set the 6 bits.
+            ret[0] = (char) (0xE0 | (cp >> 12));
+            ret[1] = (char) (0x80 | ((cp >> 6) & 0x3F));
+            ret[2] = (char) (0x80 | (cp & 0x3F));
+            return 3;
+        }
+        
+        if(cp < 0x110000)
+        {
+            // [17 - 21 bits] : 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
+            ret[0] = (char) (0xF0 | (cp >> 18));
+            ret[1] = (char) (0x80 | ((cp >> 12) & 0x3F));
+            ret[2] = (char) (0x80 | ((cp >> 6) & 0x3F));
+            ret[3] = (char) (0x80 | (cp & 0x3F));
+            return 4;
+        }
+        
+        return 0;
+    }
+    
+    UTF8Char::CodePoint UTF8Char::fromStr(const char* str)
+    {
+        return (CodePoint) String::ToHex (str);
+    }
+    
+    size_t UTF8Char::GetSequenceSize(Octet first)
+    {
+        if(first < 0x80) return 1;
+        if(first < 0xE0) return 2;
+        if(first < 0xF0) return 3;
+        return 4;
+    }
+    
+    UTF8Char::CodePoint UTF8Char::DecodeSequence(const Octet* data)
+    {
+        Octet o1 = data[0];
+        
+        if(o1 < 0x80)
+            return o1;
+        if(o1 < 0xE0)
+            return ((CodePoint) (o1 & 0x1F) << 6)  |  (CodePoint) (data[1] & 0x3F);
+        if(o1 < 0xF0)
+            return ((CodePoint) (o1 & 0x0F) << 12) | ((CodePoint) (data[1] & 0x3F) << 6) |
+                    (CodePoint) (data[2] & 0x3F);
+        
+        return ((CodePoint) (o1 & 0x07) << 18) | ((CodePoint) (data[1] & 0x3F) << 12) |
+               ((CodePoint) (data[2] & 0x3F) << 6) | (CodePoint) (data[3] & 0x3F);
+    }
+    
+    namespace
+    {
+        inline bool IsContinuation(UTF8Char::Octet o) { return (o & 0xC0) == 0x80; }
+        
+        /** Returns the size of the valid sequence beginning at data[i], or 0. */
+        size_t SequenceLength(const UTF8Char::Octet* data, size_t sz, size_t i)
+        {
+            UTF8Char::Octet o1 = data[i];
+            if(o1 < 0x80)
+                return 1;
             
-            ret[1]  = 0b10000000;
-            ret[1] |= (cpc[4] & 0b11000000) >> 6;
-            ret[1] |= (cpc[3] & 0b00001111) << 2;
+            size_t n;
+            if(o1 >= 0xC2 && o1 <= 0xDF)      n = 2;
+            else if(o1 >= 0xE0 && o1 <= 0xEF) n = 3;
+            else if(o1 >= 0xF0 && o1 <= 0xF4) n = 4;
+            else return 0;
             
-            ret[0]  = 0b11100000;
-            ret[0] |= (cpc[3] & 0b11000000) >> 6;
-            ret[0] |= (cpc[2] & 0b00000011) << 2;
+            if(i + n > sz)
+                return 0;
             
-            return 3;
+            // The second octet range depends on the first one, to
+            // forbid overlong forms, surrogates and too large values.
+            UTF8Char::Octet min = 0x80, max = 0xBF;
+            if(o1 == 0xE0)      min = 0xA0;
+            else if(o1 == 0xED) max = 0x9F;
+            else if(o1 == 0xF0) min = 0x90;
+            else if(o1 == 0xF4) max = 0x8F;
+            
+            if(data[i + 1] < min || data[i + 1] > max)
+                return 0;
+            for(size_t k = 2; k < n; ++k)
+                if(!IsContinuation(data[i + k]))
+                    return 0;
+            
+            return n;
         }
         
-        if(nsegmentsize == 4)
+        /** Validates octet by octet from data[i], which must begin a sequence. */
+        size_t ValidateScalar(const UTF8Char::Octet* data, size_t sz, size_t i)
         {
-            // [17 - 21 bits]
+            while(i < sz)
+            {
+                size_t n = SequenceLength(data, sz, i);
+                if(!n)
+                    return i;
+                i += n;
+            }
             
-            ret[3]  = 0b10000000;
-            ret[3] |= cpc[4] & 0b00111111;// We set the 6 bits.
+            return sz;
+        }
+        
+#if defined(APRO_SIMD_AVX2) || defined(APRO_SIMD_SSSE3)
+        
+        /** Returns the beginning of the sequence containing index i,
+         *  or i if it begins a sequence. */
+        size_t SequenceBegin(const UTF8Char::Octet* data, size_t i)
+        {
+            for(size_t k = 1; k <= 3 && k <= i; ++k)
+            {
+                if(!IsContinuation(data[i - k]))
+                    return i - k;
+            }
             
-            ret[2]  = 0b10000000;
-            ret[2] |= (cpc[4] & 0b11000000) >> 6;
-            ret[2] |= (cpc[3] & 0b00001111) << 2;
+            return i;
+        }
+        
+        // Validation from "Validating UTF-8 In Less Than One Instruction
+        // Per Byte" (Keiser, Lemire) : every error of a two octets
+        // sequence is a bit in three 16 entries tables, looked up with
+        // the high nibble of the previous octet, its low nibble and the
+        // high nibble of the current octet. An error remains if the three
+        // looked up values share a bit.
+        
+        const uint8_t TOO_SHORT   = 1 << 0; // 11______ 0_______ or 11______ 11______
+        const uint8_t TOO_LONG    = 1 << 1; // 0_______ 10______
+        const uint8_t OVERLONG_3  = 1 << 2; // 11100000 100_____
+        const uint8_t TOO_LARGE   = 1 << 3; // 11110100 1001____, 11110100 101_____, 11110101+ 10______
+        const uint8_t SURROGATE   = 1 << 4; // 11101101 101_____
+        const uint8_t OVERLONG_2  = 1 << 5; // 1100000_ 10______
+        const uint8_t TOO_LARGE_1000 = 1 << 6; // 11110101+ 1000____
+        const uint8_t OVERLONG_4  = 1 << 6; // 11110000 1000____
+        const uint8_t TWO_CONTS   = 1 << 7; // 10______ 10______ (not an error in 3 and 4 octets sequences)
+        const uint8_t CARRY       = TOO_SHORT | TOO_LONG | TWO_CONTS;
+        
+#   define APRO_UTF8_BYTE1_HIGH \
+            TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, \
+            TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, \
+            TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS, \
+            TOO_SHORT | OVERLONG_2, \
+            TOO_SHORT, \
+            TOO_SHORT | OVERLONG_3 | SURROGATE, \
+            TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+        
+#   define APRO_UTF8_BYTE1_LOW \
+            CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4, \
+            CARRY | OVERLONG_2, \
+            CARRY, \
+            CARRY, \
+            CARRY | TOO_LARGE, \
+            CARRY | TOO_LARGE | TOO_LARGE_1000, \
+            CARRY | TOO_LARGE | TOO_LARGE_1000, \
+            CARRY | TOO_LARGE | TOO_LARGE_1000, \
+            CARRY | TOO_LARGE | TOO_LARGE_1000, \
+            CARRY | TOO_LARGE | TOO_LARGE_1000, \
+            CARRY | TOO_LARGE | TOO_LARGE_1000, \
+            CARRY | TOO_LARGE | TOO_LARGE_1000, \
+            CARRY | TOO_LARGE | TOO_LARGE_1000, \
+            CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE, \
+            CARRY | TOO_LARGE | TOO_LARGE_1000, \
+            CARRY | TOO_LARGE | TOO_LARGE_1000
+        
+#   define APRO_UTF8_BYTE2_HIGH \
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, \
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, \
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4, \
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE, \
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE  | TOO_LARGE, \
+            TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE  | TOO_LARGE, \
+            TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+        
+#   if defined(APRO_SIMD_AVX2)
+        
+        typedef __m256i Block;
+        const size_t BlockSize = 32;
+        
+        inline Block Load(const UTF8Char::Octet* p) { return _mm256_loadu_si256((const __m256i*) p); }
+        inline Block Zero() { return _mm256_setzero_si256(); }
+        inline Block Splat(uint8_t v) { return _mm256_set1_epi8((char) v); }
+        inline Block And(Block a, Block b) { return _mm256_and_si256(a, b); }
+        inline Block Or(Block a, Block b) { return _mm256_or_si256(a, b); }
+        inline Block Xor(Block a, Block b) { return _mm256_xor_si256(a, b); }
+        inline Block SubSat(Block a, Block b) { return _mm256_subs_epu8(a, b); }
+        inline Block Shr4(Block a) { return And(_mm256_srli_epi16(a, 4), Splat(0x0F)); }
+        inline bool  IsAscii(Block a) { return _mm256_movemask_epi8(a) == 0; }
+        inline bool  IsZero(Block a) { return _mm256_testz_si256(a, a) != 0; }
+        
+        template<int N> inline Block Prev(Block input, Block prev)
+        {
+            return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev, input, 0x21), 16 - N);
+        }
+        
+        inline Block Lookup(const Block& table, Block index) { return _mm256_shuffle_epi8(table, index); }
+        
+        const Block Byte1High = _mm256_setr_epi8(APRO_UTF8_BYTE1_HIGH, APRO_UTF8_BYTE1_HIGH);
+        const Block Byte1Low  = _mm256_setr_epi8(APRO_UTF8_BYTE1_LOW,  APRO_UTF8_BYTE1_LOW);
+        const Block Byte2High = _mm256_setr_epi8(APRO_UTF8_BYTE2_HIGH, APRO_UTF8_BYTE2_HIGH);
+        
+        // Only the last three octets of a block may begin a sequence
+        // continuing in the next block.
+        const Block MaxValue = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+                                                -1, -1, -1, -1, -1, -1, -1, -1,
+                                                -1, -1, -1, -1, -1, -1, -1, -1,
+                                                -1, -1, -1, -1, -1, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1);
+        
+#   else
+        
+        typedef __m128i Block;
+        const size_t BlockSize = 16;
+        
+        inline Block Load(const UTF8Char::Octet* p) { return _mm_loadu_si128((const __m128i*) p); }
+        inline Block Zero() { return _mm_setzero_si128(); }
+        inline Block Splat(uint8_t v) { return _mm_set1_epi8((char) v); }
+        inline Block And(Block a, Block b) { return _mm_and_si128(a, b); }
+        inline Block Or(Block a, Block b) { return _mm_or_si128(a, b); }
+        inline Block Xor(Block a, Block b) { return _mm_xor_si128(a, b); }
+        inline Block SubSat(Block a, Block b) { return _mm_subs_epu8(a, b); }
+        inline Block Shr4(Block a) { return And(_mm_srli_epi16(a, 4), Splat(0x0F)); }
+        inline bool  IsAscii(Block a) { return _mm_movemask_epi8(a) == 0; }
+        inline bool  IsZero(Block a) { return _mm_movemask_epi8(_mm_cmpeq_epi8(a, Zero())) == 0xFFFF; }
+        
+        template<int N> inline Block Prev(Block input, Block prev)
+        {
+            return _mm_alignr_epi8(input, prev, 16 - N);
+        }
+        
+        inline Block Lookup(const Block& table, Block index) { return _mm_shuffle_epi8(table, index); }
+        
+        const Block Byte1High = _mm_setr_epi8(APRO_UTF8_BYTE1_HIGH);
+        const Block Byte1Low  = _mm_setr_epi8(APRO_UTF8_BYTE1_LOW);
+        const Block Byte2High = _mm_setr_epi8(APRO_UTF8_BYTE2_HIGH);
+        
+        const Block MaxValue = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+                                             -1, -1, -1, -1, -1, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1);
+        
+#   endif
+        
+#   undef APRO_UTF8_BYTE1_HIGH
+#   undef APRO_UTF8_BYTE1_LOW
+#   undef APRO_UTF8_BYTE2_HIGH
+        
+        /** Returns the errors found in input, knowing the previous block. */
+        inline Block CheckBlock(Block input, Block prev)
+        {
+            Block prev1 = Prev<1>(input, prev);
             
-            ret[1]  = 0b10000000;
-            ret[1] |= (cpc[3] & 0b11000000) >> 6;
-            ret[1] |= (cpc[2] & 0b00001111) << 2;
+            Block special = And(And(Lookup(Byte1High, Shr4(prev1)),
+                                    Lookup(Byte1Low,  And(prev1, Splat(0x0F)))),
+                                    Lookup(Byte2High, Shr4(input)));
             
-            ret[0]  = 0b11110000;
-            ret[0] |= (cpc[2] & 0b11000000) >> 6;
-            ret[0] |= (cpc[1] & 0b00000001) << 2;
+            // Third and fourth octets of a sequence must be continuing
+            // octets : this is where TWO_CONTS is expected.
+            Block third  = SubSat(Prev<2>(input, prev), Splat(0xE0 - 0x80));
+            Block fourth = SubSat(Prev<3>(input, prev), Splat(0xF0 - 0x80));
+            Block must23 = And(Or(third, fourth), Splat(0x80));
             
-            return 4;
+            return Xor(must23, special);
         }
         
-        return 0;
+#endif
     }
     
-    CodePoint UTF8Char::fromStr(const char* str)
+    size_t UTF8Char::Validate(const Octet* data, size_t sz)
     {
-        return (CodePoint) String::ToHex (str);
+        if(!data)
+            return 0;
+        
+        size_t i = 0;
+        
+#if defined(APRO_SIMD_AVX2) || defined(APRO_SIMD_SSSE3)
+        
+        Block prev = Zero();
+        Block prevIncomplete = Zero();
+        
+        for(; i + BlockSize <= sz; i += BlockSize)
+        {
+            Block input = Load(data + i);
+            
+            if(IsAscii(input))
+            {
+                // Only a sequence truncated by the previous block can
+                // be wrong.
+                if(!IsZero(prevIncomplete))
+                    break;
+            }
+            else
+            {
+                if(!IsZero(CheckBlock(input, prev)))
+                    break;
+                
+                prevIncomplete = SubSat(input, MaxValue);
+            }
+            
+            prev = input;
+        }
+        
+        // Either there is an error in this block, or less than a block
+        // remains : the scalar version finds exactly where. The previous
+        // blocks are valid, so the sequence containing i begins at most
+        // 3 octets before.
+        i = SequenceBegin(data, i);
+        
+#elif defined(APRO_SIMD_SSE2)
+        
+        // Without SSSE3, only ASCII blocks can be skipped at once.
+        while(i + 16 <= sz)
+        {
+            if(_mm_movemask_epi8(_mm_loadu_si128((const __m128i*) (data + i))) == 0)
+            {
+                i += 16;
+                continue;
+            }
+            
+            size_t end = i + 16;
+            while(i < end)
+            {
+                size_t n = SequenceLength(data, sz, i);
+                if(!n)
+                    return i;
+                i += n;
+            }
+        }
+        
+#endif
+        
+        return ValidateScalar(data, sz, i);
     }
     
+    size_t UTF8Char::CountCodePoints(const Octet* data, size_t sz)
+    {
+        // Every octet which is not a continuing one begins a CodePoint.
+        size_t count = 0;
+        size_t i = 0;
+        
+#if defined(APRO_SIMD_AVX2)
+        
+        const __m256i cont = _mm256_set1_epi8((char) 0xBF);
+        for(; i + 32 <= sz; i += 32)
+        {
+            __m256i v = _mm256_loadu_si256((const __m256i*) (data + i));
+            count += __builtin_popcount((unsigned int) _mm256_movemask_epi8(_mm256_cmpgt_epi8(v, cont)));
+        }
+        
+#elif defined(APRO_SIMD_SSE2)
+        
+        const __m128i cont = _mm_set1_epi8((char) 0xBF);
+        for(; i + 16 <= sz; i += 16)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*) (data + i));
+            count += __builtin_popcount((unsigned int) _mm_movemask_epi8(_mm_cmpgt_epi8(v, cont)));
+        }
+        
+#endif
+        
+        for(; i < sz; ++i)
+        {
+            if(!IsContinuation(data[i]))
+                count++;
+        }
+        
+        return count;
+    }
     
+    size_t UTF8Char::Decode(const Octet* data, size_t sz, CodePoint* out)
+    {
+        size_t count = 0;
+        size_t i = 0;
+        
+        while(i < sz)
+        {
+#if defined(APRO_SIMD_SSE2)
+            
+            // ASCII blocks are widened 16 octets at a time.
+            while(i + 16 <= sz)
+            {
+                __m128i v = _mm_loadu_si128((const __m128i*) (data + i));
+                if(_mm_movemask_epi8(v) != 0)
+                    break;
+                
+                const __m128i zero = _mm_setzero_si128();
+                __m128i lo = _mm_unpacklo_epi8(v, zero);
+                __m128i hi = _mm_unpackhi_epi8(v, zero);
+                
+                _mm_storeu_si128((__m128i*) (out + count),      _mm_unpacklo_epi16(lo, zero));
+                _mm_storeu_si128((__m128i*) (out + count + 4),  _mm_unpackhi_epi16(lo, zero));
+                _mm_storeu_si128((__m128i*) (out + count + 8),  _mm_unpacklo_epi16(hi, zero));
+                _mm_storeu_si128((__m128i*) (out + count + 12), _mm_unpackhi_epi16(hi, zero));
+                
+                i += 16;
+                count += 16;
+            }
+            
+            if(i >= sz)
+                break;
+            
+#endif
+            
+            out[count++] = DecodeSequence(data + i);
+            i += GetSequenceSize(data[i]);
+        }
+        
+        return count;
+    }
     
     // -------------------------------------------------------------------------
     
-    
-    
     UTF8String::UTF8String()
+        : mlength(0), mindexed(false)
     {
         
     }
     
     UTF8String::UTF8String(const UTF8String& str)
+        : mlength(str.mlength), mindexed(false)
     {
-        mdata.append(str);
+        mdata.reserve(str.mdata.size());
+        mdata.append(str.mdata.pointer(), str.mdata.size());
     }
     
 #if APRO_CPP11
     
     UTF8String::UTF8String(UTF8String&& str)
+        : mlength(str.mlength), mindexed(false)
     {
-        mdata.acquireData(str.mdata.ptr(), str.mdata.size(), str.mdata.physicalSize());
-        str.acquireData(nullptr, 0, 0);
+        mdata.swap(str.mdata);
+        str.mlength = 0;
+        str.mindexed = false;
     }
     
 #endif
     
+    UTF8String& UTF8String::operator = (const UTF8String& str)
+    {
+        if(this != &str)
+        {
+            Array<UTF8Char::Octet> data;
+            data.reserve(str.mdata.size());
+            data.append(str.mdata.pointer(), str.mdata.size());
+            
+            assign(data);
+            mlength = str.mlength;
+        }
+        
+        return *this;
+    }
+    
+    UTF8Char::CodePoint UTF8String::at(size_t index) const
+    {
+        if(index >= mlength)
+            return UTF8Char::CPInvalid;
+        
+        if(!mindexed)
+            buildIndex();
+        
+        // Walks at most IndexStride CodePoints from the closest entry.
+        const UTF8Char::Octet* octet = mdata.pointer() + mindex.at(index / IndexStride);
+        for(size_t i = index % IndexStride; i > 0; --i)
+            octet += UTF8Char::GetSequenceSize(*octet);
+        
+        return UTF8Char::DecodeSequence(octet);
+    }
+    
     void UTF8String::append(const UTF8String& str)
     {
-        // Forget the Null-terminated
-        if(mdata.last() == UTF8Char::CPNull)
-            mdata.erase(mdata.last());
+        if(str.mdata.isEmpty())
+            return;
         
-        // Only concatenate the two arrays.
-        mdata.append(str.mdata);
+        if(this == &str)
+        {
+            UTF8String copy(str);
+            append(copy);
+            return;
+        }
         
-        // Take the Null character at the end again.
-        mdata.append(UTF8Char::CPNull);
+        mdata.reserve(mdata.size() + str.mdata.size());
+        mdata.append(str.mdata.pointer(), str.mdata.size());
+        mlength += str.mlength;
+        mindexed = false;
     }
     
     void UTF8String::append (const UTF8Char::CodePoint& cp)
     {
-        if(cp == UTF8Char::CPNull)
+        char octets[4];
+        int sz = UTF8Char::toChar(octets, cp);
+        
+        if(!sz)
         {
-            mdata.append(cp);
+            aprodebug("Invalid CodePoint ") << (unsigned int) cp << ".";
             return;
         }
         
-        // Forget the Null-terminated
-        if(mdata.last() == UTF8Char::CPNull)
-            mdata.erase(mdata.last());
+        mdata.append((const UTF8Char::Octet*) octets, (size_t) sz);
+        mlength++;
+        mindexed = false;
+    }
+    
+    bool UTF8String::appendUtf8 (const UTF8Char::Octet* data, size_t sz)
+    {
+        if(!data || !sz)
+            return true;
         
-        mdata.append(cp);
+        if(UTF8Char::Validate(data, sz) != sz)
+            return false;
         
-        // Take the Null character at the end again.
-        mdata.append(UTF8Char::CPNull);
+        mdata.reserve(mdata.size() + sz);
+        mdata.append(data, sz);
+        mlength += UTF8Char::CountCodePoints(data, sz);
+        mindexed = false;
+        return true;
     }
     
     void UTF8String::prepend (const UTF8String& str)
     {
-        mdata.prepend(str.mdata, str.size());
+        if(str.mdata.isEmpty())
+            return;
+        
+        Array<UTF8Char::Octet> data;
+        data.reserve(str.mdata.size() + mdata.size());
+        data.append(str.mdata.pointer(), str.mdata.size());
+        data.append(mdata.pointer(), mdata.size());
+        
+        size_t length = mlength + str.mlength;
+        assign(data);
+        mlength = length;
+    }
+    
+    void UTF8String::clear()
+    {
+        Array<UTF8Char::Octet> data;
+        assign(data);
+        mlength = 0;
+    }
+    
+    void UTF8String::erase(const_iterator beg, const_iterator e)
+    {
+        const UTF8Char::Octet* first = beg.pointer();
+        const UTF8Char::Octet* last  = e.pointer() ? e.pointer() : mdata.pointer() + mdata.size();
+        
+        if(!first || first >= last)
+            return;
+        
+        size_t before = (size_t) (first - mdata.pointer());
+        size_t after  = (size_t) (mdata.pointer() + mdata.size() - last);
+        size_t erased = UTF8Char::CountCodePoints(first, (size_t) (last - first));
+        
+        Array<UTF8Char::Octet> data;
+        data.reserve(before + after);
+        data.append(mdata.pointer(), before);
+        data.append(last, after);
+        
+        size_t length = mlength - erased;
+        assign(data);
+        mlength = length;
+    }
+    
+    void UTF8String::insert(const UTF8Char::CodePoint& cp, const_iterator before)
+    {
+        char octets[4];
+        int sz = UTF8Char::toChar(octets, cp);
+        
+        if(!sz)
+        {
+            aprodebug("Invalid CodePoint ") << (unsigned int) cp << ".";
+            return;
+        }
+        
+        const UTF8Char::Octet* pos = before.pointer() ? before.pointer() : mdata.pointer() + mdata.size();
+        size_t head = (size_t) (pos - mdata.pointer());
+        
+        Array<UTF8Char::Octet> data;
+        data.reserve(mdata.size() + (size_t) sz);
+        data.append(mdata.pointer(), head);
+        data.append((const UTF8Char::Octet*) octets, (size_t) sz);
+        data.append(pos, mdata.size() - head);
+        
+        size_t length = mlength + 1;
+        assign(data);
+        mlength = length;
+    }
+    
+    void UTF8String::assign(Array<UTF8Char::Octet>& data)
+    {
+        // Array::clear() does not release the memory, swapping does.
+        mdata.swap(data);
+        mindexed = false;
+    }
+    
+    void UTF8String::buildIndex() const
+    {
+        Array<size_t> index;
+        index.reserve(mlength / IndexStride + 1);
+        
+        const UTF8Char::Octet* data = mdata.pointer();
+        size_t offset = 0;
+        
+        for(size_t i = 0; i < mlength; ++i)
+        {
+            if(i % IndexStride == 0)
+                index.append(offset);
+            offset += UTF8Char::GetSequenceSize(data[offset]);
+        }
+        
+        mindex.swap(index);
+        mindexed = true;
     }
     
     UTF8String UTF8String::fromAscii (const char* str)
     {
         UTF8String ret;
-        char* c = str;
-        while(*c) {
-            ret.append(*c);
-            c++;
+        if(str)
+        {
+            // ASCII is a subset of UTF-8.
+            if(!ret.appendUtf8((const UTF8Char::Octet*) str, strlen(str)))
+                aprodebug("Given string is not ASCII.");
         }
         return ret;
     }
     
     UTF8String UTF8String::fromUtf8Data (const UTF8Char::Octet* data)
+    {
+        if(!data)
+            return UTF8String();
+        
+        return fromUtf8Data(data, strlen((const char*) data));
+    }
+    
+    UTF8String UTF8String::fromUtf8Data (const UTF8Char::Octet* data, size_t sz)
     {
         UTF8String ret;
-        if(data)
+        if(data && sz)
         {
-            UTF8Char::Octet* octet = data;
-            while(octet != UTF8Char::CPNull)
-            {
-                UTF8Char::CodePoint cp = UTF8Char::ExtractUTF8CodePoint(octet[0], octet[1], octet[2], octet[3]);
-                size_t segsz = UTF8Char::GetCodePointSegmentSize(cp);
-                octet = octet + segsz;
-            }
+            size_t valid = UTF8Char::Validate(data, sz);
+            if(valid != sz)
+                aprodebug("Invalid UTF-8 sequence at octet ") << (unsigned int) valid << ".";
+            
+            // Already validated : appendUtf8() would do it again.
+            ret.mdata.reserve(valid);
+            ret.mdata.append(data, valid);
+            ret.mlength = UTF8Char::CountCodePoints(data, valid);
         }
         return ret;
     }
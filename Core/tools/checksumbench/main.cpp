@@ -0,0 +1,115 @@
+/////////////////////////////////////////////////////////////
+/** @file main.cpp
+ *  @ingroup Tools
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Command-line tool measuring the speed of the CheckSum
+ *  implementations.
+ *
+ *  Usage : checksumbench [size in MB]
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "CheckSumCRC16.h"
+#include "CheckSumCRC32C.h"
+#include "CheckSumXXH64.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace APro;
+
+typedef uint64_t (*BenchFunction)(const Byte* data, size_t sz);
+
+static uint64_t BenchCRC16(const Byte* data, size_t sz)
+{
+    static CheckSumCRC16 crc;
+    return (uint64_t) (uintptr_t) crc.generate(data, (uint32_t) sz);
+}
+
+static uint64_t BenchCRC32C(const Byte* data, size_t sz)
+{
+    return CheckSumCRC32C::Compute(data, sz);
+}
+
+static uint64_t BenchCRC32CSoftware(const Byte* data, size_t sz)
+{
+    return CheckSumCRC32C::ComputeSoftware(data, sz);
+}
+
+static uint64_t BenchXXH64(const Byte* data, size_t sz)
+{
+    return CheckSumXXH64::Compute(data, sz);
+}
+
+/// Runs given function until one second is spent, and prints its
+/// speed.
+static void Run(const char* name, BenchFunction function, const Byte* data, size_t sz)
+{
+    typedef std::chrono::steady_clock Clock;
+
+    uint64_t result = function(data, sz);
+    size_t   rounds = 0;
+
+    Clock::time_point begin = Clock::now();
+    double            elapsed;
+    do
+    {
+        result ^= function(data, sz);
+        rounds++;
+        elapsed = std::chrono::duration<double>(Clock::now() - begin).count();
+    } while(elapsed < 1.0);
+
+    printf("%-16s %8.2f GB/s  (%016llx)\n", name, (double) sz * rounds / elapsed / 1e9, (unsigned long long) result);
+}
+
+int main(int argc, char** argv)
+{
+    size_t megabytes = argc > 1 ? (size_t) strtoul(argv[1], nullptr, 10) : 64;
+    if(!megabytes)
+    {
+        fprintf(stderr, "Usage : %s [size in MB]\n", argv[0]);
+        return 1;
+    }
+
+    size_t sz   = megabytes * 1024 * 1024;
+    Byte*  data = (Byte*) AProAllocate(sz);
+
+    // Not compressible, not constant : as real data for a checksum.
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for(size_t i = 0; i < sz; ++i)
+    {
+        state   = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        data[i] = (Byte) (state >> 56);
+    }
+
+    printf("%u MB buffer.\n", (unsigned) megabytes);
+    Run("CRC16",           &BenchCRC16,          data, sz);
+    Run("CRC32C",          &BenchCRC32C,         data, sz);
+    Run("CRC32C (tables)", &BenchCRC32CSoftware, data, sz);
+    Run("XXH64",           &BenchXXH64,          data, sz);
+
+    AProDeallocate(data);
+    return 0;
+}
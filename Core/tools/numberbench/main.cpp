@@ -0,0 +1,222 @@
+/////////////////////////////////////////////////////////////
+/** @file main.cpp
+ *  @ingroup Tools
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Command-line tool checking that NumberFormat reals read back
+ *  to the same value, and measuring its speed against the C
+ *  library.
+ *
+ *  Usage : numberbench [count]
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "NumberFormat.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace APro;
+
+static uint64_t state = 0x9E3779B97F4A7C15ULL;
+
+static uint64_t Random()
+{
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return state ^ (state >> 29);
+}
+
+/// Random finite doubles : half of them from random bits, half of
+/// them with few decimals, as in text files.
+static void Fill(double* values, size_t count)
+{
+    for(size_t i = 0; i < count; ++i)
+    {
+        double value = 0;
+        while(value == 0 || !std::isfinite(value))
+        {
+            if(i & 1)
+            {
+                uint64_t bits = Random();
+                memcpy(&value, &bits, sizeof(value));
+            }
+            else
+            {
+                value = (double) (Random() % 2000000) / (double) (1 + Random() % 1000);
+            }
+        }
+
+        values[i] = value;
+    }
+}
+
+/// Returns the number of values which do not read back the same.
+static size_t Check(const double* values, size_t count)
+{
+    size_t errors = 0;
+    char   buffer[NumberFormat::MaxRealSize + 1];
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        size_t sz = NumberFormat::Format(buffer, values[i]);
+        buffer[sz] = '\0';
+
+        double parsed = 0;
+        if(strtod(buffer, nullptr) != values[i] || NumberFormat::Parse(buffer, sz, parsed) != sz || parsed != values[i])
+            errors++;
+
+        float  f = (float) values[i];
+        float  fparsed = 0;
+        if(std::isfinite(f) && f != 0)
+        {
+            sz = NumberFormat::Format(buffer, f);
+            buffer[sz] = '\0';
+            if(strtof(buffer, nullptr) != f || NumberFormat::Parse(buffer, sz, fparsed) != sz || fparsed != f)
+                errors++;
+        }
+    }
+
+    return errors;
+}
+
+typedef size_t (*BenchFunction)(const double* values, size_t count);
+
+/// Runs given function until one second is spent, and prints the
+/// number of values converted per second.
+static void Run(const char* name, BenchFunction function, const double* values, size_t count)
+{
+    typedef std::chrono::steady_clock Clock;
+
+    size_t result = function(values, count);
+    size_t rounds = 0;
+
+    Clock::time_point begin = Clock::now();
+    double            elapsed;
+    do
+    {
+        result += function(values, count);
+        rounds++;
+        elapsed = std::chrono::duration<double>(Clock::now() - begin).count();
+    } while(elapsed < 1.0);
+
+    printf("%-24s %8.2f M/s  (%zu)\n", name, (double) count * rounds / elapsed / 1e6, result);
+}
+
+static size_t BenchFormat(const double* values, size_t count)
+{
+    char   buffer[NumberFormat::MaxRealSize];
+    size_t total = 0;
+    for(size_t i = 0; i < count; ++i)
+        total += NumberFormat::Format(buffer, values[i]);
+    return total;
+}
+
+static size_t BenchSnprintf(const double* values, size_t count)
+{
+    char   buffer[NumberFormat::MaxRealSize];
+    size_t total = 0;
+    for(size_t i = 0; i < count; ++i)
+        total += (size_t) snprintf(buffer, sizeof(buffer), "%.17g", values[i]);
+    return total;
+}
+
+/// Smallest precision reading back the same value, with snprintf()
+/// and strtod() : what NumberFormat did before.
+static size_t BenchSnprintfShortest(const double* values, size_t count)
+{
+    char   buffer[NumberFormat::MaxRealSize];
+    size_t total = 0;
+    for(size_t i = 0; i < count; ++i)
+    {
+        for(int precision = 15; precision <= 17; ++precision)
+        {
+            int sz = snprintf(buffer, sizeof(buffer), "%.*g", precision, values[i]);
+            if(strtod(buffer, nullptr) == values[i])
+            {
+                total += (size_t) sz;
+                break;
+            }
+        }
+    }
+    return total;
+}
+
+static char (*texts)[NumberFormat::MaxRealSize + 1] = nullptr;
+
+static size_t BenchParse(const double*, size_t count)
+{
+    size_t total = 0;
+    for(size_t i = 0; i < count; ++i)
+    {
+        double value;
+        total += NumberFormat::Parse(texts[i], strlen(texts[i]), value);
+    }
+    return total;
+}
+
+static size_t BenchStrtod(const double*, size_t count)
+{
+    size_t total = 0;
+    for(size_t i = 0; i < count; ++i)
+    {
+        char* end;
+        strtod(texts[i], &end);
+        total += (size_t) (end - texts[i]);
+    }
+    return total;
+}
+
+int main(int argc, char** argv)
+{
+    size_t count = argc > 1 ? (size_t) strtoul(argv[1], nullptr, 10) : 1000000;
+    if(!count)
+    {
+        fprintf(stderr, "Usage : %s [count]\n", argv[0]);
+        return 1;
+    }
+
+    double* values = (double*) AProAllocate(count * sizeof(double));
+    texts = (char (*)[NumberFormat::MaxRealSize + 1]) AProAllocate(count * sizeof(*texts));
+    Fill(values, count);
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        size_t sz = NumberFormat::Format(texts[i], values[i]);
+        texts[i][sz] = '\0';
+    }
+
+    size_t errors = Check(values, count);
+    printf("%u values checked : %u errors.\n", (unsigned) count, (unsigned) errors);
+
+    Run("Format",                &BenchFormat,           values, count);
+    Run("snprintf %.17g",        &BenchSnprintf,         values, count);
+    Run("snprintf shortest",     &BenchSnprintfShortest, values, count);
+    Run("Parse",                 &BenchParse,            values, count);
+    Run("strtod",                &BenchStrtod,           values, count);
+
+    AProDeallocate(texts);
+    AProDeallocate(values);
+    return errors ? 1 : 0;
+}
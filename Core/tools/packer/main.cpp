@@ -0,0 +1,94 @@
+/////////////////////////////////////////////////////////////
+/** @file main.cpp
+ *  @ingroup Tools
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Command-line tool building a ResourcePack from a directory.
+ *
+ *  Usage : packer [-a alignment] [-c] <directory> <pack>
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "ResourcePack.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace APro;
+
+static int Usage(const char* program)
+{
+    fprintf(stderr, "Usage : %s [-a alignment] [-c] <directory> <pack>\n", program);
+    fprintf(stderr, "  -a alignment : Alignment of the entries, in bytes (default %u).\n",
+            (unsigned) ResourcePackWriter::DefaultAlignment);
+    fprintf(stderr, "  -c           : Compresses the entries which shrink.\n");
+    return 1;
+}
+
+int main(int argc, char** argv)
+{
+    ResourcePackWriter writer;
+    const char* directory = nullptr;
+    const char* pack      = nullptr;
+
+    for(int i = 1; i < argc; ++i)
+    {
+        if(strcmp(argv[i], "-a") == 0 && i + 1 < argc)
+        {
+            writer.setAlignment((size_t) strtoul(argv[++i], nullptr, 10));
+        }
+        else if(strcmp(argv[i], "-c") == 0)
+        {
+            writer.setMethod(ResourcePack::M_LZ);
+        }
+        else if(argv[i][0] == '-')
+        {
+            return Usage(argv[0]);
+        }
+        else if(!directory)
+        {
+            directory = argv[i];
+        }
+        else if(!pack)
+        {
+            pack = argv[i];
+        }
+        else
+        {
+            return Usage(argv[0]);
+        }
+    }
+
+    if(!directory || !pack)
+        return Usage(argv[0]);
+
+    size_t count = writer.addDirectory(String(directory));
+    if(!writer.write(String(pack)))
+    {
+        fprintf(stderr, "Can't write pack '%s'.\n", pack);
+        return 2;
+    }
+
+    printf("%u files packed in '%s'.\n", (unsigned) count, pack);
+    return 0;
+}
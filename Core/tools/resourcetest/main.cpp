@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////
+/** @file main.cpp
+ *  @ingroup Tools
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Command-line tool checking that the ResourceManager loads an
+ *  entry once when it is asked for it by several requests at once.
+ *
+ *  Usage : resourcetest
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "ResourceManager.h"
+#include "NullResource.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+using namespace APro;
+
+/// Loader counting its loads. Each load lasts long enough for the
+/// other requests to come while it runs.
+class CountingLoader : public ResourceLoader
+{
+public:
+
+    std::atomic<int> loads;
+
+    CountingLoader()
+        : ResourceLoader(String("CountingLoader"), String("Loader counting its loads")), loads(0)
+    {
+
+    }
+
+    bool isThreadSafe() const
+    {
+        return true;
+    }
+
+    ResourcePtr loadResource(const String& filename)
+    {
+        loads++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        return ResourcePtr(AProNew(NullResource, filename));
+    }
+};
+
+static unsigned failures = 0;
+
+static void Check(bool condition, const char* what)
+{
+    printf("%-56s %s\n", what, condition ? "ok" : "FAILED");
+    if(!condition)
+        failures++;
+}
+
+int main()
+{
+    ResourceManager manager;
+
+    CountingLoader*   counter = AProNew(CountingLoader);
+    ResourceLoaderPtr loader(counter);
+    manager.addLoader(loader);
+    manager.setDefaultLoader(String(".res"), loader->getName());
+    manager.startLoadingThreads(2);
+
+    // Two asynchronous requests for the same name.
+    ResourceFuture first  = manager.loadResourceAsync(String("Shared"), String("shared.res"), loader, 0);
+    ResourceFuture second = manager.loadResourceAsync(String("Shared"), String("shared.res"), loader, 0);
+    ResourcePtr    a      = first.wait();
+    ResourcePtr    b      = second.wait();
+
+    Check(counter->loads == 1, "Two async requests load the entry once");
+    Check(!a.isNull() && a.getPointer() == b.getPointer(), "Both futures give the same resource");
+    Check(manager.getResource(String("Shared")).getPointer() == a.getPointer(), "The entry holds the loaded resource");
+
+    ResourceFuture third = manager.loadResourceAsync(String("Shared"), String("shared.res"), loader, 0);
+    Check(third.isReady() && counter->loads == 1, "A loaded entry is not loaded again");
+
+    // A synchronous load while the asynchronous one runs.
+    ResourceFuture pending = manager.loadResourceAsync(String("Mixed"), String("mixed.res"), loader, 0);
+    manager.loadResource(String("Mixed"), String("mixed.res"));
+    Check(counter->loads == 2, "A sync load shares the pending async one");
+    Check(pending.wait().getPointer() == manager.getResource(String("Mixed")).getPointer(), "The sync load gives the async resource");
+
+    // A stub used from several threads at once.
+    manager.registerResource(String("Lazy"), String("lazy.res"), loader->getName());
+    ResourceFuture prefetch = manager.prefetch(String("Lazy"));
+    std::thread user([&manager] () { manager.getResource(String("Lazy")); });
+    ResourcePtr lazy = manager.getResource(String("Lazy"));
+    user.join();
+    Check(counter->loads == 3 && !lazy.isNull(), "A stub prefetched and used is loaded once");
+    Check(manager.getResourceState(String("Lazy")) == ResourceManager::ResourceEntry::S_Ready, "The stub is ready once loaded");
+
+    manager.stopLoadingThreads();
+
+    printf("%u failures.\n", failures);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,236 @@
+/////////////////////////////////////////////////////////////
+/** @file main.cpp
+ *  @ingroup Tools
+ *
+ *  @author Luk2010
+ *  @date 18/10/2026
+ *
+ *  @brief
+ *  Command-line tool checking the StringSearch primitives against
+ *  naive versions, and measuring their speed.
+ *
+ *  Usage : stringbench [size in MB]
+ *
+ *  @copyright
+ *  Atlanti's Project Engine
+ *  Copyright (C) 2012 - 2026  Atlanti's Corp
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+**/
+////////////////////////////////////////////////////////////
+#include "StringSearch.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace APro;
+
+/// Naive versions, used as reference.
+static size_t NaiveFindChar(const char* data, size_t sz, char c)
+{
+    for(size_t i = 0; i < sz; ++i)
+        if(data[i] == c)
+            return i;
+    return sz;
+}
+
+static size_t NaiveFindLastChar(const char* data, size_t sz, char c)
+{
+    for(size_t i = sz; i > 0; --i)
+        if(data[i - 1] == c)
+            return i - 1;
+    return sz;
+}
+
+static size_t NaiveFind(const char* data, size_t sz, const char* pattern, size_t psz)
+{
+    if(!psz || psz > sz)
+        return sz;
+
+    for(size_t i = 0; i + psz <= sz; ++i)
+    {
+        size_t j = 0;
+        while(j < psz && data[i + j] == pattern[j])
+            ++j;
+        if(j == psz)
+            return i;
+    }
+
+    return sz;
+}
+
+static size_t NaiveFindLast(const char* data, size_t sz, const char* pattern, size_t psz)
+{
+    if(!psz || psz > sz)
+        return sz;
+
+    for(size_t i = sz - psz + 1; i > 0; --i)
+    {
+        size_t j = 0;
+        while(j < psz && data[i - 1 + j] == pattern[j])
+            ++j;
+        if(j == psz)
+            return i - 1;
+    }
+
+    return sz;
+}
+
+static uint64_t state = 0x9E3779B97F4A7C15ULL;
+
+static uint32_t Random()
+{
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (uint32_t) (state >> 33);
+}
+
+/// Fills data with a small alphabet, so that partial matches are
+/// frequent.
+static void Fill(char* data, size_t sz, int letters)
+{
+    for(size_t i = 0; i < sz; ++i)
+        data[i] = (char) ('a' + Random() % letters);
+}
+
+/// Compares every primitive with its naive version on random blocks
+/// of every size up to 256, and returns the number of errors.
+static size_t Check()
+{
+    char   data[256];
+    char   copy[256];
+    char   pattern[24];
+    size_t errors = 0;
+
+    for(size_t round = 0; round < 20000; ++round)
+    {
+        size_t sz  = Random() % (sizeof(data) + 1);
+        size_t psz = Random() % sizeof(pattern);
+        Fill(data, sz, 2 + (int) (round % 5));
+
+        // Half of the patterns are taken from the data.
+        if(sz >= psz && (round & 1))
+            memcpy(pattern, data + Random() % (sz - psz + 1), psz);
+        else
+            Fill(pattern, psz, 2 + (int) (round % 5));
+
+        char c = (char) ('a' + Random() % 8);
+
+        if(StringSearch::FindChar(data, sz, c) != NaiveFindChar(data, sz, c))
+            errors++;
+        if(StringSearch::FindLastChar(data, sz, c) != NaiveFindLastChar(data, sz, c))
+            errors++;
+        if(StringSearch::Find(data, sz, pattern, psz) != NaiveFind(data, sz, pattern, psz))
+            errors++;
+        if(StringSearch::FindLast(data, sz, pattern, psz) != NaiveFindLast(data, sz, pattern, psz))
+            errors++;
+
+        memcpy(copy, data, sz);
+        size_t replaced = StringSearch::ReplaceChar(copy, sz, c, 'z');
+        size_t expected = 0;
+        for(size_t i = 0; i < sz; ++i)
+        {
+            if(data[i] == c)
+            {
+                data[i] = 'z';
+                expected++;
+            }
+        }
+
+        if(replaced != expected || memcmp(copy, data, sz) != 0)
+            errors++;
+    }
+
+    return errors;
+}
+
+typedef size_t (*BenchFunction)(const char* data, size_t sz, const char* pattern, size_t psz);
+
+/// Runs given function until one second is spent, and prints its
+/// speed.
+static void Run(const char* name, BenchFunction function, const char* data, size_t sz, const char* pattern, size_t psz)
+{
+    typedef std::chrono::steady_clock Clock;
+
+    size_t result = function(data, sz, pattern, psz);
+    size_t rounds = 0;
+
+    Clock::time_point begin = Clock::now();
+    double            elapsed;
+    do
+    {
+        result ^= function(data, sz, pattern, psz);
+        rounds++;
+        elapsed = std::chrono::duration<double>(Clock::now() - begin).count();
+    } while(elapsed < 1.0);
+
+    printf("%-24s %8.2f GB/s  (%zu)\n", name, (double) sz * rounds / elapsed / 1e9, result);
+}
+
+static size_t BenchFind(const char* data, size_t sz, const char* pattern, size_t psz)
+{
+    return StringSearch::Find(data, sz, pattern, psz);
+}
+
+static size_t BenchFindLast(const char* data, size_t sz, const char* pattern, size_t psz)
+{
+    return StringSearch::FindLast(data, sz, pattern, psz);
+}
+
+static size_t BenchFindChar(const char* data, size_t sz, const char* pattern, size_t)
+{
+    return StringSearch::FindChar(data, sz, pattern[0]);
+}
+
+static size_t BenchNaiveFindChar(const char* data, size_t sz, const char* pattern, size_t)
+{
+    return NaiveFindChar(data, sz, pattern[0]);
+}
+
+int main(int argc, char** argv)
+{
+    size_t megabytes = argc > 1 ? (size_t) strtoul(argv[1], nullptr, 10) : 16;
+    if(!megabytes)
+    {
+        fprintf(stderr, "Usage : %s [size in MB]\n", argv[0]);
+        return 1;
+    }
+
+    size_t errors = Check();
+    printf("Checked against naive versions : %u errors.\n", (unsigned) errors);
+    if(errors)
+        return 1;
+
+    // Text-like data where the pattern is never found : the whole
+    // block is searched every time.
+    size_t sz   = megabytes * 1024 * 1024;
+    char*  data = (char*) AProAllocate(sz);
+    Fill(data, sz, 26);
+
+    const char  pattern[] = "resource_manager";
+    const char  absent[]  = "#";
+    size_t      psz       = sizeof(pattern) - 1;
+
+    printf("%u MB buffer.\n", (unsigned) megabytes);
+    Run("Find",                &BenchFind,          data, sz, pattern, psz);
+    Run("Find (naive)",        &NaiveFind,          data, sz, pattern, psz);
+    Run("FindLast",            &BenchFindLast,      data, sz, pattern, psz);
+    Run("FindLast (naive)",    &NaiveFindLast,      data, sz, pattern, psz);
+    Run("FindChar",            &BenchFindChar,      data, sz, absent,  1);
+    Run("FindChar (naive)",    &BenchNaiveFindChar, data, sz, absent,  1);
+
+    AProDeallocate(data);
+    return 0;
+}